@@ -15,6 +15,11 @@ public:
     ~OpusDecoderWrapper();
 
     bool Decode(std::vector<uint8_t>&& opus, std::vector<int16_t>& pcm);
+    // Recover the frame lost before this packet from its in-band FEC data
+    // (falls back to packet loss concealment when the packet carries none)
+    bool DecodeFec(const std::vector<uint8_t>& opus, std::vector<int16_t>& pcm);
+    // Packet loss concealment for one missing frame
+    bool Conceal(std::vector<int16_t>& pcm);
     void ResetState();
     void Config(int sample_rate, int channels, int duration_ms);
 
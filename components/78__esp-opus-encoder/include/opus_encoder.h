@@ -25,10 +25,26 @@ public:
         return duration_ms_;
     }
 
+    inline int complexity() const {
+        return complexity_;
+    }
+
     void SetDtx(bool enable);
     void SetComplexity(int complexity);
     void Encode(std::vector<int16_t>&& pcm, std::function<void(std::vector<uint8_t>&& opus)> handler);
-    bool IsBufferEmpty() const { return in_buffer_.empty(); }
+    void Encode(const int16_t* pcm, size_t samples, std::function<void(std::vector<uint8_t>&& opus)> handler);
+
+    // Streaming interface without per-packet allocation: Append() copies samples into the
+    // input ring (two frames), EncodeFrame() encodes the oldest complete frame straight out
+    // of the ring into the caller's buffer.
+    // Returns the number of samples accepted, less than samples when the ring is full
+    size_t Append(const int16_t* pcm, size_t samples);
+    bool HasFrame();
+    // Returns the packet size, 0 when no complete frame is buffered, or a negative opus error
+    // code (the frame is dropped so the caller always makes progress)
+    int EncodeFrame(uint8_t* opus, size_t max_size);
+
+    bool IsBufferEmpty() const { return in_size_ == 0; }
     void ResetState();
     void Config(int sample_rate, int channels, int duration_ms);
 
@@ -38,7 +54,19 @@ private:
     int sample_rate_;
     int duration_ms_;
     int frame_size_;
-    std::vector<int16_t> in_buffer_;
+    int complexity_ = 0;
+
+    // Mirrored ring: every sample is stored at i and i + in_capacity_, so any window of up to
+    // in_capacity_ samples starting inside the first half is contiguous and a frame can be
+    // passed to opus_encode in place
+    std::vector<int16_t> in_ring_;
+    size_t in_capacity_ = 0;
+    size_t in_start_ = 0;
+    size_t in_size_ = 0;
+
+    void ResizeInput();
+    size_t AppendLocked(const int16_t* pcm, size_t samples);
+    int EncodeFrameLocked(uint8_t* opus, size_t max_size);
 };
 
 #endif // _OPUS_ENCODER_H_
@@ -39,6 +39,40 @@ bool OpusDecoderWrapper::Decode(std::vector<uint8_t>&& opus, std::vector<int16_t
     return true;
 }
 
+bool OpusDecoderWrapper::DecodeFec(const std::vector<uint8_t>& opus, std::vector<int16_t>& pcm) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (audio_dec_ == nullptr) {
+        ESP_LOGE(TAG, "Audio decoder is not configured");
+        return false;
+    }
+
+    pcm.resize(frame_size_);
+    auto ret = opus_decode(audio_dec_, opus.data(), opus.size(), pcm.data(), pcm.size(), 1);
+    if (ret < 0) {
+        ESP_LOGE(TAG, "Failed to decode FEC, error code: %d", ret);
+        return false;
+    }
+
+    return true;
+}
+
+bool OpusDecoderWrapper::Conceal(std::vector<int16_t>& pcm) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (audio_dec_ == nullptr) {
+        ESP_LOGE(TAG, "Audio decoder is not configured");
+        return false;
+    }
+
+    pcm.resize(frame_size_);
+    auto ret = opus_decode(audio_dec_, nullptr, 0, pcm.data(), pcm.size(), 0);
+    if (ret < 0) {
+        ESP_LOGE(TAG, "Failed to conceal lost frame, error code: %d", ret);
+        return false;
+    }
+
+    return true;
+}
+
 void OpusDecoderWrapper::ResetState() {
     std::lock_guard<std::mutex> lock(mutex_);
     if (audio_dec_ != nullptr) {
@@ -1,4 +1,5 @@
 #include "opus_encoder.h"
+#include <cstring>
 #include <esp_log.h>
 
 #define TAG "OpusEncoderWrapper"
@@ -18,6 +19,7 @@ OpusEncoderWrapper::OpusEncoderWrapper(int sample_rate, int channels, int durati
     SetComplexity(5);
 
     frame_size_ = sample_rate / 1000 * channels * duration_ms;
+    ResizeInput();
 }
 
 OpusEncoderWrapper::~OpusEncoderWrapper() {
@@ -27,40 +29,94 @@ OpusEncoderWrapper::~OpusEncoderWrapper() {
     }
 }
 
+void OpusEncoderWrapper::ResizeInput() {
+    in_capacity_ = frame_size_ * 2;
+    in_ring_.assign(in_capacity_ * 2, 0);
+    in_start_ = 0;
+    in_size_ = 0;
+}
+
 void OpusEncoderWrapper::Encode(std::vector<int16_t>&& pcm, std::function<void(std::vector<uint8_t>&& opus)> handler) {
+    Encode(pcm.data(), pcm.size(), handler);
+}
+
+void OpusEncoderWrapper::Encode(const int16_t* pcm, size_t samples, std::function<void(std::vector<uint8_t>&& opus)> handler) {
     std::lock_guard<std::mutex> lock(mutex_);
     if (audio_enc_ == nullptr) {
         ESP_LOGE(TAG, "Audio encoder is not configured");
         return;
     }
 
-    if (in_buffer_.empty()) {
-        in_buffer_ = std::move(pcm);
-    } else {
-        in_buffer_.insert(in_buffer_.end(), pcm.begin(), pcm.end());
+    while (samples > 0) {
+        size_t accepted = AppendLocked(pcm, samples);
+        pcm += accepted;
+        samples -= accepted;
+        while (in_size_ >= (size_t)frame_size_) {
+            uint8_t opus[MAX_OPUS_PACKET_SIZE];
+            int ret = EncodeFrameLocked(opus, MAX_OPUS_PACKET_SIZE);
+            if (ret > 0 && handler != nullptr) {
+                handler(std::vector<uint8_t>(opus, opus + ret));
+            }
+        }
     }
+}
 
-    while (in_buffer_.size() >= frame_size_) {
-        uint8_t opus[MAX_OPUS_PACKET_SIZE];
-        auto ret = opus_encode(audio_enc_, in_buffer_.data(), frame_size_, opus, MAX_OPUS_PACKET_SIZE);
-        if (ret < 0) {
-            ESP_LOGE(TAG, "Failed to encode audio, error code: %ld", ret);
-            return;
-        }
+size_t OpusEncoderWrapper::Append(const int16_t* pcm, size_t samples) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return AppendLocked(pcm, samples);
+}
 
-        if (handler != nullptr) {
-            handler(std::vector<uint8_t>(opus, opus + ret));
-        }
+bool OpusEncoderWrapper::HasFrame() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return audio_enc_ != nullptr && in_size_ >= (size_t)frame_size_;
+}
 
-        in_buffer_.erase(in_buffer_.begin(), in_buffer_.begin() + frame_size_);
+int OpusEncoderWrapper::EncodeFrame(uint8_t* opus, size_t max_size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (audio_enc_ == nullptr) {
+        ESP_LOGE(TAG, "Audio encoder is not configured");
+        return OPUS_INVALID_STATE;
+    }
+    return EncodeFrameLocked(opus, max_size);
+}
+
+size_t OpusEncoderWrapper::AppendLocked(const int16_t* pcm, size_t samples) {
+    if (samples > in_capacity_ - in_size_) {
+        samples = in_capacity_ - in_size_;
     }
+    size_t end = (in_start_ + in_size_) % in_capacity_;
+    size_t first = in_capacity_ - end;
+    if (first > samples) {
+        first = samples;
+    }
+    int16_t* ring = in_ring_.data();
+    memcpy(ring + end, pcm, first * sizeof(int16_t));
+    memcpy(ring + end + in_capacity_, pcm, first * sizeof(int16_t));
+    memcpy(ring, pcm + first, (samples - first) * sizeof(int16_t));
+    memcpy(ring + in_capacity_, pcm + first, (samples - first) * sizeof(int16_t));
+    in_size_ += samples;
+    return samples;
+}
+
+int OpusEncoderWrapper::EncodeFrameLocked(uint8_t* opus, size_t max_size) {
+    if (in_size_ < (size_t)frame_size_) {
+        return 0;
+    }
+    auto ret = opus_encode(audio_enc_, in_ring_.data() + in_start_, frame_size_, opus, max_size);
+    in_start_ = (in_start_ + frame_size_) % in_capacity_;
+    in_size_ -= frame_size_;
+    if (ret < 0) {
+        ESP_LOGE(TAG, "Failed to encode audio, error code: %ld", (long)ret);
+    }
+    return ret;
 }
 
 void OpusEncoderWrapper::ResetState() {
     std::lock_guard<std::mutex> lock(mutex_);
     if (audio_enc_ != nullptr) {
         opus_encoder_ctl(audio_enc_, OPUS_RESET_STATE);
-        in_buffer_.clear();
+        in_start_ = 0;
+        in_size_ = 0;
     }
 }
 
@@ -75,6 +131,7 @@ void OpusEncoderWrapper::SetComplexity(int complexity) {
     std::lock_guard<std::mutex> lock(mutex_);
     if (audio_enc_ != nullptr) {
         opus_encoder_ctl(audio_enc_, OPUS_SET_COMPLEXITY(complexity));
+        complexity_ = complexity;
     }
 }
 
@@ -84,7 +141,9 @@ void OpusEncoderWrapper::Config(int sample_rate, int channels, int duration_ms)
         return;
     }
 
+    std::lock_guard<std::mutex> lock(mutex_);
     opus_encoder_init(audio_enc_, sample_rate, channels, OPUS_APPLICATION_VOIP);
 
     frame_size_ = sample_rate / 1000 * channels * duration_ms;
+    ResizeInput();
 }
\ No newline at end of file
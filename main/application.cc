@@ -27,9 +27,13 @@
 #endif
 
 #include <cstring>
+#include <cmath>
+#include <algorithm>
 #include <esp_log.h>
 #include <cJSON.h>
 #include <driver/gpio.h>
+#include <esp_heap_caps.h>
+#include <esp_memory_utils.h>
 #include <arpa/inet.h>
 
 #define TAG "Application"
@@ -46,6 +50,41 @@
 #define CONFIG_AUDIO_LOOP_TASK_STACK_SIZE   (4096*2)
 #endif
 
+#ifndef CONFIG_AUDIO_DECODE_TASK_STACK_SIZE
+#define CONFIG_AUDIO_DECODE_TASK_STACK_SIZE   (4096*4)
+#endif
+
+#ifndef CONFIG_EYE_TARGET_FPS
+#define CONFIG_EYE_TARGET_FPS   30
+#endif
+
+#ifndef CONFIG_EYE_IDLE_FPS
+#define CONFIG_EYE_IDLE_FPS     15
+#endif
+
+#ifndef CONFIG_EYE_TEXTURE_INTERNAL_BUDGET
+#define CONFIG_EYE_TEXTURE_INTERNAL_BUDGET  40
+#endif
+
+#ifndef CONFIG_EYE_PREFETCH_ROWS
+#define CONFIG_EYE_PREFETCH_ROWS    32
+#endif
+#ifndef CONFIG_EYE_LID_FOLLOW_MS
+#define CONFIG_EYE_LID_FOLLOW_MS    250
+#endif
+#ifndef CONFIG_EYE_STYLE_FADE_FRAMES
+#define CONFIG_EYE_STYLE_FADE_FRAMES    8
+#endif
+
+// 魔眼渲染计时，关闭CONFIG_EYE_RENDER_PROFILE时不产生任何代码
+#if CONFIG_EYE_RENDER_PROFILE
+#define EYE_PROFILE_BEGIN(name)         int64_t name = esp_timer_get_time()
+#define EYE_PROFILE_END(stat, name)     (stat).Add((uint32_t)(esp_timer_get_time() - name))
+#else
+#define EYE_PROFILE_BEGIN(name)         do {} while (0)
+#define EYE_PROFILE_END(stat, name)     do {} while (0)
+#endif
+
 static const char* const STATE_STRINGS[] = {
     "unknown",
     "starting",
@@ -96,12 +135,22 @@ Application::Application() {
      startTime = 0;
      timeOfLastBlink = 0;
      timeToNextBlink = 0;
-     upper = upper_default;
-     lower = lower_default;
-     polar = polar_default;
-    //  iris = iris_default;
-    //  sclera = sclera_default;
-     eye_style(7);  // 默认眼睛样式
+     // 表情关键帧表编译进固件，校验失败时只保留显示层的表情，眼睛不随表情变化
+     size_t emotion_table_size;
+     const uint8_t* emotion_table = EyeEmotionBuiltinTable(&emotion_table_size);
+     if (!EyeEmotionTableOpen(emotion_table, emotion_table_size, &eye_emotions_)) {
+         ESP_LOGE(TAG, "Invalid eye emotion table");
+     }
+     EyeTimelineInit(&eye_timeline_, &eye_emotions_, ease);
+     // 先按屏幕配置选择魔眼数据，魔眼任务启动时再按实际屏幕尺寸确认
+#if CONFIG_LCD_GC9A01_160X160
+     if (!SelectEyeAssets(160)) SelectEyeAssets(240);
+#else
+     if (!SelectEyeAssets(240)) SelectEyeAssets(160);
+#endif
+     // 默认眼睛样式，魔眼任务还没有启动，直接换上
+     eye_style_num = 7;
+     ResolveEyeStyle(eye_style_num, &sclera, &iris);
 #endif
 
     esp_timer_create_args_t clock_timer_args = {
@@ -180,10 +229,7 @@ void Application::CheckNewVersion() {
             auto codec = board.GetAudioCodec();
             codec->EnableInput(false);
             codec->EnableOutput(false);
-            {
-                std::lock_guard<std::mutex> lock(mutex_);
-                audio_decode_queue_.clear();
-            }
+            ClearDecodeQueue();
             background_task_->WaitForCompletion();
             delete background_task_;
             background_task_ = nullptr;
@@ -292,11 +338,8 @@ void Application::DismissAlert() {
 
 void Application::PlaySound(const std::string_view& sound) {
     // Wait for the previous sound to finish
-    {
-        std::unique_lock<std::mutex> lock(mutex_);
-        audio_decode_cv_.wait(lock, [this]() {
-            return audio_decode_queue_.empty();
-        });
+    while (!IsDecodeQueueEmpty()) {
+        vTaskDelay(pdMS_TO_TICKS(10));
     }
     background_task_->WaitForCompletion();
 
@@ -314,8 +357,19 @@ void Application::PlaySound(const std::string_view& sound) {
         memcpy(packet.payload.data(), p3->payload, payload_size);
         p += payload_size;
 
-        std::lock_guard<std::mutex> lock(mutex_);
-        audio_decode_queue_.emplace_back(std::move(packet));
+        // 提示音可能比队列长，满时等待音频任务解码腾出位置；等待时不持有锁，网络回调照常入队
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(audio_decode_push_mutex_);
+                if (!audio_decode_queue_.full()) {
+                    audio_decode_queue_.Push(std::move(packet));
+                    break;
+                }
+            }
+            NotifyDecoder();
+            vTaskDelay(pdMS_TO_TICKS(OPUS_FRAME_DURATION_MS / 2));
+        }
+        NotifyDecoder();
     }
 }
 
@@ -436,6 +490,18 @@ void Application::Start() {
     }
     codec->Start();
 
+#ifndef CONFIG_USE_AUDIO_CODEC_DECODE_OPUS
+    output_pcm_ = std::make_unique<PcmRing>(codec->output_sample_rate() * AUDIO_OUTPUT_RING_MS / 1000);
+    output_chunk_.resize(codec->output_sample_rate() * AUDIO_OUTPUT_CHUNK_MS / 1000);
+    output_pacer_.Configure(codec->output_sample_rate(), AUDIO_CODEC_DMA_DESC_NUM, AUDIO_CODEC_DMA_FRAME_NUM);
+#endif
+    xTaskCreate([](void* arg) {
+        Application* app = (Application*)arg;
+        app->AudioDecodeLoop();
+        app->audio_decode_task_handle_ = nullptr;
+        vTaskDelete(NULL);
+    }, "audio_decode", CONFIG_AUDIO_DECODE_TASK_STACK_SIZE, this, 5, &audio_decode_task_handle_);
+
 #if CONFIG_USE_AUDIO_PROCESSOR
     xTaskCreatePinnedToCore([](void* arg) {
         Application* app = (Application*)arg;
@@ -491,9 +557,10 @@ void Application::Start() {
         Alert(Lang::Strings::ERROR, message.c_str(), "sad", Lang::Sounds::P3_EXCLAMATION);
     });
     protocol_->OnIncomingAudio([this](AudioStreamPacket&& packet) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (device_state_ == kDeviceStateSpeaking && audio_decode_queue_.size() < MAX_AUDIO_PACKETS_IN_QUEUE) {
-            audio_decode_queue_.emplace_back(std::move(packet));
+        if (device_state_ == kDeviceStateSpeaking) {
+            std::lock_guard<std::mutex> lock(audio_decode_push_mutex_);
+            audio_decode_queue_.Push(std::move(packet));
+            NotifyDecoder();
         }
     });
     protocol_->OnAudioChannelOpened([this, codec, &board]() {
@@ -620,43 +687,22 @@ void Application::Start() {
     audio_debugger_ = std::make_unique<AudioDebugger>();
     audio_processor_->Initialize(codec);
 #ifndef CONFIG_USE_AUDIO_CODEC_ENCODE_OPUS
-    audio_processor_->OnOutput([this](std::vector<int16_t>&& data) {
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            if (audio_send_queue_.size() >= MAX_AUDIO_PACKETS_IN_QUEUE) {
-                ESP_LOGW(TAG, "Too many audio packets in queue, drop the newest packet");
-                return;
-            }
+    audio_processor_->OnOutput([this](AudioFrame&& frame) {
+        if (audio_send_queue_.full()) {
+            ESP_LOGW(TAG, "Too many audio packets in queue, drop the newest packet");
+            return;
         }
-        background_task_->Schedule([this, data = std::move(data)]() mutable {
-            opus_encoder_->Encode(std::move(data), [this](std::vector<uint8_t>&& opus) {
-                AudioStreamPacket packet;
-                packet.payload = std::move(opus);
-#ifdef CONFIG_USE_SERVER_AEC
-                {
-                    std::lock_guard<std::mutex> lock(timestamp_mutex_);
-                    if (!timestamp_queue_.empty()) {
-                        packet.timestamp = timestamp_queue_.front();
-                        timestamp_queue_.pop_front();
-                    } else {
-                        packet.timestamp = 0;
-                    }
-
-                    if (timestamp_queue_.size() > 3) { // 限制队列长度3
-                        timestamp_queue_.pop_front(); // 该包发送前先出队保持队列长度
-                        return;
-                    }
-                }
-#endif
-                std::lock_guard<std::mutex> lock(mutex_);
-                if (audio_send_queue_.size() >= MAX_AUDIO_PACKETS_IN_QUEUE) {
-                    ESP_LOGW(TAG, "Too many audio packets in queue, drop the oldest packet");
-                    audio_send_queue_.pop_front();
-                }
-                audio_send_queue_.emplace_back(std::move(packet));
-                xEventGroupSetBits(event_group_, SEND_AUDIO_EVENT);
+        // 帧只能移动，不能放进std::function，先排进定长队列；编码阶段没有在运行时才安排它
+        bool schedule;
+        if (!encode_frames_.Push(std::move(frame), &schedule)) {
+            ESP_LOGW(TAG, "Too many audio frames waiting for encoding, drop the newest frame");
+            return;
+        }
+        if (schedule) {
+            background_task_->Schedule([this]() {
+                EncodeAudioFrames();
             });
-        });
+        }
     });
 #endif
     audio_processor_->OnVadStateChange([this](bool speaking) {
@@ -674,6 +720,11 @@ void Application::Start() {
     });
 
     wake_word_->Initialize(codec);
+
+    // 喂入大小按16kHz计，输入采样率更高时先按原采样率读入，帧要放得下重采样前的数据
+    size_t feed_samples = std::max(wake_word_->GetFeedSize(), audio_processor_->GetFeedSize());
+    size_t frame_samples = feed_samples * std::max(codec->input_sample_rate(), 16000) / 16000;
+    audio_frames_ = std::make_unique<AudioFramePool>(AUDIO_READ_FRAMES + AUDIO_PROCESSOR_OUTPUT_FRAMES, frame_samples);
     wake_word_->OnWakeWordDetected([this](const std::string& wake_word) {
         Schedule([this, &wake_word]() {
             if (!protocol_) {
@@ -748,6 +799,8 @@ void Application::OnClockTimer() {
         // SystemInfo::PrintTaskCpuUsage(pdMS_TO_TICKS(1000));
         // SystemInfo::PrintTaskList();
         SystemInfo::PrintHeapStats();
+        PrintAudioQueueStats();
+        PrintEncoderStats();
 
 #if 0
         char pcWriteBuffer[1024];
@@ -792,13 +845,13 @@ void Application::MainEventLoop() {
         auto bits = xEventGroupWaitBits(event_group_, SCHEDULE_EVENT | SEND_AUDIO_EVENT, pdTRUE, pdFALSE, portMAX_DELAY);
 
         if (bits & SEND_AUDIO_EVENT) {
-            std::unique_lock<std::mutex> lock(mutex_);
-            auto packets = std::move(audio_send_queue_);
-            lock.unlock();
-            for (auto& packet : packets) {
+            AudioStreamPacket packet;
+            while (audio_send_queue_.Pop(packet)) {
                 if (!protocol_->SendAudio(packet)) {
+                    audio_send_queue_.Clear();
                     break;
                 }
+                audio_packet_pool_.Push(std::move(packet));     // 池满时包随下一次Pop释放
             }
         }
 
@@ -827,70 +880,197 @@ void Application::AudioLoop() {
     }
 }
 
+// 音频任务：把解码任务输出的PCM写入I2S，长时间没有输出时关闭功放
 void Application::OnAudioOutput() {
-    if (busy_decoding_audio_) {
+    auto now = std::chrono::steady_clock::now();
+    auto codec = Board::GetInstance().GetAudioCodec();
+    const int max_silence_seconds = 10;
+
+#ifndef CONFIG_USE_AUDIO_CODEC_DECODE_OPUS
+    // 一直写到输出环读空或DMA缓冲写满，一次循环读麦克风的时间长于一块输出时也不会落后于播放
+    size_t wrote = DrainAudioOutput(*output_pcm_, output_pacer_, output_chunk_,
+        []() { return (int64_t)esp_timer_get_time(); },
+        [this, codec](const int16_t* data, size_t samples) {
+            NotifyDecoder();    // 腾出了空间，解码任务可以解下一帧
+            codec->OutputData(data, samples);
+        });
+    if (wrote > 0) {
+        MarkFirstAudio();
+        output_started_ = true;
+        last_output_time_ = now;
         return;
     }
+    if (output_pacer_.buffered_us(esp_timer_get_time()) > 0) {
+        return;     // DMA缓冲中还有没播放的音频，还不算读空
+    }
+    if (!playback_active_) {
+        output_started_ = false;
+    } else if (output_started_) {
+        // 播放中输出环被读空：解码没有跟上，或者抖动缓冲放空了
+        output_started_ = false;
+        output_underruns_++;
+    }
+#endif
 
-    auto now = std::chrono::steady_clock::now();
+    // Disable the output if there is no audio data for a long time
+    if (device_state_ == kDeviceStateIdle && !playback_active_) {
+        auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - last_output_time_).count();
+        if (duration > max_silence_seconds) {
+            codec->EnableOutput(false);
+        }
+    }
+}
+
+// 解码任务：收到的包放进抖动缓冲，按输出的进度逐帧取出解码，不再和编码共用后台任务
+void Application::AudioDecodeLoop() {
     auto codec = Board::GetInstance().GetAudioCodec();
-    const int max_silence_seconds = 10;
+    while (!audio_decode_stop_) {
+        // 收到包、音频任务读走PCM或清空队列时被唤醒，否则定时检查抖动缓冲的等待和放空
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(AUDIO_DECODE_POLL_MS));
+        DrainDecodeQueue();
+        while (!audio_decode_stop_ && codec->output_enabled() && DecodeNextFrame()) {
+            DrainDecodeQueue();
+        }
+    }
+}
 
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (audio_decode_queue_.empty()) {
-        // Disable the output if there is no audio data for a long time
-        if (device_state_ == kDeviceStateIdle) {
-            auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - last_output_time_).count();
-            if (duration > max_silence_seconds) {
-                codec->EnableOutput(false);
-            }
+void Application::DrainDecodeQueue() {
+    uint32_t now_ms = esp_timer_get_time() / 1000;
+    if (audio_jitter_reset_.exchange(false)) {
+        audio_jitter_.Reset();
+    }
+    AudioStreamPacket packet;
+    while (audio_jitter_.depth() < JITTER_BUFFER_SLOTS && audio_decode_queue_.Pop(packet)) {
+        if (first_packet_pending_.exchange(false)) {
+            first_packet_ms_ = (esp_timer_get_time() - speaking_start_us_) / 1000;
         }
-        return;
+        audio_jitter_.Put(std::move(packet), now_ms);
     }
+    audio_jitter_depth_ = audio_jitter_.depth();
+}
 
-    auto packet = std::move(audio_decode_queue_.front());
-    audio_decode_queue_.pop_front();
-    lock.unlock();
-    audio_decode_cv_.notify_all();
+// 解码一帧，返回false表示现在不需要或没有帧可以解码
+bool Application::DecodeNextFrame() {
+    auto codec = Board::GetInstance().GetAudioCodec();
+    uint32_t now_ms = esp_timer_get_time() / 1000;
+    // 已经输出、还没播放的音频足够时先不解码，抖动缓冲按实际的播放进度取帧
+#ifdef CONFIG_USE_AUDIO_CODEC_DECODE_OPUS
+    if ((int32_t)(codec_buffered_until_ms_ - now_ms) > AUDIO_OUTPUT_LEAD_MS) {
+        return false;
+    }
+#else
+    if (!AudioOutputWantsDecode(*output_pcm_, codec->output_sample_rate())) {
+        return false;
+    }
+#endif
 
     int free_sram = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
     if(free_sram < 10000){
-        return;
+        return false;
     }
 
-    // Synchronize the sample rate and frame duration
-    SetDecodeSampleRate(packet.sample_rate, packet.frame_duration);
-
-    busy_decoding_audio_ = true;
-    background_task_->Schedule([this, codec, packet = std::move(packet)]() mutable {
-        busy_decoding_audio_ = false;
-        if (aborted_) {
-            return;
+    bool was_playing = audio_jitter_.playing();
+    AudioStreamPacket packet;
+    auto action = audio_jitter_.Get(packet, now_ms);
+    audio_jitter_depth_ = audio_jitter_.depth();
+    playback_active_ = audio_jitter_.playing();
+    if (action == JitterAction::kNone) {
+        if (was_playing) {
+            PrintJitterStats();     // 一段语音播完或放空
         }
+        return false;
+    }
+    if (aborted_) {
+        return true;    // 打断后丢弃剩余的包
+    }
+
 #ifdef CONFIG_USE_AUDIO_CODEC_DECODE_OPUS
-        WriteAudio(packet.payload);
+    // 编解码芯片自己解码，没有FEC和PLC接口，丢失的帧直接跳过
+    if (action == JitterAction::kConceal) {
+        return true;
+    }
+    SetDecodeSampleRate(packet.sample_rate, packet.frame_duration);
+    WriteAudio(packet.payload);
+    if ((int32_t)(codec_buffered_until_ms_ - now_ms) < 0) {
+        codec_buffered_until_ms_ = now_ms;
+    }
+    codec_buffered_until_ms_ += packet.frame_duration;
+    MarkFirstAudio();
+    last_output_time_ = std::chrono::steady_clock::now();
 #else
-        std::vector<int16_t> pcm;
-        if (!opus_decoder_->Decode(std::move(packet.payload), pcm)) {
-            return;
+    if (action == JitterAction::kConceal) {
+        if (opus_decoder_->Conceal(decode_pcm_)) {
+            WriteAudio(decode_pcm_, opus_decoder_->sample_rate());
         }
-        WriteAudio(pcm, opus_decoder_->sample_rate());
+        return true;
+    }
+    // Synchronize the sample rate and frame duration
+    SetDecodeSampleRate(packet.sample_rate, packet.frame_duration);
+    if (action == JitterAction::kRecover && opus_decoder_->DecodeFec(packet.payload, decode_pcm_)) {
+        WriteAudio(decode_pcm_, opus_decoder_->sample_rate());
+    }
+    if (!opus_decoder_->Decode(std::move(packet.payload), decode_pcm_)) {
+        return true;
+    }
+    WriteAudio(decode_pcm_, opus_decoder_->sample_rate());
 #endif
 #ifdef CONFIG_USE_SERVER_AEC
-        std::lock_guard<std::mutex> lock(timestamp_mutex_);
-        timestamp_queue_.push_back(packet.timestamp);
+    std::lock_guard<std::mutex> lock(timestamp_mutex_);
+    timestamp_queue_.push_back(packet.timestamp);
 #endif
-        last_output_time_ = std::chrono::steady_clock::now();
-    });
+    return true;
+}
+
+void Application::NotifyDecoder() {
+    TaskHandle_t task = audio_decode_task_handle_;
+    if (task != nullptr) {
+        xTaskNotifyGive(task);
+    }
+}
+
+// 进入说话状态后第一次输出音频时打印从状态切换到收到第一个包、到开始播放的时间
+void Application::MarkFirstAudio() {
+    if (!first_audio_pending_.exchange(false)) {
+        return;
+    }
+    first_audio_ms_ = (esp_timer_get_time() - speaking_start_us_) / 1000;
+    ESP_LOGI(TAG, "Time to first audio: %d ms (first packet %d ms)", first_audio_ms_.load(), first_packet_ms_.load());
+}
+
+void Application::PrintJitterStats() {
+    auto stats = audio_jitter_.stats();
+    ESP_LOGI(TAG, "Jitter buffer: received %lu, late %lu, lost %lu (fec %lu, plc %lu, skipped %lu), end-of-speech plc %lu, underruns %lu, jitter %lu ms, target %d frames",
+        (unsigned long)stats.received, (unsigned long)stats.late, (unsigned long)stats.lost, (unsigned long)stats.recovered,
+        (unsigned long)stats.concealed, (unsigned long)stats.skipped, (unsigned long)stats.expanded, (unsigned long)stats.underruns,
+        (unsigned long)stats.jitter_ms, stats.target_depth);
+}
+
+// 任何任务都可以调用：丢弃等待解码的包和还没写入I2S的PCM，抖动缓冲由解码任务在下次取包前清空
+void Application::ClearDecodeQueue() {
+    audio_decode_queue_.Clear();
+    audio_jitter_reset_ = true;
+    playback_active_ = false;
+    if (output_pcm_ != nullptr) {
+        output_pcm_->Clear();
+    }
+    NotifyDecoder();
+}
+
+// 包队列、抖动缓冲和输出环都已经播完
+bool Application::IsDecodeQueueEmpty() {
+    if (!audio_decode_queue_.empty() || (output_pcm_ != nullptr && !output_pcm_->empty())) {
+        return false;
+    }
+    return audio_jitter_reset_ || (audio_jitter_depth_ == 0 && !playback_active_);
 }
 
 void Application::OnAudioInput() {
     if (wake_word_->IsDetectionRunning()) {
-        std::vector<int16_t> data;
+        AudioFrame frame;
         int samples = wake_word_->GetFeedSize();
         if (samples > 0) {
-            if (ReadAudio(data, 16000, samples)) {
-                wake_word_->Feed(data);
+            if (ReadAudio(frame, 16000, samples)) {
+                wake_word_->Feed(frame);
                 return;
             }
         }
@@ -901,41 +1081,25 @@ void Application::OnAudioInput() {
         if(free_sram < 10000){
             return;
         }
-        std::vector<uint8_t> opus;
-        if (!ReadAudio(opus, 16000, 30 * 16000 / 1000)) {
+        AudioStreamPacket packet;
+        AcquireAudioPacket(packet);
+        if (!ReadAudio(packet.payload, 16000, 30 * 16000 / 1000)) {
             return;
         }
-        AudioStreamPacket packet;
-        packet.payload = std::move(opus);
-#ifdef CONFIG_USE_SERVER_AEC
-        {
-            std::lock_guard<std::mutex> lock(timestamp_mutex_);
-            if (!timestamp_queue_.empty()) {
-                packet.timestamp = timestamp_queue_.front();
-                timestamp_queue_.pop_front();
-            } else {
-                packet.timestamp = 0;
-            }
-
-            if (timestamp_queue_.size() > 3) { // 限制队列长度3
-                timestamp_queue_.pop_front(); // 该包发送前先出队保持队列长度
-                return;
-            }
+        if (!StampOutgoingPacket(packet)) {
+            return;
         }
-#endif
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (audio_send_queue_.size() >= MAX_AUDIO_PACKETS_IN_QUEUE) {
+        if (audio_send_queue_.full()) {
             ESP_LOGW(TAG, "Too many audio packets in queue, drop the oldest packet");
-            audio_send_queue_.pop_front();
         }
-        audio_send_queue_.emplace_back(std::move(packet));
+        audio_send_queue_.Push(std::move(packet));
         xEventGroupSetBits(event_group_, SEND_AUDIO_EVENT);
 #else
-        std::vector<int16_t> data;
+        AudioFrame frame;
         int samples = audio_processor_->GetFeedSize();
         if (samples > 0) {
-            if (ReadAudio(data, 16000, samples)) {
-                audio_processor_->Feed(data);
+            if (ReadAudio(frame, 16000, samples)) {
+                audio_processor_->Feed(std::move(frame));
                 return;
             }
         }
@@ -948,48 +1112,40 @@ void Application::OnAudioInput() {
 
 }
 
-bool Application::ReadAudio(std::vector<int16_t>& data, int sample_rate, int samples) {
+// 麦克风输入的采集源：音频编解码芯片加上两个声道各自的重采样器
+class CodecCaptureSource : public AudioCaptureSource {
+public:
+    CodecCaptureSource(AudioCodec* codec, OpusResampler& mic, OpusResampler& reference)
+        : codec_(codec), mic_(mic), reference_(reference) {}
+
+    int input_sample_rate() override { return codec_->input_sample_rate(); }
+    int input_channels() override { return codec_->input_channels(); }
+    bool Read(int16_t* data, size_t samples) override { return codec_->InputData(data, samples); }
+    int ResampledSamples(size_t samples) override { return mic_.GetOutputSamples(samples); }
+    void Resample(int channel, const int16_t* input, size_t samples, int16_t* output) override {
+        (channel == 0 ? mic_ : reference_).Process(input, samples, output);
+    }
+
+private:
+    AudioCodec* codec_;
+    OpusResampler& mic_;
+    OpusResampler& reference_;
+};
+
+// 读取samples个sample_rate采样率的样本到frame，池的使用见CaptureAudioFrame，主机上的分配测试调用的是同一个函数
+bool Application::ReadAudio(AudioFrame& frame, int sample_rate, int samples) {
     auto codec = Board::GetInstance().GetAudioCodec();
-    if (!codec->input_enabled()) {
+    if (!codec->input_enabled() || !audio_frames_) {
         return false;
     }
-
-    if (codec->input_sample_rate() != sample_rate) {
-        data.resize(samples * codec->input_sample_rate() / sample_rate);
-        if (!codec->InputData(data)) {
-            return false;
-        }
-        if (codec->input_channels() == 2) {
-            auto mic_channel = std::vector<int16_t>(data.size() / 2);
-            auto reference_channel = std::vector<int16_t>(data.size() / 2);
-            for (size_t i = 0, j = 0; i < mic_channel.size(); ++i, j += 2) {
-                mic_channel[i] = data[j];
-                reference_channel[i] = data[j + 1];
-            }
-            auto resampled_mic = std::vector<int16_t>(input_resampler_.GetOutputSamples(mic_channel.size()));
-            auto resampled_reference = std::vector<int16_t>(reference_resampler_.GetOutputSamples(reference_channel.size()));
-            input_resampler_.Process(mic_channel.data(), mic_channel.size(), resampled_mic.data());
-            reference_resampler_.Process(reference_channel.data(), reference_channel.size(), resampled_reference.data());
-            data.resize(resampled_mic.size() + resampled_reference.size());
-            for (size_t i = 0, j = 0; i < resampled_mic.size(); ++i, j += 2) {
-                data[j] = resampled_mic[i];
-                data[j + 1] = resampled_reference[i];
-            }
-        } else {
-            auto resampled = std::vector<int16_t>(input_resampler_.GetOutputSamples(data.size()));
-            input_resampler_.Process(data.data(), data.size(), resampled.data());
-            data = std::move(resampled);
-        }
-    } else {
-        data.resize(samples);
-        if (!codec->InputData(data)) {
-            return false;
-        }
+    CodecCaptureSource source(codec, input_resampler_, reference_resampler_);
+    if (!CaptureAudioFrame(*audio_frames_, source, sample_rate, samples, frame)) {
+        return false;
     }
     
     // 音频调试：发送原始音频数据
     if (audio_debugger_) {
-        audio_debugger_->Feed(data);
+        audio_debugger_->Feed(frame);
     }
     
     return true;
@@ -1011,16 +1167,34 @@ bool Application::ReadAudio(std::vector<uint8_t>& opus, int sample_rate, int sam
 }
 #endif
 
-void Application::WriteAudio(std::vector<int16_t>& data, int sample_rate) {
+void Application::WriteAudio(const std::vector<int16_t>& data, int sample_rate) {
     auto codec = Board::GetInstance().GetAudioCodec();
     // Resample if the sample rate is different
     if (sample_rate != codec->output_sample_rate()) {
-        int target_size = output_resampler_.GetOutputSamples(data.size());
-        std::vector<int16_t> resampled(target_size);
-        output_resampler_.Process(data.data(), data.size(), resampled.data());
-        data = std::move(resampled);
+        output_resampled_.resize(output_resampler_.GetOutputSamples(data.size()));
+        output_resampler_.Process(data.data(), data.size(), output_resampled_.data());
+        WritePlayback(output_resampled_.data(), output_resampled_.size());
+        return;
+    }
+    WritePlayback(data.data(), data.size());
+}
+
+// 解码任务：写入输出环，满时等音频任务写入I2S腾出空间；清空队列后剩下的部分直接丢弃
+void Application::WritePlayback(const int16_t* data, size_t samples) {
+    bool stalled = false;
+    while (!audio_decode_stop_ && !audio_jitter_reset_) {
+        size_t written = output_pcm_->Write(data, samples);
+        data += written;
+        samples -= written;
+        if (samples == 0) {
+            return;
+        }
+        if (!stalled) {
+            stalled = true;
+            decode_stalls_++;
+        }
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(AUDIO_DECODE_POLL_MS));
     }
-    codec->OutputData(data);
 }
 
 #ifdef CONFIG_USE_AUDIO_CODEC_DECODE_OPUS
@@ -1052,6 +1226,8 @@ void Application::SetDeviceState(DeviceState state) {
     ESP_LOGI(TAG, "STATE: %s", STATE_STRINGS[device_state_]);
     // The state is changed, wait for all background tasks to finish
     background_task_->WaitForCompletion();
+    first_packet_pending_ = false;
+    first_audio_pending_ = false;
 
     auto& board = Board::GetInstance();
     auto display = board.GetDisplay();
@@ -1084,8 +1260,7 @@ void Application::SetDeviceState(DeviceState state) {
                 // Send the start listening command
                 protocol_->SendStartListening(listening_mode_);
                 if (previous_state == kDeviceStateSpeaking) {
-                    audio_decode_queue_.clear();
-                    audio_decode_cv_.notify_all();
+                    ClearDecodeQueue();
                     // FIXME: Wait for the speaker to empty the buffer
                     vTaskDelay(pdMS_TO_TICKS(120));
                 }
@@ -1110,6 +1285,9 @@ void Application::SetDeviceState(DeviceState state) {
 #endif
             }
             ResetDecoder();
+            speaking_start_us_ = esp_timer_get_time();
+            first_packet_pending_ = true;
+            first_audio_pending_ = true;
             break;
         default:
             // Do nothing
@@ -1117,14 +1295,135 @@ void Application::SetDeviceState(DeviceState state) {
     }
 }
 
+// 后台任务：逐帧取出AFE的输出放进编码器的输入环，凑满一帧就编码；落后时一次唤醒编码多帧
+void Application::EncodeAudioFrames() {
+    uint32_t batch = 0;
+    AudioFrame frame;
+    while (true) {
+        while (encode_frames_.Pop(frame)) {
+            const int16_t* data = frame.data();
+            size_t samples = frame.size();
+            while (samples > 0) {
+                size_t accepted = opus_encoder_->Append(data, samples);
+                data += accepted;
+                samples -= accepted;
+                int encoded = EncodeBufferedAudio();
+                batch += encoded;
+                if (accepted == 0 && encoded == 0) {
+                    break;  // 编码器没有创建成功，丢弃这一帧
+                }
+            }
+            frame.Release();
+        }
+        if (!encode_frames_.Finish()) {
+            break;
+        }
+    }
+    if (batch > encode_max_batch_) {
+        encode_max_batch_ = batch;
+    }
+}
+
+// 编码输入环中所有完整的帧，直接写进从包池取出的包，返回编码的帧数
+int Application::EncodeBufferedAudio() {
+    int frames = 0;
+    bool queued = false;
+    while (opus_encoder_->HasFrame()) {
+        AudioStreamPacket packet;
+        AcquireAudioPacket(packet);
+        packet.payload.resize(MAX_OPUS_PACKET_SIZE);
+
+        int64_t start_time = esp_timer_get_time();
+        int size = opus_encoder_->EncodeFrame(packet.payload.data(), packet.payload.size());
+        uint32_t elapsed = esp_timer_get_time() - start_time;
+        encode_count_++;
+        encode_time_us_ += elapsed;
+        if (elapsed > encode_max_us_) {
+            encode_max_us_ = elapsed;
+        }
+        frames++;
+        if (size <= 0) {
+            continue;
+        }
+        packet.payload.resize(size);
+
+        if (!StampOutgoingPacket(packet)) {
+            continue;
+        }
+        if (audio_send_queue_.full()) {
+            ESP_LOGW(TAG, "Too many audio packets in queue, drop the oldest packet");
+        }
+        audio_send_queue_.Push(std::move(packet));
+        queued = true;
+    }
+    if (queued) {
+        xEventGroupSetBits(event_group_, SEND_AUDIO_EVENT);
+    }
+    return frames;
+}
+
+// 从包池取一个发送用的包，池为空时返回新的包；只在编码所在的任务中调用
+void Application::AcquireAudioPacket(AudioStreamPacket& packet) {
+    if (!audio_packet_pool_.Pop(packet)) {
+        packet = AudioStreamPacket();
+        packet_pool_misses_++;
+        return;
+    }
+    packet.timestamp = 0;
+    packet.sequence = 0;
+}
+
+// 服务器AEC时给上行包带上播放时的时间戳，时间戳积压时丢弃这个包，返回false
+bool Application::StampOutgoingPacket(AudioStreamPacket& packet) {
+#ifdef CONFIG_USE_SERVER_AEC
+    std::lock_guard<std::mutex> lock(timestamp_mutex_);
+    if (!timestamp_queue_.empty()) {
+        packet.timestamp = timestamp_queue_.front();
+        timestamp_queue_.pop_front();
+    } else {
+        packet.timestamp = 0;
+    }
+
+    if (timestamp_queue_.size() > 3) { // 限制队列长度3
+        timestamp_queue_.pop_front(); // 该包发送前先出队保持队列长度
+        return false;
+    }
+#endif
+    return true;
+}
+
+void Application::PrintEncoderStats() {
+#ifndef CONFIG_USE_AUDIO_CODEC_ENCODE_OPUS
+    uint32_t count = encode_count_.exchange(0);
+    uint32_t time_us = encode_time_us_.exchange(0);
+    uint32_t max_us = encode_max_us_.exchange(0);
+    uint32_t max_batch = encode_max_batch_.exchange(0);
+    uint32_t misses = packet_pool_misses_.exchange(0);
+    if (count == 0) {
+        return;
+    }
+    ESP_LOGI(TAG, "Opus encoder: %lu frames, %lu us avg, %lu us max per %d ms frame, complexity %d, max %lu frames per wakeup, packet pool misses %lu",
+        (unsigned long)count, (unsigned long)(time_us / count), (unsigned long)max_us, OPUS_FRAME_DURATION_MS,
+        opus_encoder_->complexity(), (unsigned long)max_batch, (unsigned long)misses);
+#endif
+}
+
+void Application::PrintAudioQueueStats() {
+    auto send = audio_send_queue_.stats();
+    auto decode = audio_decode_queue_.stats();
+    ESP_LOGI(TAG, "Audio queues: send %u/%u (peak %u, dropped oldest %lu), decode %u/%u (peak %u, dropped newest %lu)",
+        (unsigned)send.size, (unsigned)send.capacity, (unsigned)send.high_water, (unsigned long)send.dropped_oldest,
+        (unsigned)decode.size, (unsigned)decode.capacity, (unsigned)decode.high_water, (unsigned long)decode.dropped_newest);
+    ESP_LOGI(TAG, "Playback: output underruns %lu, decoder stalls %lu, last time to first audio %d ms",
+        (unsigned long)output_underruns_.load(), (unsigned long)decode_stalls_.load(), first_audio_ms_.load());
+}
+
 void Application::ResetDecoder() {
-    std::lock_guard<std::mutex> lock(mutex_);
 #ifdef CONFIG_USE_AUDIO_CODEC_DECODE_OPUS
 #else
     opus_decoder_->ResetState();
 #endif
-    audio_decode_queue_.clear();
-    audio_decode_cv_.notify_all();
+    ClearDecodeQueue();
     last_output_time_ = std::chrono::steady_clock::now();
     auto codec = Board::GetInstance().GetAudioCodec();
     codec->EnableOutput(true);
@@ -1239,13 +1538,18 @@ void Application::SetAecMode(AecMode mode) {
 #if defined(CONFIG_VB6824_OTA_SUPPORT) && CONFIG_VB6824_OTA_SUPPORT == 1
 void Application::ReleaseDecoder() {
     ESP_LOGW(TAG, "Release decoder");
-    while (!audio_decode_queue_.empty())
+    while (!IsDecodeQueueEmpty())
     {  
         vTaskDelay(pdMS_TO_TICKS(200));
     }
     std::lock_guard<std::mutex> lock(mutex_);
     vTaskDelete(audio_loop_task_handle_);
     audio_loop_task_handle_ = nullptr;
+    // 解码任务可能正持有解码器的锁，让它自己退出后再释放解码器
+    audio_decode_stop_ = true;
+    while (audio_decode_task_handle_ != nullptr) {
+        vTaskDelay(pdMS_TO_TICKS(AUDIO_DECODE_POLL_MS));
+    }
     background_task_->WaitForCompletion();
     background_task_->WaitForCompletion();
     delete background_task_;
@@ -1340,84 +1644,241 @@ void Application::ShowOtaInfo(const std::string& code,const std::string& ip) {
         return esp_random() % max;
     }
 
+    // 魔眼的查找表和解码后的数据优先放PSRAM，放不下再用内部RAM
+    static void* EyeAlloc(size_t size) {
+        void* p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        return p != nullptr ? p : heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    }
+
+    #define EYE_INTERNAL_RESERVE (64 * 1024)   //虹膜放进内部RAM后至少还要留下的空闲内存，留给WiFi和音频
+
+    static const char* EyeTierName(EyeTier tier) {
+        switch (tier) {
+            case kEyeTierInternal: return "internal";
+            case kEyeTierPsram: return "psram";
+            default: return "flash";
+        }
+    }
+
+    // 异步提交一批合成好的扫描行，SPI传输在后台进行
+    // 双目时每只眼睛只送到自己的屏幕，单目时同一画面镜像到所有屏幕
+    void Application::submitEyeBatch(uint8_t e, uint16_t screenY, uint8_t lines, uint8_t bufIdx) {
+        const EyeAssets& assets = *eye_assets_;
+        auto display = Board::GetInstance().GetDisplay();
+        if (NUM_EYES > 1) {
+            display->SetEyePanelAsync(e, 0, screenY, assets.screen_width, screenY + lines, eye_line_buf_[e][bufIdx], &eye_line_token_[e][bufIdx]);
+        } else {
+            display->SetEyeAsync(0, screenY, assets.screen_width, screenY + lines, eye_line_buf_[e][bufIdx], &eye_line_token_[e][bufIdx]);
+        }
+    }
+
         /* 对眼睛进行绘制 */
     void Application::drawEye(uint8_t e, uint32_t iScale, uint32_t scleraX, uint32_t scleraY, uint32_t uT, uint32_t lT) {
+        // 合成结果交给常驻的DMA行缓冲环，提交后继续合成下一批
+        struct LcdSink : public EyePanelSink {
+            Application& app;
+            int core;
+            uint8_t bufIdx = 0;
+            int64_t composeStart = 0;
+            LcdSink(Application& app, int core) : app(app), core(core) {}
+
+            uint16_t* AcquireBatch(uint8_t e, uint16_t screenY, uint8_t lines) override {
+                // 从常驻行缓冲环中取下一个缓冲区，索引跨帧延续，
+                // 这样新一帧的第一批不会覆盖上一帧最后一批仍在SPI上传输的数据
+                bufIdx = app.eye_line_buf_idx_[e];
+                if (++app.eye_line_buf_idx_[e] >= EYE_LINE_BUF_COUNT) {
+                    app.eye_line_buf_idx_[e] = 0;
+                }
+                // 只有当该缓冲区仍被DMA占用时才阻塞；超时说明DMA仍在读它，跳过这一批，下一帧整屏重绘
+                EYE_PROFILE_BEGIN(wait_start);
+                bool flushed = Board::GetInstance().GetDisplay()->WaitEyeFlush(app.eye_line_token_[e][bufIdx]);
+                EYE_PROFILE_END(app.eye_prof_wait_[core], wait_start);
+                if (!flushed) {
+                    app.eye_invalidate_.store(true);
+                    return nullptr;
+                }
+#if CONFIG_EYE_RENDER_PROFILE
+                composeStart = esp_timer_get_time();
+#endif
+                return app.eye_line_buf_[e][bufIdx];
+            }
 
-        // uint32_t start_time = esp_timer_get_time();
-        // ESP_LOGI(TAG, "drawEye start");
-
-        uint8_t screenX;
-        uint16_t p;
-        uint32_t d;
-        int16_t irisX, irisY;
-
-        // 缓存scleraX的初始值
-        uint32_t scleraXsave = scleraX;
-        // 计算irisY的初始位置
-        irisY = scleraY - (SCLERA_HEIGHT - IRIS_HEIGHT) / 2;
-
-        // 定义一次处理的行数
-
-        // 动态申请双缓冲的lineBuf，每个缓冲区为10行的大小
-        uint16_t* lineBuf[2];
-        lineBuf[0] = (uint16_t*)malloc(LINES_PER_BATCH * SCREEN_WIDTH * sizeof(uint16_t));
-        lineBuf[1] = (uint16_t*)malloc(LINES_PER_BATCH * SCREEN_WIDTH * sizeof(uint16_t));
-        if (lineBuf[0] == NULL || lineBuf[1] == NULL) {
-            // 如果内存分配失败，释放已分配的缓冲区并返回
-            if (lineBuf[0]) free(lineBuf[0]);
-            if (lineBuf[1]) free(lineBuf[1]);
-            return;
+            void SubmitBatch(uint8_t e, uint16_t screenY, uint8_t lines, uint16_t* buf) override {
+                EYE_PROFILE_END(app.eye_prof_compose_[core], composeStart);
+                app.submitEyeBatch(e, screenY, lines, bufIdx);
+            }
+        };
+
+        const EyeRenderParams params = { iScale, scleraX, scleraY, uT, lT };
+        LcdSink sink(*this, xPortGetCoreID());
+        const EyeFade fade = { &eye_fade_tables_[e], eye_fade_scratch_[sink.core], eye_fade_weight_ };
+        // 只合成本帧有变化的批次
+        EyeRenderBatches(*eye_assets_, eye_tables_[e], params, e, eye_damage_[e], LINES_PER_BATCH, sink,
+            eye_fade_weight_ < EYE_FADE_ONE ? &fade : nullptr);
+    }
+
+    /*
+        双核分块渲染：两个渲染任务从同一个原子索引领取eye_tile_list_中的(眼睛, 批次)任务，
+        列表按批次交错排列两只眼睛，以平衡两块屏幕的SPI负载。
+        某只眼睛本帧第seq个需要重绘的批次固定使用行缓冲环中的第(帧起始索引 + seq) % EYE_LINE_BUF_COUNT个缓冲区，
+        合成可以乱序完成，但提交必须按seq顺序进行，所以画面和单任务渲染逐字节一致。
+        同时最多只有两个任务在处理中，环深度不小于3时缓冲区的上一次使用者一定已经提交。
+        */
+    static_assert(EYE_LINE_BUF_COUNT >= 3, "tiled eye renderer needs at least 3 line buffers per eye");
+
+    // 阻塞到第e只眼睛前seq个批次都已提交；前面的批次总是在另一个渲染任务手里，它提交后置位唤醒这里。
+    // 不能用taskYIELD空转：另一个核上的任务被高优先级任务抢占时，这里会一直占着本核，饿死低优先级的后台任务
+    void Application::WaitEyeTileSubmit(uint8_t e, int seq) {
+        while ((int)eye_tile_submit_[e].load(std::memory_order_acquire) < seq) {
+            // 退出时清位；位上可能留有不相干的提交，醒来后重新检查
+            xEventGroupWaitBits(eye_tile_events_, 1 << e, pdTRUE, pdFALSE, pdMS_TO_TICKS(10));
         }
+    }
+    void Application::RunEyeTiles(int worker) {
+        const EyeAssets& assets = *eye_assets_;
+        auto display = Board::GetInstance().GetDisplay();
+        EyeFade fade = { nullptr, eye_fade_scratch_[worker], eye_fade_weight_ };
+        uint32_t job;
+        while ((job = eye_tile_next_.fetch_add(1, std::memory_order_relaxed)) < eye_tile_count_) {
+            uint32_t tile = eye_tile_list_[job];
+            uint8_t e = tile & 0xFF;
+            uint16_t batch = (tile >> 8) & 0xFF;
+            uint16_t seq = tile >> 16;
+            uint16_t screenY = batch * LINES_PER_BATCH;
+            uint8_t lines = (assets.screen_height - screenY) < LINES_PER_BATCH ? (assets.screen_height - screenY) : LINES_PER_BATCH;
+            uint8_t bufIdx = (eye_line_buf_idx_[e] + seq) % EYE_LINE_BUF_COUNT;
+
+            // 等缓冲区的上一个使用者提交完成（通常已经满足），再等它的DMA传输结束
+            WaitEyeTileSubmit(e, seq + 1 - EYE_LINE_BUF_COUNT);
+            EYE_PROFILE_BEGIN(wait_start);
+            bool flushed = display->WaitEyeFlush(eye_line_token_[e][bufIdx]);
+            EYE_PROFILE_END(eye_prof_wait_[worker], wait_start);
+            if (flushed) {
+                EYE_PROFILE_BEGIN(compose_start);
+                fade.from = &eye_fade_tables_[e];
+                EyeComposeFaded(assets, eye_tables_[e], eye_render_params_[e], screenY, lines, eye_line_buf_[e][bufIdx],
+                    eye_fade_weight_ < EYE_FADE_ONE ? &fade : nullptr);
+                EYE_PROFILE_END(eye_prof_compose_[worker], compose_start);
+            } else {
+                // 超时说明DMA仍在读这个缓冲区，不能写入；跳过这一批，下一帧整屏重绘
+                eye_invalidate_.store(true);
+            }
 
-        uint8_t bufIdx = 0;
-        // 外循环，遍历屏幕的每一批行
-        for (uint16_t screenY = 0; screenY < SCREEN_HEIGHT; screenY += LINES_PER_BATCH) {
-            // 切换缓冲区
-            uint16_t* currentBuf = lineBuf[bufIdx];
-            bufIdx ^= 1;  // 切换缓冲区索引
-            // 计算本次批处理的实际行数（处理到屏幕底部时可能不足10行）
-            uint8_t linesToProcess = (SCREEN_HEIGHT - screenY) < LINES_PER_BATCH ? (SCREEN_HEIGHT - screenY) : LINES_PER_BATCH;
-
-            // 内循环，遍历批处理的每一行
-            for (uint8_t line = 0; line < linesToProcess; line++, scleraY++, irisY++) {
-                // 重置scleraX到初始值
-                scleraX = scleraXsave;
-                irisX = scleraX - (SCLERA_WIDTH - IRIS_WIDTH) / 2;
-                // 遍历屏幕的每一列
-                for (screenX = 0; screenX < SCREEN_WIDTH; screenX++, scleraX++, irisX++) {
-                    uint32_t screenIdx = (screenY + line) * SCREEN_WIDTH + screenX;
-                    uint32_t pixelIdx = line * SCREEN_WIDTH + screenX;
-
-                    // 判断像素点是否被遮挡
-                    if ((lower[screenIdx] <= lT) || (upper[screenIdx] <= uT)) {
-                        p = 0;  // 被眼睑遮挡
-                    } else if ((irisY < 0) || (irisY >= IRIS_HEIGHT) || (irisX < 0) || (irisX >= IRIS_WIDTH)) {
-                        p = sclera[scleraY * SCLERA_WIDTH + scleraX];  // 在巩膜中
-                    } else {
-                        p = polar[irisY * IRIS_WIDTH + irisX];         // 极角/距离
-                        d = (iScale * (p & 0x7F)) / 240;
-                        if (d < IRIS_MAP_HEIGHT) {
-                            uint16_t a = (IRIS_MAP_WIDTH * (p >> 7)) / 512;
-                            p = iris[d * IRIS_MAP_WIDTH + a];
-                        } else {
-                            p = sclera[scleraY * SCLERA_WIDTH + scleraX];
-                        }
-                    }
-                    // 将像素数据写入当前缓冲区
-                    currentBuf[pixelIdx] = (p >> 8) | (p << 8);
+            // 确定性合并：轮到本批次时才提交，另一个核最多只会让这里等待一个批次的合成时间；
+            // 跳过的批次也要推进提交序号，否则后面的批次会一直等下去
+            WaitEyeTileSubmit(e, seq);
+            if (flushed) {
+                submitEyeBatch(e, screenY, lines, bufIdx);
+            }
+            eye_tile_submit_[e].store(seq + 1, std::memory_order_release);
+            xEventGroupSetBits(eye_tile_events_, 1 << e);
+            eye_tile_jobs_[worker]++;
+        }
+    }
+
+    // 按屏幕尺寸选择编译进固件的魔眼数据，同一固件可同时支持160x160和240x240
+    bool Application::SelectEyeAssets(int screen_size) {
+        const EyeAssets* assets = nullptr;
+#if CONFIG_EYE_ASSET_PACK
+        if (LoadEyeAssetPack(screen_size)) {
+            assets = &eye_pack_assets_;
+        }
+#endif
+        if (assets == nullptr) {
+            assets = FindEyeAssets(screen_size);
+        }
+        if (assets == nullptr) {
+            ESP_LOGE(TAG, "No eye assets for %dx%d, enable CONFIG_EYE_ASSETS_%d", screen_size, screen_size, screen_size);
+            return false;
+        }
+        eye_assets_ = assets;
+        eye_batch_count_ = (assets->screen_height + LINES_PER_BATCH - 1) / LINES_PER_BATCH;
+        eye_invalidate_.store(true);
+        return true;
+    }
+
+#if CONFIG_EYE_ASSET_PACK
+    // 从eye_assets分区mmap魔眼资源包，只在第一次调用时映射；尺寸和屏幕不符时返回false
+    bool Application::LoadEyeAssetPack(int screen_size) {
+        if (eye_pack_.header == nullptr) {
+            const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "eye_assets");
+            if (partition == nullptr) {
+                ESP_LOGW(TAG, "No eye_assets partition");
+                return false;
+            }
+            const void* data = nullptr;
+            esp_err_t err = esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &data, &eye_pack_mmap_);
+            if (err != ESP_OK) {
+                ESP_LOGE(TAG, "Failed to mmap eye_assets partition: %s", esp_err_to_name(err));
+                return false;
+            }
+            EyePack pack;
+            if (!EyePackOpen(data, partition->size, &pack)) {
+                ESP_LOGE(TAG, "Invalid eye asset pack, run scripts/gen_eye_pack.py and flash the eye_assets partition");
+                esp_partition_munmap(eye_pack_mmap_);
+                return false;
+            }
+            EyeAssets assets = {};
+            EyePackTables tables = {};
+            switch (EyePackLoadAssets(pack, EyeAlloc, heap_caps_free, &assets, &tables)) {
+                case kEyePackLoadOk:
+                    break;
+                case kEyePackLoadNoCompose:
+                    ESP_LOGE(TAG, "No eye compose kernel for %ux%u asset pack", pack.header->screen_width, pack.header->screen_height);
+                    esp_partition_munmap(eye_pack_mmap_);
+                    return false;
+                default:
+                    ESP_LOGE(TAG, "Failed to allocate eye lid maps and spans for the asset pack");
+                    esp_partition_munmap(eye_pack_mmap_);
+                    return false;
+            }
+            eye_pack_assets_ = assets;
+            eye_pack_ = pack;
+            eye_pack_iris_.assign(pack.header->style_count, nullptr);
+            ESP_LOGI(TAG, "Eye asset pack: %ux%u, %u styles, %lu bytes%s", assets.screen_width, assets.screen_height,
+                pack.header->style_count, pack.header->size,
+                EyePackCompressed(pack) ? ", compressed" : (EyePackPalette(pack) ? ", palette" : ""));
+        }
+        return eye_pack_assets_.screen_width == screen_size;
+    }
+
+    // 返回资源包中某个样式可直接合成的虹膜贴图，压缩的虹膜第一次使用时解码，多个样式共用同一份数据
+    const uint16_t* Application::GetEyePackIris(int style) {
+        if (!EyePackCompressed(eye_pack_)) {
+            return EyePackIris(eye_pack_, style);
+        }
+        if (eye_pack_iris_[style] == nullptr) {
+            for (int i = 0; i < style; i++) {
+                if (eye_pack_.styles[i].iris == eye_pack_.styles[style].iris && eye_pack_iris_[i] != nullptr) {
+                    eye_pack_iris_[style] = eye_pack_iris_[i];
+                    return eye_pack_iris_[style];
                 }
             }
-            // 批量绘制当前处理的行
-            auto& board = Board::GetInstance();
-            auto display = board.GetDisplay();
-            display->SetEye(0, screenY, SCREEN_WIDTH, screenY + linesToProcess, currentBuf);
+            const EyeAssets& assets = eye_pack_assets_;
+            uint16_t* pixels = (uint16_t*)EyeAlloc(assets.iris_map_width * assets.iris_map_height * sizeof(uint16_t));
+            if (pixels == nullptr) {
+                ESP_LOGE(TAG, "Failed to allocate decoded iris for eye style %d", style + 1);
+                return nullptr;
+            }
+            EyeCodecDecode((const uint8_t*)EyePackIris(eye_pack_, style), assets.iris_map_width, assets.iris_map_height, pixels);
+            eye_pack_iris_[style] = pixels;
         }
+        return eye_pack_iris_[style];
+    }
+#endif
 
-        // 释放动态分配的缓冲区
-        free(lineBuf[0]);
-        free(lineBuf[1]);
-        // uint32_t end_time = esp_timer_get_time();
-        // ESP_LOGI(TAG, "drawEye end, time: %lu us", end_time - start_time);
+    // 计算一只眼睛本帧需要重绘的批次位掩码，贴图变化时整屏重绘
+    static_assert(EYE_MAX_BATCH_COUNT <= EYE_MAX_DAMAGE_BATCHES, "eye damage mask holds at most 32 batches");
+    uint32_t Application::ComputeEyeDamage(uint8_t e, bool full) {
+        const EyeRenderParams &cur = eye_render_params_[e];
+        EyeRenderParams &prev = eye_prev_params_[e];
+        full = full || eye_tables_[e].sclera != eye_prev_sclera_[e] || eye_tables_[e].iris != eye_prev_iris_[e];
+        uint32_t damage = ::ComputeEyeDamage(*eye_assets_, eye_lid_ranges_, LINES_PER_BATCH, cur, prev, full);
+
+        prev = cur;
+        eye_prev_sclera_[e] = eye_tables_[e].sclera;
+        eye_prev_iris_[e] = eye_tables_[e].iris;
+        return damage;
     }
 
     /*
@@ -1428,21 +1889,36 @@ void Application::ShowOtaInfo(const std::string& code,const std::string& ip) {
         */
     void Application::frame(uint16_t iScale)
     {
-        // uint32_t start_time = esp_timer_get_time();
-        // ESP_LOGI(TAG, "frame start");
-        static uint8_t eyeIndex = 0; // eye[] array counter //眼睛数组的索引
+        EYE_PROFILE_BEGIN(frame_start);
+        const EyeAssets& assets = *eye_assets_;
         int16_t eyeX, eyeY; //眼睛的位置
-        uint32_t t = esp_timer_get_time(); // Time at start of function
-        if (++eyeIndex >= NUM_EYES) //如果当前眼睛的索引已经到最后，回到第一个眼睛
-        {
-            eyeIndex = 0; // Cycle through eyes, 1 per call
-        }
+        uint64_t now = esp_timer_get_time();
+        uint32_t t = now; // Time at start of function
             // X/Y movement
         static bool eyeInMotion = false;
         static int16_t eyeOldX = 512, eyeOldY = 512;
         static uint32_t eyeMoveStartTime = 0L;
         static int32_t eyeMoveDuration = 0L;
 
+        // 其他任务发布的参数在帧开始时一次取走；直接指定的注视点优先于正在播放的表情动画
+        EyeCommand command = eye_mailbox_.Take();
+        if (command.changed & EYE_COMMAND_GAZE) {
+            eyeNewX = command.x;
+            eyeNewY = command.y;
+            eye_timeline_.done = true;
+        }
+        if (command.changed & EYE_COMMAND_BLINK) {
+            is_blink = command.blink;
+        }
+        if (command.changed & EYE_COMMAND_TRACK) {
+            is_track = command.track;
+        }
+        if (command.changed & EYE_COMMAND_SCLERA) {
+            eye_styles_.RequestSclera(command.sclera, CONFIG_EYE_STYLE_FADE_FRAMES);
+        }
+        // 样式在帧边界切换：先换上上一帧预取好的样式，再预取新的请求，留到下一帧换上
+        UpdateEyeStyle();
+
         int32_t dt = t - eyeMoveStartTime; // uS elapsed since last eye event
 
         if (eyeInMotion)
@@ -1489,6 +1965,32 @@ void Application::ShowOtaInfo(const std::string& code,const std::string& ip) {
             }
         }
 
+        // 表情关键帧：切换请求在这一帧生效，第一段从当前姿态过渡。播放中由关键帧接管注视点，
+        // 播完后停在最后一帧的位置交回上面的自动运动；眼睑下限和瞳孔缩放保持到下一个表情
+        uint8_t emotionRequest = eye_emotion_request_.exchange(0);
+        if (emotionRequest) {
+            const EyeEmotion& emotion = eye_emotions_.emotions[emotionRequest - 1];
+            eye_timeline_.pose.x = eyeX;
+            eye_timeline_.pose.y = eyeY;
+            EyeTimelineStart(&eye_timeline_, emotionRequest - 1, now);
+            is_blink = emotion.flags & EYE_EMOTION_BLINK;
+            is_track = emotion.flags & EYE_EMOTION_TRACK;
+            SetEyeTint(emotion.tint, emotion.tint_strength);
+        }
+        bool emotionPlaying = eye_timeline_.emotion != nullptr && !eye_timeline_.done;
+        uint8_t emotionEvents = EyeTimelineAdvance(&eye_timeline_, now, iScale);
+        const EyePose& pose = eye_timeline_.pose;
+        if (emotionPlaying) {
+            eyeX = eyeOldX = eyeNewX = pose.x;
+            eyeY = eyeOldY = eyeNewY = pose.y;
+            eyeInMotion = false;
+            eyeMoveStartTime = t;
+            eyeMoveDuration = random_max(100000);
+        }
+        if (pose.iris) {
+            iScale = pose.iris;
+        }
+
         // Blinking
         if(is_blink){
             // Similar to the autonomous eye movement above -- blink start times
@@ -1512,192 +2014,804 @@ void Application::ShowOtaInfo(const std::string& code,const std::string& ip) {
             }
         }
 
-        if (eye[eyeIndex].blink.state)
-        { // Eye currently blinking?
-            // Check if current blink state time has elapsed
-            if ((t - eye[eyeIndex].blink.startTime) >= eye[eyeIndex].blink.duration)
+        // 单眼眨眼请求：只让指定的眼睛进入眨眼，另一只保持睁开
+        uint8_t winkMask = eye_wink_request_.exchange(0);
+        if (emotionEvents & EYE_EVENT_BLINK) {
+            winkMask |= (1 << NUM_EYES) - 1;
+        }
+        if (emotionEvents & EYE_EVENT_WINK) {
+            winkMask |= 1 << (NUM_EYES - 1);
+        }
+        if (winkMask) {
+            uint32_t winkDuration = random_range(36000, 72000);
+            for (uint8_t e = 0; e < NUM_EYES; e++)
             {
-                // Yes -- increment blink state, unless...
-        
-                if (++eye[eyeIndex].blink.state > DEBLINK)
-                {                                        // Deblinking finished?
-                    eye[eyeIndex].blink.state = NOBLINK; // No longer blinking
-                }
-                else
-                {                                      // Advancing from ENBLINK to DEBLINK mode
-                    eye[eyeIndex].blink.duration *= 2; // DEBLINK is 1/2 ENBLINK speed
-                    eye[eyeIndex].blink.startTime = t;
+                if ((winkMask & (1 << e)) && eye[e].blink.state == NOBLINK)
+                {
+                    eye[e].blink.state = ENBLINK;
+                    eye[e].blink.startTime = t;
+                    eye[e].blink.duration = winkDuration;
                 }
             }
         }
-    
+
         //将动作、眨眼和虹膜大小处理成可渲染的值
         // Process motion, blinking and iris scale into renderable values   
         //运行 `python tablegen.py terminatorEye/sclera.png terminatorEye/iris.png terminatorEye/lid-upper-symmetrical.png terminatorEye/lid-lower-symmetrical.png terminatorEye/lid-upper.png terminatorEye/lid-lower.png` 并将输出重定向到 `terminatorEye.h` 文件。
         // python tablegen.py terminatorEye/sclera.png terminatorEye/iris.png terminatorEye/lid-upper-symmetrical.png terminatorEye/lid-lower-symmetrical.png terminatorEye/lid-upper.png terminatorEye/lid-lower.png > terminatorEye.h
         // Scale eye X/Y positions (0-1023) to pixel units used by drawEye()    //像素单位转换
-        eyeX = linear_map(eyeX, 0, 1023, 0, SCLERA_WIDTH  - DISPLAY_SIZE);
-        eyeY = linear_map(eyeY, 0, 1023, 0, SCLERA_HEIGHT - DISPLAY_SIZE);
+        eyeX = linear_map(eyeX, 0, 1023, 0, assets.sclera_width  - assets.screen_width);
+        eyeY = linear_map(eyeY, 0, 1023, 0, assets.sclera_height - assets.screen_height);
+        PlaceEyeTextures(linear_map(eyeNewY, 0, 1023, 0, assets.sclera_height - assets.screen_height));
+        UpdateEyePalettes();
         // python tablegen.py doeEye/sclera.png doeEye/iris.png doeEye/lid-upper.png doeEye/lid-lower.png 160 > dragonEye.h
-        // Horizontal position is offset so that eyes are very slightly crossed
-        // to appear fixated (converged) at a conversational distance.  Number
-        // here was extracted from my posterior and not mathematically based.
-        // I suppose one could get all clever with a range sensor, but for now...
-        if (NUM_EYES > 1)
+
+        // 上眼睑跟随的平滑系数（12位定点）：每帧走完 1 - exp(-dt / 时间常数) 的距离，眼睑的运动与帧率无关
+        const uint32_t lidDt = t - eye_lid_follow_time_;
+        eye_lid_follow_time_ = t;
+        const int32_t lidAlpha = 4096.0f * (1.0f - expf(-(float)lidDt / (CONFIG_EYE_LID_FOLLOW_MS * 1000.0f)));
+
+        // 眼球运动两只眼睛共用，眨眼状态、辐辏偏移和眼睑阈值每只眼睛各自计算
+        for (uint8_t eyeIndex = 0; eyeIndex < NUM_EYES; eyeIndex++)
         {
-            if (eyeIndex == 1)
-                eyeX += 4;
-            else
-                eyeX -= 4;
-        }
-        if (eyeX > (SCLERA_WIDTH - DISPLAY_SIZE))
-            eyeX = (SCLERA_WIDTH - DISPLAY_SIZE);
-
-        // Eyelids are rendered using a brightness threshold image.  This same
-        // map can be used to simplify another problem: making the upper eyelid
-        // track the pupil (eyes tend to open only as much as needed -- e.g. look
-        // down and the upper eyelid drops).  Just sample a point in the upper
-        // lid map slightly above the pupil to determine the rendering threshold.
-        static uint8_t uThreshold = 0;
-        uint8_t lThreshold = 0, n = 0;
-
-        // 眼球跟踪：只有启用时才计算眼睑位置
-        if(is_track){
-            int16_t sampleX = SCLERA_WIDTH / 2 - (eyeX / 3),
-                sampleY = SCLERA_HEIGHT / 2 - (eyeY + IRIS_HEIGHT / 6);
-            if (sampleY < 0)
-                n = 0;
-            else
-                n = upper[sampleY * SCREEN_WIDTH + sampleX] +
-                    upper[ sampleY * SCREEN_WIDTH + (SCREEN_WIDTH - 1 - sampleX)] /
-                    2;
-            uThreshold = (uThreshold * 7 + n) / 8;
-            lThreshold = 250 - uThreshold;
-        }
-        else {
-            // 不启用眼球跟踪时，眼睑保持完全开放状态
-            uThreshold = 0;    // 上眼睑完全开放
-            lThreshold = 0;    // 下眼睑完全开放
-        }
+            if (eye[eyeIndex].blink.state)
+            { // Eye currently blinking?
+                // Check if current blink state time has elapsed
+                if ((t - eye[eyeIndex].blink.startTime) >= eye[eyeIndex].blink.duration)
+                {
+                    // Yes -- increment blink state, unless...
+                    if (++eye[eyeIndex].blink.state > DEBLINK)
+                    {                                        // Deblinking finished?
+                        eye[eyeIndex].blink.state = NOBLINK; // No longer blinking
+                    }
+                    else
+                    {                                      // Advancing from ENBLINK to DEBLINK mode
+                        eye[eyeIndex].blink.duration *= 2; // DEBLINK is 1/2 ENBLINK speed
+                        eye[eyeIndex].blink.startTime = t;
+                    }
+                }
+            }
 
-        // 眨眼动画处理：不管是否启用跟踪都可以眨眼
-        if (eye[eyeIndex].blink.state) { // 眼睛正在眨眼
-            uint32_t s = (t - eye[eyeIndex].blink.startTime);
-            
-            if (s >= eye[eyeIndex].blink.duration) {
-                s = 255; // 眨眼结束
+            // Horizontal position is offset so that eyes are very slightly crossed
+            // to appear fixated (converged) at a conversational distance.  Number
+            // here was extracted from my posterior and not mathematically based.
+            // I suppose one could get all clever with a range sensor, but for now...
+            int16_t x = eyeX;
+            if (NUM_EYES > 1)
+            {
+                if (eyeIndex == 1)
+                    x += 4;
+                else
+                    x -= 4;
+            }
+            if (x < 0)
+                x = 0;
+            if (x > (assets.sclera_width - assets.screen_width))
+                x = (assets.sclera_width - assets.screen_width);
+
+            // Eyelids are rendered using a brightness threshold image.  This same
+            // map can be used to simplify another problem: making the upper eyelid
+            // track the pupil (eyes tend to open only as much as needed -- e.g. look
+            // down and the upper eyelid drops).  Just sample a point in the upper
+            // lid map slightly above the pupil to determine the rendering threshold.
+            // 跟随目标从离线生成的跟随表中一次查出，再按帧间隔做指数平滑
+            uint16_t &lidFollow = eye[eyeIndex].lidFollow;
+            uint8_t uThreshold, lThreshold = 0, n = 0;
+
+            // 眼球跟踪：只有启用时才计算眼睑位置
+            if(is_track){
+                int32_t target = EyeLidFollow(assets, x, eyeY) << 8;
+                lidFollow += ((target - lidFollow) * lidAlpha) >> 12;
+                uThreshold = lidFollow >> 8;
+                lThreshold = 250 - uThreshold;
+            }
+            else {
+                // 不启用眼球跟踪时，眼睑保持完全开放状态
+                lidFollow = 0;
+                uThreshold = 0;    // 上眼睑完全开放
+                lThreshold = 0;    // 下眼睑完全开放
+            }
+
+            // 表情的眼睑下限叠加在跟踪结果上，平滑状态lidFollow本身不受影响
+            uint8_t upper = uThreshold > pose.upper ? uThreshold : pose.upper;
+            if (lThreshold < pose.lower) {
+                lThreshold = pose.lower;
+            }
+
+            // 眨眼动画处理：不管是否启用跟踪都可以眨眼
+            if (eye[eyeIndex].blink.state) { // 眼睛正在眨眼
+                uint32_t s = (t - eye[eyeIndex].blink.startTime);
+                
+                if (s >= eye[eyeIndex].blink.duration) {
+                    s = 255; // 眨眼结束
+                } else {
+                    s = 255 * s / eye[eyeIndex].blink.duration; // 眨眼进行中
+                }
+                
+                s = (eye[eyeIndex].blink.state == DEBLINK) ? 1 + s : 256 - s;
+                
+                // 眨眼时重新计算眼睑阈值
+                n = (upper * s + 254 * (257 - s)) / 256;
+                lThreshold = (lThreshold * s + 254 * (257 - s)) / 256;
             } else {
-                s = 255 * s / eye[eyeIndex].blink.duration; // 眨眼进行中
+                n = upper;  // 没有眨眼时使用原始阈值
             }
-            
-            s = (eye[eyeIndex].blink.state == DEBLINK) ? 1 + s : 256 - s;
-            
-            // 眨眼时重新计算眼睑阈值
-            n = (uThreshold * s + 254 * (257 - s)) / 256;
-            lThreshold = (lThreshold * s + 254 * (257 - s)) / 256;
-        } else {
-            n = uThreshold;  // 没有眨眼时使用原始阈值
+
+            EyeRenderParams &params = eye_render_params_[eyeIndex];
+            params.iScale = iScale;
+            params.scleraX = x;
+            params.scleraY = eyeY;
+            params.uT = n;
+            params.lT = lThreshold;
+        }
+        // 半径表所有眼睛共用，只在虹膜缩放变化时重建，渲染任务开始前完成
+        if (iScale != eye_iris_rows_scale_) {
+            BuildEyeIrisRows(assets, iScale, eye_iris_rows_);
+            eye_iris_rows_scale_ = iScale;
         }
-        // uint32_t end_time = esp_timer_get_time();
-        // ESP_LOGI(TAG, "frame end, time: %lu us", end_time - start_time);
+        for (uint8_t e = 0; e < NUM_EYES; e++) {
+            EyeFrameTables &tables = eye_tables_[e];
+            tables.sclera = sclera;
+            tables.iris = eye_place_iris_ != nullptr ? eye_place_iris_ : iris;
+            tables.polar_lut = eye_polar_lut_;
+            tables.iris_rows = eye_iris_rows_;
+            tables.sclera_cache = &eye_sclera_cache_[e];
+            tables.sclera_rows = assets.packed_sclera ? nullptr : eye_place_rows_.data();
+            tables.sclera_lut = eye_sclera_lut_;
+            tables.iris_lut = eye_iris_lut_;
+            if (eye_fade_weight_ < EYE_FADE_ONE) {
+                // 旧样式从原贴图合成，放置副本和行表已经换给了新样式
+                EyeFrameTables &from = eye_fade_tables_[e];
+                from = tables;
+                from.sclera = eye_fade_sclera_;
+                from.iris = eye_fade_iris_;
+                from.sclera_rows = nullptr;
+                from.sclera_lut = eye_fade_sclera_lut_;
+                from.iris_lut = eye_fade_iris_lut_;
+            }
+            // 换了巩膜贴图，行缓存里的内容作废
+            EyeRowCache &cache = eye_sclera_cache_[e];
+            if (assets.packed_sclera && cache.texture != sclera) {
+                memset(cache.tag, 0xFF, cache.rows * sizeof(int16_t));
+                cache.texture = sclera;
+            }
+        }
+        EYE_PROFILE_END(eye_prof_frame_, frame_start);
 
         // Pass all the derived values to the eye-rendering function:
-        drawEye(eyeIndex, iScale, eyeX, eyeY, n, lThreshold);
+        // 分块模式下两个核一起领取本帧所有批次；否则双目时其余眼睛交给另一个核上的渲染任务，
+        // 本任务同时绘制第0只眼睛。两边都画完才算一帧
+        eye_frame_tiled_ = eye_tiled_.load(std::memory_order_relaxed);
+
+        // 脏矩形：只重绘和上一帧相比有变化的批次
+        bool full = eye_invalidate_.exchange(false);
+        uint32_t damagedRows = 0;
+        for (uint8_t e = 0; e < NUM_EYES; e++) {
+            eye_damage_[e] = ComputeEyeDamage(e, full);
+            eye_damage_count_[e] = 0;
+            for (uint16_t b = 0; b < eye_batch_count_; b++) {
+                if (eye_damage_[e] & (1UL << b)) {
+                    eye_damage_count_[e]++;
+                    damagedRows += (assets.screen_height - b * LINES_PER_BATCH) < LINES_PER_BATCH ? (assets.screen_height - b * LINES_PER_BATCH) : LINES_PER_BATCH;
+                }
+            }
+        }
+        eye_rows_sent_ += damagedRows;
+        eye_rows_total_ += NUM_EYES * assets.screen_height;
+        eye_frame_count_++;
+        if (damagedRows == 0) {
+            return; // 画面没有变化，直接等下一个调度帧
+        }
+
+        EYE_PROFILE_BEGIN(render_start);
+        bool useWorker = eye_render_task_handle_ != NULL && (eye_frame_tiled_ || NUM_EYES > 1);
+        if (eye_frame_tiled_) {
+            // 按批次交错生成本帧的任务列表，每只眼睛的提交序号从0开始
+            uint16_t seq[NUM_EYES] = {};
+            eye_tile_count_ = 0;
+            for (uint16_t b = 0; b < eye_batch_count_; b++) {
+                for (uint8_t e = 0; e < NUM_EYES; e++) {
+                    if (eye_damage_[e] & (1UL << b)) {
+                        eye_tile_list_[eye_tile_count_++] = e | (b << 8) | ((uint32_t)seq[e]++ << 16);
+                    }
+                }
+            }
+            eye_tile_next_.store(0, std::memory_order_relaxed);
+            for (uint8_t e = 0; e < NUM_EYES; e++) {
+                eye_tile_submit_[e].store(0, std::memory_order_relaxed);
+            }
+        }
+        if (useWorker) {
+            xTaskNotifyGive(eye_render_task_handle_);
+        } else if (!eye_frame_tiled_) {
+            for (uint8_t e = 1; e < NUM_EYES; e++) {
+                const EyeRenderParams &params = eye_render_params_[e];
+                drawEye(e, params.iScale, params.scleraX, params.scleraY, params.uT, params.lT);
+            }
+        }
+        if (eye_frame_tiled_) {
+            RunEyeTiles(0);
+        } else {
+            const EyeRenderParams &params = eye_render_params_[0];
+            drawEye(0, params.iScale, params.scleraX, params.scleraY, params.uT, params.lT);
+        }
+        if (useWorker) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+        if (eye_frame_tiled_) {
+            // 分块模式按提交序号直接定位缓冲区，帧结束后把环的起始索引推进本帧用掉的个数
+            for (uint8_t e = 0; e < NUM_EYES; e++) {
+                eye_line_buf_idx_[e] = (eye_line_buf_idx_[e] + eye_damage_count_[e]) % EYE_LINE_BUF_COUNT;
+            }
+        }
+        EYE_PROFILE_END(eye_prof_render_, render_start);
     }
 
-    //虹膜缩放动画：通过递归函数split生成虹膜缩放动画，模拟瞳孔对光线的反应。使用时间插值实现平滑的缩放效果。
+    //虹膜缩放动画：通过递归函数split生成虹膜缩放曲线，模拟瞳孔对光线的反应。
+    //曲线只在每段开始时生成一次，之后由调度器每帧按时间插值，不再在递归里忙等绘制
     void Application::split(
         int16_t  startValue, // 虹膜缩放的起始值
         int16_t  endValue,   // 虹膜缩放的结束值
-        uint64_t startTime,  // 开始时间（使用`esp_timer_get_time()`获取）
-        int32_t  duration,   // 动画持续时间（微秒）
+        uint16_t first,      // 本段在曲线中的起始关键点
+        uint16_t count,      // 本段包含的分段数（时长 = count / EYE_IRIS_CURVE_SEGMENTS）
         int16_t  range
     ) {    // 允许的缩放值变化范围
-        if (range >= 8) { // 限制递归深度
-            range    /= 2; // 将范围和时间分成两半
-            duration /= 2;
+        if (range >= 8 && count >= 2) { // 限制递归深度
+            range /= 2; // 将范围和时间分成两半
+            count /= 2;
             int16_t midValue = (startValue + endValue - range) / 2 + (esp_random() % range);
-            uint64_t midTime = startTime + duration;
-            split(startValue, midValue, startTime, duration, range); // 第一部分
-            split(midValue, endValue, midTime, duration, range);     // 第二部分
-        } else { // No more subdivisions, do iris motion...
-            int32_t dt;     // Time since start of motion
-            int16_t v;      // Interim value
-            // uint32_t start_time = esp_timer_get_time();
-            // ESP_LOGI(TAG, "split start");
-            while ((dt = (esp_timer_get_time() - startTime)) < duration) {  //使用 esp_timer_get_time() 获取当前时间，并计算与 startTime 的时间差 dt。
-                // 计算当前值
-                v = startValue + (((endValue - startValue) * dt) / duration);   //根据时间差 dt 和总时间 duration，计算当前虹膜的缩放值 v
-                if (v < IRIS_MIN) v = IRIS_MIN; // Clip just in case    确保 v 不会超出预定义的虹膜大小范围（IRIS_MIN 和 IRIS_MAX）。
+            split(startValue, midValue, first, count, range);            // 第一部分
+            split(midValue, endValue, first + count, count, range);      // 第二部分
+        } else { // No more subdivisions, 本段内线性插值
+            for (uint16_t i = 1; i <= count; i++) {
+                int16_t v = startValue + ((endValue - startValue) * i) / count;
+                if (v < IRIS_MIN) v = IRIS_MIN; // Clip just in case
                 else if (v > IRIS_MAX) v = IRIS_MAX;
-                frame(v); // Draw frame with interim iris scale value   调用 frame(v) 函数，使用计算出的 v 值绘制当前帧。
-                // 分段延时，允许任务切换
-            
+                eye_iris_curve_[first + i] = v;
             }
-            //  uint32_t end_time = esp_timer_get_time();
-            // ESP_LOGI(TAG, "split end, time: %lu us", end_time - start_time);
         }
     }
 
+    // 按当前时间在虹膜缩放曲线上插值，超出曲线时长时停在终点
+    uint16_t Application::EyeIrisAt(uint64_t now) {
+        uint64_t dt = now - eye_iris_curve_start_;
+        if (dt >= (uint64_t)EYE_IRIS_CURVE_DURATION_US) {
+            return eye_iris_curve_[EYE_IRIS_CURVE_SEGMENTS];
+        }
+        uint64_t pos = dt * EYE_IRIS_CURVE_SEGMENTS;
+        uint32_t seg = pos / EYE_IRIS_CURVE_DURATION_US;
+        int32_t frac = pos % EYE_IRIS_CURVE_DURATION_US;
+        int32_t v0 = eye_iris_curve_[seg], v1 = eye_iris_curve_[seg + 1];
+        return v0 + (int32_t)(((int64_t)(v1 - v0) * frac) / EYE_IRIS_CURVE_DURATION_US);
+    }
+
+    // 当前的帧间隔：设备空闲时降低帧率，其余状态（聆听、说话等）使用目标帧率
+    TickType_t Application::EyeFramePeriod() {
+        int fps = device_state_ == kDeviceStateIdle ? CONFIG_EYE_IDLE_FPS : CONFIG_EYE_TARGET_FPS;
+        TickType_t period = pdMS_TO_TICKS(1000 / fps);
+        return period > 0 ? period : 1;
+    }
+
+    // 其他任务切换样式只记录请求，魔眼任务预取贴图后在帧边界整体换上
     void Application::eye_style(uint8_t eye_style)
     {
-        // is_track = rand() % 2;
-        //is_track = false;
-        eye_style_num = eye_style;
-        switch (eye_style)
-        {
-        case 1:
-            iris = iris_default;
-            sclera = sclera_default;
-            break;
-        case 2:
-            iris = iris_style_blood;
-            sclera = sclera_style_white;
-            break;
-        case 3:
-            iris = iris_style_cospa1;
-            sclera = sclera_style_cute_girl;
-            break;
-        case 4:
-            iris = iris_style_spikes;
-            sclera = sclera_style_white;
-            break;
-        case 5:
-            iris = iris_style_ribbon;
-            sclera = sclera_style_ocean_girl;
-            break;
-        case 6:
-            iris = iris_style_black_star;
-            sclera = sclera_style_zhuozhu;
-            break;
-        case 7:
-            iris = iris_style_straw;
-            sclera = sclera_style_lufei;
-            break;
-        default:
-            break;
+        eye_styles_.Request(eye_style, CONFIG_EYE_STYLE_FADE_FRAMES);
+    }
+
+    // 按名字切换样式，名字见GetEyeStyleNames()
+    bool Application::SetEyeStyle(const std::string& name) {
+        int style = FindEyeStyle(name);
+        if (style == 0) {
+            ESP_LOGW(TAG, "Unknown eye style: %s", name.c_str());
+            return false;
+        }
+        eye_style(style);
+        return true;
+    }
+
+    // 资源包中的样式用包里记录的名字，编译进固件的样式用kEyeBuiltinStyles中的名字
+    std::vector<std::string> Application::GetEyeStyleNames() {
+        std::vector<std::string> names;
+#if CONFIG_EYE_ASSET_PACK
+        if (eye_assets_ == &eye_pack_assets_) {
+            for (int i = 0; i < eye_pack_.header->style_count; i++) {
+                names.emplace_back(eye_pack_.styles[i].name, strnlen(eye_pack_.styles[i].name, EYE_PACK_NAME_LEN));
+            }
+            return names;
+        }
+#endif
+        for (int i = 0; i < kEyeBuiltinStyleCount; i++) {
+            names.emplace_back(kEyeBuiltinStyles[i].name);
+        }
+        return names;
+    }
+
+    std::string Application::GetEyeStyleName() {
+        std::vector<std::string> names = GetEyeStyleNames();
+        std::string name = eye_style_num >= 1 && eye_style_num <= names.size() ? names[eye_style_num - 1] : "";
+        // 触摸换过巩膜时，画面上是这个样式的虹膜加另一张巩膜
+        if (eye_sclera_override_ < kEyeScleraCount) {
+            name += std::string(" (sclera: ") + kEyeScleraNames[eye_sclera_override_] + ")";
+        }
+        return name;
+    }
+
+    // 返回样式编号（从1开始），没有该样式时返回0
+    int Application::FindEyeStyle(const std::string& name) {
+#if CONFIG_EYE_ASSET_PACK
+        if (eye_assets_ == &eye_pack_assets_) {
+            for (int i = 0; i < eye_pack_.header->style_count; i++) {
+                if (name.size() <= EYE_PACK_NAME_LEN && strncmp(name.c_str(), eye_pack_.styles[i].name, EYE_PACK_NAME_LEN) == 0) {
+                    return i + 1;
+                }
+            }
+            return 0;
+        }
+#endif
+        return FindEyeBuiltinStyle(name.c_str());
+    }
+
+    // 解析样式的巩膜和虹膜贴图，资源包中压缩的虹膜在这里解码；样式不存在或贴图缺失时返回false，不修改输出
+    bool Application::ResolveEyeStyle(uint8_t style, const uint16_t** styleSclera, const uint16_t** styleIris) {
+        if (eye_assets_ == nullptr || style == 0) {
+            return false;
+        }
+#if CONFIG_EYE_ASSET_PACK
+        // 资源包中的样式直接切换贴图指针，新增样式只需重新打包烧录eye_assets分区
+        if (eye_assets_ == &eye_pack_assets_) {
+            if (style > eye_pack_.header->style_count) {
+                return false;
+            }
+            const uint16_t* packIris = GetEyePackIris(style - 1);
+            if (packIris == nullptr) {
+                return false;
+            }
+            *styleIris = packIris;
+            *styleSclera = EyePackSclera(eye_pack_, style - 1);
+            return true;
+        }
+#endif
+        if (style > kEyeBuiltinStyleCount) {
+            return false;
+        }
+        const EyeBuiltinStyle& builtin = kEyeBuiltinStyles[style - 1];
+        if (eye_assets_->iris[builtin.iris] == nullptr || eye_assets_->sclera[builtin.sclera] == nullptr) {
+            return false;
+        }
+        *styleIris = eye_assets_->iris[builtin.iris];
+        *styleSclera = eye_assets_->sclera[builtin.sclera];
+        return true;
+    }
+
+    // 帧开始时同时换上巩膜和虹膜。需要淡入时记下旧样式的原贴图和调色板，淡入期间另外合成一份用于混合；
+    // 压缩的巩膜只有一份行缓存，旧样式无法同时合成，直接切换
+    void Application::CommitEyeStyle(const EyeStyleManager::Staged& staged) {
+        eye_style_num = staged.style;
+        eye_sclera_override_ = staged.sclera_override;
+        if (staged.sclera == sclera && staged.iris == iris) {
+            return;
+        }
+        if (staged.fade_frames != EYE_STYLE_NO_FADE && eye_fade_scratch_[0] != nullptr && !eye_assets_->packed_sclera &&
+            sclera != nullptr && iris != nullptr) {
+            eye_fade_sclera_ = sclera;
+            eye_fade_iris_ = iris;
+            if (eye_assets_->palette) {
+                memcpy(eye_fade_sclera_lut_, eye_sclera_lut_, sizeof(eye_sclera_lut_));
+                memcpy(eye_fade_iris_lut_, eye_iris_lut_, sizeof(eye_iris_lut_));
+            }
+            eye_styles_.BeginFade(staged.fade_frames);
+        } else {
+            eye_styles_.BeginFade(EYE_STYLE_NO_FADE);
+        }
+        sclera = staged.sclera;
+        iris = staged.iris;
+    }
+
+    // 每帧开始时调用：换上上一帧预取好的样式，取走新的请求并预取，然后推进淡入
+    void Application::UpdateEyeStyle() {
+        EyeStyleManager::Staged staged;
+        if (eye_styles_.Commit(&staged)) {
+            CommitEyeStyle(staged);
+        }
+        uint8_t style, fadeFrames, scleraOverride;
+        if (eye_styles_.Take(&style, &fadeFrames, &scleraOverride)) {
+            // 只换巩膜时保持当前样式，上面已经换上了上一帧预取的样式
+            if (style == 0) {
+                style = eye_style_num;
+            }
+            staged = { style, fadeFrames, nullptr, nullptr, EYE_SCLERA_OF_STYLE };
+            if (!ResolveEyeStyle(style, &staged.sclera, &staged.iris)) {
+                ESP_LOGW(TAG, "Eye style %u not available", style);
+            } else {
+                if (scleraOverride != EYE_SCLERA_OF_STYLE) {
+                    if (scleraOverride < kEyeScleraCount && eye_assets_->sclera[scleraOverride] != nullptr) {
+                        staged.sclera = eye_assets_->sclera[scleraOverride];
+                        staged.sclera_override = scleraOverride;
+                    } else {
+                        ESP_LOGW(TAG, "Eye sclera %u not available", scleraOverride);
+                    }
+                }
+                eye_styles_.Stage(staged);
+            }
+        }
+        // 淡入期间每帧整屏都在变化，结束后的第一帧也要整屏换成不混合的画面
+        const bool wasFading = eye_fade_weight_ < EYE_FADE_ONE;
+        eye_fade_weight_ = eye_styles_.NextFadeWeight();
+        if (wasFading || eye_fade_weight_ < EYE_FADE_ONE) {
+            eye_invalidate_.store(true);
+        }
+    }
+
+
+    // 申请常驻的DMA行缓冲环，只在魔眼任务启动时执行一次
+    bool Application::AllocEyeLineBuffers() {
+        const size_t size = LINES_PER_BATCH * eye_assets_->screen_width * sizeof(uint16_t);
+        uint16_t** bufs = &eye_line_buf_[0][0];
+        const int count = NUM_EYES * EYE_LINE_BUF_COUNT;
+        for (int i = 0; i < count; i++) {
+            bufs[i] = (uint16_t*)heap_caps_malloc(size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+            if (bufs[i] == nullptr) {
+                ESP_LOGE(TAG, "Failed to allocate eye line buffer %d (%u bytes)", i, size);
+                for (int j = 0; j < i; j++) {
+                    heap_caps_free(bufs[j]);
+                    bufs[j] = nullptr;
+                }
+                return false;
+            }
+        }
+        for (int e = 0; e < NUM_EYES; e++) {
+            eye_line_buf_idx_[e] = 0;
+        }
+        ESP_LOGI(TAG, "Eye line buffers: %d eyes x %d x %u bytes (DMA)", NUM_EYES, EYE_LINE_BUF_COUNT, size);
+        // 样式淡入时每个核合成旧样式用的缓冲，不需要DMA；申请不到时样式直接切换
+        if (CONFIG_EYE_STYLE_FADE_FRAMES > 0) {
+            for (int core = 0; core < 2; core++) {
+                eye_fade_scratch_[core] = (uint16_t*)heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            }
+            if (eye_fade_scratch_[0] == nullptr || eye_fade_scratch_[1] == nullptr) {
+                ESP_LOGW(TAG, "No memory for eye style fade, styles switch without fading");
+                for (int core = 0; core < 2; core++) {
+                    heap_caps_free(eye_fade_scratch_[core]);
+                    eye_fade_scratch_[core] = nullptr;
+                }
+            }
+        }
+        return true;
+    }
+
+    // 把极坐标图烘焙成查找表：极角到虹膜贴图列的乘法和移位只在选定魔眼数据时做一次
+    // 查找表和极坐标图一样大，优先放PSRAM，放不下再用内部RAM
+    bool Application::BuildEyePolarTable() {
+        if (eye_polar_lut_ != nullptr && eye_polar_lut_assets_ == eye_assets_) {
+            return true;
+        }
+        const size_t size = eye_assets_->iris_width * eye_assets_->iris_height * sizeof(uint16_t);
+        heap_caps_free(eye_polar_lut_);
+        eye_polar_lut_ = (uint16_t*)EyeAlloc(size);
+        if (eye_polar_lut_ == nullptr) {
+            ESP_LOGE(TAG, "Failed to allocate eye polar table (%u bytes)", size);
+            eye_polar_lut_assets_ = nullptr;
+            return false;
+        }
+        BuildEyePolarLut(*eye_assets_, eye_polar_lut_);
+        eye_polar_lut_assets_ = eye_assets_;
+        eye_iris_rows_scale_ = UINT32_MAX;
+        ESP_LOGI(TAG, "Eye polar table: %ux%u, %u bytes", eye_assets_->iris_width, eye_assets_->iris_height, size);
+        return true;
+    }
+
+    // 巩膜压缩时为每只眼睛申请行缓存，槽数等于屏幕高度，放PSRAM
+    bool Application::AllocEyeScleraCache() {
+        if (!eye_assets_->packed_sclera) {
+            return true;
+        }
+        const uint16_t rows = eye_assets_->screen_height;
+        const size_t size = rows * (sizeof(int16_t) + sizeof(uint8_t) + eye_assets_->sclera_width * sizeof(uint16_t));
+        for (int e = 0; e < NUM_EYES; e++) {
+            EyeRowCache &cache = eye_sclera_cache_[e];
+            if (cache.pixels != nullptr && cache.rows == rows) {
+                continue;
+            }
+            heap_caps_free(cache.pixels);
+            cache = {};
+            uint8_t* block = (uint8_t*)EyeAlloc(size);
+            if (block == nullptr) {
+                ESP_LOGE(TAG, "Failed to allocate eye sclera cache (%u bytes)", size);
+                return false;
+            }
+            // 像素放在块首保证对齐，之后是tag和valid
+            cache.rows = rows;
+            cache.pixels = (uint16_t*)block;
+            cache.tag = (int16_t*)(block + rows * eye_assets_->sclera_width * sizeof(uint16_t));
+            cache.valid = (uint8_t*)(cache.tag + rows);
+        }
+        ESP_LOGI(TAG, "Eye sclera cache: %d eyes x %u bytes", NUM_EYES, size);
+        return true;
+    }
+
+    /*
+        贴图分层放置，在frame()中渲染开始前执行，此时没有合成在进行，可以直接替换贴图和行表。
+        虹膜（160: 31KB，240: 69KB）在切换样式的那一帧整张复制，放得进CONFIG_EYE_TEXTURE_INTERNAL_BUDGET
+        且内部RAM有余量时放内部RAM，否则放PSRAM；
+        巩膜（160: 122KB，240: 275KB，调色板贴图约为一半）只能放PSRAM，每帧最多复制CONFIG_EYE_PREFETCH_ROWS行，
+        先复制注视目标targetY处屏幕会显示的行，再向上下两侧扩展，眼球移动过去之前目标区域就已就位。
+        压缩的巩膜由行缓存解码到PSRAM，不需要复制。
+        */
+    void Application::PlaceEyeTextures(int targetY) {
+        const EyeAssets& assets = *eye_assets_;
+        EyePlacementStats& stats = eye_place_stats_;
+        const int64_t start = esp_timer_get_time();
+        bool copied = false;
+
+        if (iris != eye_place_iris_src_ && iris != nullptr) {
+            heap_caps_free(eye_place_iris_);
+            eye_place_iris_ = nullptr;
+            const size_t size = EyeTextureSize(assets, assets.iris_map_width, assets.iris_map_height);
+            EyeTier tier = esp_ptr_external_ram(iris) ? kEyeTierPsram : kEyeTierFlash;
+            if (size <= CONFIG_EYE_TEXTURE_INTERNAL_BUDGET * 1024 &&
+                heap_caps_get_free_size(MALLOC_CAP_INTERNAL) >= size + EYE_INTERNAL_RESERVE) {
+                eye_place_iris_ = (uint16_t*)heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+                if (eye_place_iris_ != nullptr) tier = kEyeTierInternal;
+            }
+            if (eye_place_iris_ == nullptr && tier == kEyeTierFlash) {
+                eye_place_iris_ = (uint16_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+                if (eye_place_iris_ != nullptr) tier = kEyeTierPsram;
+            }
+            if (eye_place_iris_ != nullptr) {
+                memcpy(eye_place_iris_, iris, size);
+                copied = true;
+            }
+            stats.iris_tier = tier;
+            stats.internal_bytes = tier == kEyeTierInternal ? size : 0;
+            stats.psram_bytes = (tier == kEyeTierPsram && eye_place_iris_ != nullptr) ? size : 0;
+            eye_place_iris_src_ = iris;
+            eye_place_start_us_ = start;
+            stats.copy_us_max = 0;
+            stats.settle_us = 0;
+        }
+
+        if (sclera != eye_place_sclera_src_ && sclera != nullptr) {
+            const int width = assets.sclera_width, height = assets.sclera_height;
+            eye_place_sclera_src_ = sclera;
+            stats.sclera_rows = height;
+            stats.sclera_rows_placed = height;
+            if (assets.packed_sclera) {
+                stats.sclera_tier = kEyeTierPsram;
+            } else {
+                eye_place_rows_.resize(height);
+                for (int y = 0; y < height; y++) {
+                    eye_place_rows_[y] = EyeTextureRow(assets, sclera, width, y);
+                }
+                stats.sclera_tier = esp_ptr_external_ram(sclera) ? kEyeTierPsram :
+                    (esp_ptr_internal(sclera) ? kEyeTierInternal : kEyeTierFlash);
+                if (stats.sclera_tier == kEyeTierFlash && eye_place_sclera_ == nullptr) {
+                    eye_place_sclera_ = (uint16_t*)heap_caps_malloc(EyeTextureSize(assets, width, height), MALLOC_CAP_SPIRAM);
+                    if (eye_place_sclera_ == nullptr) {
+                        ESP_LOGW(TAG, "No PSRAM for eye sclera copy, rendering from flash");
+                    }
+                }
+                if (stats.sclera_tier == kEyeTierFlash && eye_place_sclera_ != nullptr) {
+                    stats.sclera_rows_placed = 0;
+                }
+            }
+            eye_place_start_us_ = start;
+            stats.copy_us_max = 0;
+            stats.settle_us = 0;
+        }
+        if (eye_place_sclera_ != nullptr) {
+            stats.psram_bytes = (stats.iris_tier == kEyeTierPsram && eye_place_iris_ != nullptr ?
+                EyeTextureSize(assets, assets.iris_map_width, assets.iris_map_height) : 0) +
+                EyeTextureSize(assets, assets.sclera_width, assets.sclera_height);
+        }
+
+        // 按离注视目标窗口由近到远的顺序复制：先是窗口内的行，再在窗口上方和下方交替向外
+        if (stats.sclera_rows_placed < stats.sclera_rows) {
+            const int width = assets.sclera_width, height = assets.sclera_height, window = assets.screen_height;
+            int budget = CONFIG_EYE_PREFETCH_ROWS;
+            for (int i = 0; i < window + 2 * height && budget > 0; i++) {
+                int k = i - window;
+                int y = k < 0 ? targetY + i : ((k & 1) ? targetY + window + k / 2 : targetY - 1 - k / 2);
+                if (y < 0 || y >= height) {
+                    continue;
+                }
+                const void* dst = EyeTextureRow(assets, eye_place_sclera_, width, y);
+                if (eye_place_rows_[y] == dst) {
+                    continue;
+                }
+                memcpy((void*)dst, EyeTextureRow(assets, sclera, width, y), width * EyeTexelSize(assets));
+                eye_place_rows_[y] = dst;
+                stats.sclera_rows_placed++;
+                budget--;
+            }
+            if (stats.sclera_rows_placed == stats.sclera_rows) {
+                stats.sclera_tier = kEyeTierPsram;
+            }
+            copied = true;
+        }
+
+        const int64_t end = esp_timer_get_time();
+        if (copied && end - start > stats.copy_us_max) {
+            stats.copy_us_max = end - start;
+        }
+        if (stats.settle_us == 0 && stats.sclera_rows_placed == stats.sclera_rows) {
+            stats.settle_us = end - eye_place_start_us_;
+            ESP_LOGI(TAG, "Eye textures placed: iris %s, sclera %s, %lu us", EyeTierName(stats.iris_tier),
+                EyeTierName(stats.sclera_tier), stats.settle_us);
+        }
+    }
+
+    // 调色板贴图：样式或着色变化时重建调色板副本，渲染开始前完成；贴图本身不变，着色变化时整屏重绘
+    void Application::UpdateEyePalettes() {
+        if (!eye_assets_->palette) {
+            return;
+        }
+        const uint32_t tint = eye_tint_.load(std::memory_order_relaxed);
+        const bool tintChanged = tint != eye_tint_applied_;
+        if (tintChanged || sclera != eye_lut_sclera_src_) {
+            BuildEyeTintedPalette(sclera, tint >> 16, tint & 0xFF, eye_sclera_lut_);
+            eye_lut_sclera_src_ = sclera;
+        }
+        if (tintChanged || iris != eye_lut_iris_src_) {
+            BuildEyeTintedPalette(iris, tint >> 16, tint & 0xFF, eye_iris_lut_);
+            eye_lut_iris_src_ = iris;
+        }
+        if (tintChanged) {
+            eye_tint_applied_ = tint;
+            eye_invalidate_.store(true);
+        }
+    }
+
+    // 表情名经完美哈希直接得到编号，只记录请求，由魔眼任务在下一帧开始时切换
+    bool Application::SetEyeEmotion(const char* emotion) {
+        if (eye_emotions_.header == nullptr) {
+            return false;
+        }
+        int index = FindEyeEmotion(eye_emotions_, emotion);
+        if (index < 0) {
+            ESP_LOGW(TAG, "Unknown eye emotion: %s", emotion);
+            return false;
+        }
+        eye_emotion_request_.store(index + 1);
+        return true;
+    }
+
+    EyePlacementStats Application::GetEyePlacementStats() const {
+        EyePlacementStats stats = eye_place_stats_;
+        stats.free_internal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+        stats.free_psram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+        return stats;
+    }
+
+    void Application::Wink(uint8_t e) {
+        if (e >= NUM_EYES) {
+            e = NUM_EYES - 1;
         }
+        eye_wink_request_.fetch_or(1 << e);
     }
 
+    // 核1上的渲染任务：等待frame()通知后参与分块渲染，或在双目时绘制第1只及之后的眼睛，完成后通知魔眼任务
+    void Application::EyeRenderLoop() {
+        while (true) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            if (eye_frame_tiled_) {
+                RunEyeTiles(1);
+            } else {
+                for (uint8_t e = 1; e < NUM_EYES; e++) {
+                    const EyeRenderParams &params = eye_render_params_[e];
+                    drawEye(e, params.iScale, params.scleraX, params.scleraY, params.uT, params.lT);
+                }
+            }
+            xTaskNotifyGive(eye_loop_task_handle_);
+        }
+    }
 
 void Application::EyeLoop() {
     uint8_t e; // Eye index, 0 to NUM_EYES-1
+    // 按实际屏幕尺寸确认魔眼数据，和构造时的选择不同则重新应用当前样式
+    auto display = Board::GetInstance().GetDisplay();
+    const EyeAssets* configured = eye_assets_;
+    if (!SelectEyeAssets(display->width()) && configured == nullptr) {
+        return;
+    }
+    if (eye_assets_ != configured) {
+        ResolveEyeStyle(eye_style_num, &sclera, &iris);
+    }
+    if (!AllocEyeLineBuffers() || !BuildEyePolarTable() || !AllocEyeScleraCache()) {
+        return;
+    }
+    BuildEyeLidRowRanges(*eye_assets_, &eye_lid_ranges_);
     startTime = esp_timer_get_time(); // For frame-rate calculation
     for(e=0; e<NUM_EYES; e++) {
         eye[e].blink.state = NOBLINK;
+        eye[e].lidFollow = 0;
     // If project involves only ONE eye and NO other SPI devices, its
     // select line can be permanently tied to GND and corresponding pin
     // in config.h set to -1.  Best to use it though.
     }
+    // 魔眼任务在核0，渲染任务放在核1，用于分块渲染或双目时并行合成另一只眼睛
+    eye_tile_events_ = xEventGroupCreate();
+    xTaskCreatePinnedToCore([](void* arg) {
+        Application* app = (Application*)arg;
+        app->EyeRenderLoop();
+        vTaskDelete(NULL);
+    }, "eye_render", 1024*4, this, 4, &eye_render_task_handle_, 1);
 
+    // 帧调度：按目标帧率用xTaskDelayUntil定时唤醒，虹膜缩放按时间在曲线上取值，
+    // 所以掉帧只影响流畅度，不会拖慢动画
+    eye_iris_curve_[0] = oldIris;
+    for (int i = 1; i <= EYE_IRIS_CURVE_SEGMENTS; i++) {
+        eye_iris_curve_[i] = oldIris;
+    }
+    newIris = oldIris;
+    eye_iris_curve_start_ = esp_timer_get_time() - EYE_IRIS_CURVE_DURATION_US;
+    TickType_t lastWake = xTaskGetTickCount();
     while(true){
-        ESP_LOGI(TAG,"EYE_Task...");
-        newIris = random_range(IRIS_MIN, IRIS_MAX);    //
-        split(oldIris, newIris, esp_timer_get_time(), 5000000L, IRIS_MAX - IRIS_MIN);  //
+        uint64_t nowUs = esp_timer_get_time();
+        if (nowUs - eye_iris_curve_start_ >= (uint64_t)EYE_IRIS_CURVE_DURATION_US) {
+            LogEyeStats(nowUs);
+            // 上一段曲线走完，从终点开始生成下一段
+            oldIris = newIris;
+            newIris = random_range(IRIS_MIN, IRIS_MAX);
+            eye_iris_curve_[0] = oldIris;
+            split(oldIris, newIris, 0, EYE_IRIS_CURVE_SEGMENTS, IRIS_MAX - IRIS_MIN);
+            eye_iris_curve_start_ = nowUs;
+        }
+
+        frame(EyeIrisAt(nowUs));
 
-        vTaskDelay(10 / portTICK_PERIOD_MS); // 确保任务不卡住
+        TickType_t period = EyeFramePeriod();
+        TickType_t tick = xTaskGetTickCount();
+        if (tick - lastWake >= period) {
+            // 本帧超时：丢弃错过的帧时隙，从现在重新对齐，并让出一个tick给同核的低优先级任务
+            eye_frames_skipped_ += (tick - lastWake) / period;
+            lastWake = tick;
+            vTaskDelay(1);
+        } else {
+            xTaskDelayUntil(&lastWake, period);
+        }
     }
 }
 
+    // 输出一个统计周期的帧率、分块负载和重绘比例，然后清零
+    void Application::LogEyeStats(uint64_t nowUs) {
+        uint32_t now = nowUs;
+        if (eye_frame_count_ > 0 && now > startTime) {
+            uint32_t fps_x10 = (uint64_t)eye_frame_count_ * 10000000ULL / (now - startTime);
+            uint32_t frame_us = (now - startTime) / eye_frame_count_;
+            if (eye_rows_total_ > 0) {
+                eye_damage_permille_ = (uint64_t)eye_rows_sent_ * 1000 / eye_rows_total_;
+            }
+            ESP_LOGI(TAG, "EYE_Task... %s, %lu frames, %lu.%lu fps (target %d), %lu skipped, %lu us/frame, tiles core0/core1: %lu/%lu, damage %lu.%lu%%",
+                eye_frame_tiled_ ? "tiled" : "single", eye_frame_count_, fps_x10 / 10, fps_x10 % 10,
+                device_state_ == kDeviceStateIdle ? CONFIG_EYE_IDLE_FPS : CONFIG_EYE_TARGET_FPS, eye_frames_skipped_, frame_us,
+                eye_tile_jobs_[0], eye_tile_jobs_[1], eye_damage_permille_ / 10, eye_damage_permille_ % 10);
+#if CONFIG_EYE_RENDER_PROFILE
+            ESP_LOGI(TAG, "EYE_Task... us avg/max: frame %lu/%lu, render %lu/%lu, compose core0 %lu/%lu core1 %lu/%lu, wait core0 %lu/%lu core1 %lu/%lu",
+                eye_prof_frame_.Avg(), eye_prof_frame_.max_us, eye_prof_render_.Avg(), eye_prof_render_.max_us,
+                eye_prof_compose_[0].Avg(), eye_prof_compose_[0].max_us, eye_prof_compose_[1].Avg(), eye_prof_compose_[1].max_us,
+                eye_prof_wait_[0].Avg(), eye_prof_wait_[0].max_us, eye_prof_wait_[1].Avg(), eye_prof_wait_[1].max_us);
+#endif
+            EyePlacementStats place = GetEyePlacementStats();
+            ESP_LOGI(TAG, "EYE_Task... textures: iris %s, sclera %s %u/%u rows, copy %lu/%lu bytes internal/psram, copy max %lu us, free %lu/%lu",
+                EyeTierName(place.iris_tier), EyeTierName(place.sclera_tier), place.sclera_rows_placed, place.sclera_rows,
+                place.internal_bytes, place.psram_bytes, place.copy_us_max, place.free_internal, place.free_psram);
+        } else {
+            ESP_LOGI(TAG, "EYE_Task...");
+        }
+        eye_frame_count_ = 0;
+        eye_frames_skipped_ = 0;
+        eye_rows_sent_ = 0;
+        eye_rows_total_ = 0;
+        eye_tile_jobs_[0] = 0;
+        eye_tile_jobs_[1] = 0;
+        eye_prof_frame_.Reset();
+        eye_prof_render_.Reset();
+        for (int i = 0; i < 2; i++) {
+            eye_prof_compose_[i].Reset();
+            eye_prof_wait_[i].Reset();
+        }
+        startTime = now;
+    }
+
 
 #endif
@@ -12,6 +12,7 @@
 #include <vector>
 #include <condition_variable>
 #include <memory>
+#include <atomic>
 
 #include <opus_encoder.h>
 #include <opus_decoder.h>
@@ -23,39 +24,24 @@
 #include "audio_processor.h"
 #include "wake_word.h"
 #include "audio_debugger.h"
+#include "spsc_ring.h"
+#include "audio_jitter_buffer.h"
+#include "pcm_ring.h"
+#include "audio_output_pacer.h"
+#include "audio_config.h"
 
-#if CONFIG_LCD_GC9A01_240X240 &&  CONFIG_USE_EYE_STYLE_VB6824
-    #include "eye_data/240_240/blood.h"
-    #include "eye_data/240_240/cospa.h"
-    #include "eye_data/240_240/default.h"
-    #include "eye_data/240_240/sclera_common.h"
-    #include "eye_data/240_240/spikes.h"
-    #include "eye_data/240_240/ribbon.h"
-    #include "eye_data/240_240/black_star.h"
-    #include "eye_data/240_240/straw.h"
-    #include "eye_data/240_240/upper_lower_common.h"
-#elif CONFIG_LCD_GC9A01_160X160 &&  CONFIG_USE_EYE_STYLE_VB6824
-    #include "eye_data/160_160/blood.h"
-    #include "eye_data/160_160/cospa.h"
-    #include "eye_data/160_160/default.h"
-    #include "eye_data/160_160/sclera_common.h"
-    #include "eye_data/160_160/spikes.h"
-    #include "eye_data/160_160/ribbon.h"
-    #include "eye_data/160_160/black_star.h"
-    #include "eye_data/160_160/straw.h"
-    #include "eye_data/160_160/upper_lower_common.h"
-#else 
-   #include "eye_data/240_240/blood.h"
-    #include "eye_data/240_240/cospa.h"
-    #include "eye_data/240_240/default.h"
-    #include "eye_data/240_240/sclera_common.h"
-    #include "eye_data/240_240/spikes.h"
-    #include "eye_data/240_240/ribbon.h"
-    #include "eye_data/240_240/black_star.h"
-    #include "eye_data/240_240/straw.h"
-    #include "eye_data/240_240/upper_lower_common.h"
+#if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824
+    #include "display.h"
+    #include "eye_assets.h"
+    #include "eye_mailbox.h"
+    #include "eye_render.h"
+    #include "eye_style.h"
+    #include "eye_timeline.h"
+    #if CONFIG_EYE_ASSET_PACK
+        #include <esp_partition.h>
+        #include "eye_pack.h"
+    #endif
 #endif
-
 #if CONFIG_USE_EYE_STYLE_ES8311
     #include "touch_button.h"
 #endif
@@ -84,8 +70,7 @@ enum DeviceState {
     kDeviceStateFatalError
 };
 
-#define OPUS_FRAME_DURATION_MS 60
-#define MAX_AUDIO_PACKETS_IN_QUEUE (2400 / OPUS_FRAME_DURATION_MS)
+#define AUDIO_DECODE_POLL_MS 10     // 没有新包时解码任务检查抖动缓冲的间隔
 
 #if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824
     #define IRIS_MIN      300 // Clip lower analogRead() range from IRIS_PIN
@@ -101,21 +86,58 @@ enum DeviceState {
     #endif // MACRO
 
     #define  LINES_PER_BATCH 10 //缓冲区的行数为10行
+    #define  EYE_MAX_SCREEN_SIZE 240   //固件支持的最大魔眼屏幕尺寸
+    #define  EYE_MAX_BATCH_COUNT ((EYE_MAX_SCREEN_SIZE + LINES_PER_BATCH - 1) / LINES_PER_BATCH)  //每帧最多的批次数
+    #define  EYE_LINE_BUF_COUNT 3 //常驻DMA行缓冲环的深度，保证合成下一批时上一批仍可在SPI上传输
+    #define  EYE_IRIS_CURVE_SEGMENTS 64    //虹膜缩放曲线的最大分段数，对应原递归split的最深一层
+    #define  EYE_IRIS_CURVE_DURATION_US 5000000L   //每段虹膜缩放曲线的时长
 
     #define NOBLINK 0     // Not currently engaged in a blink
     #define ENBLINK 1     // Eyelid is currently closing
     #define DEBLINK 2     // Eyelid is currently opening
     #define BUFFER_SIZE 1024 // 64 to 512 seems optimum = 30 fps for default eye
 
-    #define NUM_EYES (1)    //定义眼睛数量
-    #if CONFIG_LCD_GC9A01_240X240
-        #define DISPLAY_SIZE 240    //显示尺寸
-    #elif CONFIG_LCD_GC9A01_160X160
-        #define DISPLAY_SIZE 160    //
+    #if CONFIG_USE_EYE_STYLE_ES8311
+        #define NUM_EYES (2)    //双屏板每块屏幕独立渲染一只眼睛
     #else
-        #define DISPLAY_SIZE 240    //显示尺寸
+        #define NUM_EYES (1)    //定义眼睛数量
     #endif
 
+    // 魔眼渲染各阶段的耗时统计（微秒），开启CONFIG_EYE_RENDER_PROFILE后在EYE_Task日志中输出
+    struct EyeProfile {
+        uint32_t count = 0;
+        uint32_t total_us = 0;
+        uint32_t max_us = 0;
+        void Add(uint32_t us) {
+            count++;
+            total_us += us;
+            if (us > max_us) max_us = us;
+        }
+        uint32_t Avg() const { return count ? total_us / count : 0; }
+        void Reset() { count = total_us = max_us = 0; }
+    };
+
+    // 魔眼贴图所在的存储层级
+    enum EyeTier : uint8_t {
+        kEyeTierFlash,      // 仍在映射的Flash中，合成时可能因Flash cache未命中而停顿
+        kEyeTierPsram,
+        kEyeTierInternal,
+    };
+
+    // 当前样式贴图的放置情况，GetEyePlacementStats()返回
+    struct EyePlacementStats {
+        EyeTier iris_tier;
+        EyeTier sclera_tier;
+        uint16_t sclera_rows;           // 巩膜总行数
+        uint16_t sclera_rows_placed;    // 已复制到RAM的巩膜行数
+        uint32_t internal_bytes;        // 复制占用的内部RAM
+        uint32_t psram_bytes;           // 复制占用的PSRAM
+        uint32_t copy_us_max;           // 切换样式后单帧复制耗时的最大值
+        uint32_t settle_us;             // 切换样式到全部贴图就位的耗时，0表示仍在复制
+        uint32_t free_internal;
+        uint32_t free_psram;
+    };
+
     //跟动画有关
 const uint8_t ease[] = { // Ease in/out curve for eye movements 3*t^2-2*t^3
     0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  2,  2,  2,  3,   // T
@@ -173,19 +195,28 @@ public:
 #endif  
 
 #if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824  //如果开启魔眼显示
- // 眼睛状态和位置
-    bool is_blink;
-    bool is_track;
-    int16_t eyeNewX;    //新眼睛位置
-    int16_t eyeNewY;    //新眼睛位置
-    uint8_t eye_style_num;  //眼睛样式
-    // 眼睛图形数据指针
-    const uint16_t *sclera;
-    const uint8_t *upper;
-    const uint8_t *lower;
-    const uint16_t *polar;
-    const uint16_t *iris;
-    void eye_style(uint8_t eye_style);
+    uint8_t eye_style_num;  //当前显示的眼睛样式，从1开始
+    void eye_style(uint8_t eye_style);  //切换样式，在帧边界预取并换上，按CONFIG_EYE_STYLE_FADE_FRAMES淡入
+    bool SetEyeStyle(const std::string& name);  //按名字切换样式，没有该样式时返回false
+    std::string GetEyeStyleName();  //当前样式的名字
+    std::vector<std::string> GetEyeStyleNames();    //所有可用样式的名字，按样式编号排列
+    //其他任务修改注视点、眨眼、跟踪和巩膜都通过邮箱发布，一次发布的字段在同一帧生效
+    void PostEyeCommand(const EyeCommand& command) { eye_mailbox_.Publish(command); }
+    void SetEyeSclera(EyeSclera index) {
+        EyeCommand command = {};
+        command.sclera = index;
+        command.changed = EYE_COMMAND_SCLERA;
+        eye_mailbox_.Publish(command);
+    }
+    void Wink(uint8_t e);   //让指定的眼睛单独眨一次，单目时等同于眨眼
+    void SetEyeTiledRender(bool enable) { eye_tiled_.store(enable); }   //运行时切换双核分块渲染
+    bool IsEyeTiledRender() const { return eye_tiled_.load(); }
+    void InvalidateEye() { eye_invalidate_.store(true); }   //下一帧强制整屏重绘
+    uint32_t GetEyeDamagePermille() const { return eye_damage_permille_; }  //最近统计周期内实际重绘的行占比(千分比)
+    EyePlacementStats GetEyePlacementStats() const;    //当前样式贴图的放置层级、占用和复制耗时
+    //调色板贴图整体着色：color为RGB565，strength为0~255，0时取消；只替换调色板，不需要新贴图
+    void SetEyeTint(uint16_t color, uint8_t strength) { eye_tint_.store((uint32_t)color << 16 | strength); }
+    bool SetEyeEmotion(const char* emotion);    //切换到表情的关键帧动画（注视、眼睑、瞳孔、眨眼和着色），下一帧生效；没有该表情时返回false
     int linear_map(int x, int in_min, int in_max, int out_min, int out_max);
     int random_range(int min, int max);
     int random_max(int max);
@@ -210,17 +241,39 @@ private:
 
     bool aborted_ = false;
     bool voice_detected_ = false;
-    bool busy_decoding_audio_ = false;
     int clock_ticks_ = 0;
     TaskHandle_t check_new_version_task_handle_ = nullptr;
 
     // Audio encode / decode
     TaskHandle_t audio_loop_task_handle_ = nullptr;
+    TaskHandle_t audio_decode_task_handle_ = nullptr;
+    std::atomic<bool> audio_decode_stop_{false};
     BackgroundTask* background_task_ = nullptr;
     std::chrono::steady_clock::time_point last_output_time_;
-    std::list<AudioStreamPacket> audio_send_queue_;
-    std::list<AudioStreamPacket> audio_decode_queue_;
-    std::condition_variable audio_decode_cv_;
+    // 发送方向由编码所在的任务写入、主循环发送；接收方向由网络任务（播放提示音时为调用者）写入、解码任务读取。
+    // 接收方向有两个写入者，用audio_decode_push_mutex_串行化（只在入队的瞬间持有，不跨越等待），读取的解码任务不加锁
+    SpscRing<AudioStreamPacket> audio_send_queue_{MAX_AUDIO_PACKETS_IN_QUEUE, RingOverflow::kDropOldest};
+    SpscRing<AudioStreamPacket> audio_decode_queue_{MAX_AUDIO_PACKETS_IN_QUEUE, RingOverflow::kDropNewest};
+    std::mutex audio_decode_push_mutex_;
+    // 下行音频的抖动缓冲，只在解码任务中使用；其他任务通过ClearDecodeQueue()请求清空
+    AudioJitterBuffer audio_jitter_;
+    std::atomic<bool> audio_jitter_reset_{false};
+    std::atomic<int> audio_jitter_depth_{0};
+    std::atomic<bool> playback_active_{false};  //抖动缓冲正在播放一段语音
+    // 解码任务写入、音频任务写入I2S的PCM，使用编解码芯片的输出采样率；编解码芯片自己解码Opus时不使用
+    std::unique_ptr<PcmRing> output_pcm_;
+    std::vector<int16_t> output_chunk_;     //音频任务从输出环读出、写入I2S的缓冲
+    AudioOutputPacer output_pacer_;         //估计I2S的DMA缓冲中还没播放的音频（只在音频任务中使用）
+    bool output_started_ = false;           //本段语音已经写过I2S，之后读空才算欠载（只在音频任务中使用）
+    uint32_t codec_buffered_until_ms_ = 0;  //编解码芯片自己解码时，已写入的音频估计播放到的时间
+    std::atomic<uint32_t> output_underruns_{0};     //播放中输出环被读空的次数
+    std::atomic<uint32_t> decode_stalls_{0};        //输出环满、解码任务等待I2S写入的次数
+    // 进入说话状态到收到第一个包、第一次写入音频的时间
+    int64_t speaking_start_us_ = 0;
+    std::atomic<bool> first_packet_pending_{false};
+    std::atomic<bool> first_audio_pending_{false};
+    std::atomic<int> first_packet_ms_{-1};
+    std::atomic<int> first_audio_ms_{-1};
 
     // 新增：用于维护音频包的timestamp队列
     std::list<uint32_t> timestamp_queue_;
@@ -233,6 +286,21 @@ private:
     OpusResampler reference_resampler_;
     OpusResampler output_resampler_;
 
+    // 输入PCM帧池，在唤醒词和音频处理器初始化后按两者的喂入大小创建；不经过AFE时输入帧直接排队编码
+    std::unique_ptr<AudioFramePool> audio_frames_;
+    AudioFrameHandoff encode_frames_{AUDIO_PROCESSOR_OUTPUT_FRAMES};    //等待后台任务编码的帧
+    // 主循环发送后把包还回来，编码时取出复用，payload的容量保留，编码直接写进去
+    SpscRing<AudioStreamPacket> audio_packet_pool_{AUDIO_PACKET_POOL_SIZE, RingOverflow::kDropNewest};
+    // 编码统计，每次打印后清零
+    std::atomic<uint32_t> encode_count_{0};
+    std::atomic<uint32_t> encode_time_us_{0};
+    std::atomic<uint32_t> encode_max_us_{0};
+    std::atomic<uint32_t> encode_max_batch_{0};     //一次唤醒编码的最多帧数，大于1说明编码落后了
+    std::atomic<uint32_t> packet_pool_misses_{0};   //包池为空、新建包的次数
+    // 只在解码任务中使用的解码和重采样缓冲，容量增长到最大的包后不再分配
+    std::vector<int16_t> decode_pcm_;
+    std::vector<int16_t> output_resampled_;
+
 #if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824  //如果开启魔眼显示
      // 声明眼睛状态相关变量
     typedef struct {    //眨眼状态
@@ -242,11 +310,116 @@ private:
     } eyeBlink;
     struct {    //存放所有眼睛的数组
         eyeBlink    blink;   // Current blink state
-    } eye[1];
+        uint16_t    lidFollow;   // 上眼睑跟随瞳孔的平滑阈值，8.8定点
+    } eye[NUM_EYES];
+    uint32_t eye_lid_follow_time_ = 0;  //上一次更新眼睑跟随的时间
+    // 当前屏幕分辨率的魔眼数据和编译期特化的合成函数，固件可以同时包含多种分辨率
+    const EyeAssets* eye_assets_ = nullptr;
+    uint16_t eye_batch_count_ = 0;  //每帧的批次数
+#if CONFIG_EYE_ASSET_PACK
+    // eye_assets分区中的魔眼资源包，贴图指针直接指向mmap出来的flash
+    EyePack eye_pack_ = {};
+    EyeAssets eye_pack_assets_ = {};
+    esp_partition_mmap_handle_t eye_pack_mmap_ = 0;
+    std::vector<const uint16_t*> eye_pack_iris_;    //压缩资源包中各样式解码后的虹膜
+#endif
+    // frame()为每只眼睛算好的渲染参数，由渲染任务读取
+    EyeRenderParams eye_render_params_[NUM_EYES];
+    std::atomic<uint8_t> eye_wink_request_{0};  //待执行单眼眨眼的眼睛位掩码
+    EyeMailbox eye_mailbox_;
+
+    // 眼睛状态和位置，只由魔眼任务读写，其他任务通过eye_mailbox_修改
+    bool is_blink;
+    bool is_track;
+    int16_t eyeNewX;    //新眼睛位置
+    int16_t eyeNewY;    //新眼睛位置
+    // 眼睛图形数据指针，指向当前分辨率的魔眼数据；只在帧开始时由CommitEyeStyle一起更换
+    const uint16_t *sclera = nullptr;
+    const uint16_t *iris = nullptr;
+
+    // 样式切换：请求在帧开始时预取，下一帧开始时换上；淡入期间用旧样式的原贴图另外合成一份再混合
+    EyeStyleManager eye_styles_;
+    uint8_t eye_sclera_override_ = EYE_SCLERA_OF_STYLE;    //当前样式上触摸换上的巩膜，随样式一起在CommitEyeStyle中更新
+    const uint16_t* eye_fade_sclera_ = nullptr;
+    const uint16_t* eye_fade_iris_ = nullptr;
+    uint16_t eye_fade_sclera_lut_[EYE_PALETTE_SIZE];    //旧样式的调色板（含着色）
+    uint16_t eye_fade_iris_lut_[EYE_PALETTE_SIZE];
+    EyeFrameTables eye_fade_tables_[NUM_EYES] = {};
+    uint16_t* eye_fade_scratch_[2] = {};    //每个核一份旧样式的合成缓冲，申请失败时直接切换
+    int eye_fade_weight_ = EYE_FADE_ONE;    //本帧新样式所占的比例
+
+    // 双核分块渲染：每帧的(眼睛, 批次)作为任务，两个渲染任务通过原子索引无锁领取，
+    // 每只眼睛按批次顺序提交到SPI，保证输出与单任务渲染一致
+#if CONFIG_EYE_TILED_RENDER
+    std::atomic<bool> eye_tiled_{true};
+#else
+    std::atomic<bool> eye_tiled_{false};
+#endif
+    bool eye_frame_tiled_ = false;  //本帧采用的模式，在frame()开始时锁存
+    std::atomic<uint32_t> eye_tile_next_{0};    //下一个待领取的分块任务
+    std::atomic<uint16_t> eye_tile_submit_[NUM_EYES];   //每只眼睛下一个允许提交的批次
+    EventGroupHandle_t eye_tile_events_ = nullptr;  //第e位：第e只眼睛的eye_tile_submit_前进了，等待轮到自己的渲染任务阻塞在这里
+    uint32_t eye_tile_jobs_[2] = {};    //每个核完成的分块数，用于统计负载分配
+    // 分块任务列表，只包含本帧有变化的批次：低8位为眼睛，次8位为批次号，高16位为该眼睛本帧的提交序号
+    uint32_t eye_tile_list_[NUM_EYES * EYE_MAX_BATCH_COUNT];
+    uint32_t eye_tile_count_ = 0;
+
+    // 脏矩形：和上一帧比较渲染参数，只重绘受影响的批次
+    EyeRenderParams eye_prev_params_[NUM_EYES];
+    const uint16_t* eye_prev_sclera_[NUM_EYES] = {};
+    const uint16_t* eye_prev_iris_[NUM_EYES] = {};
+    std::atomic<bool> eye_invalidate_{true};
+    uint32_t eye_damage_[NUM_EYES] = {};    //本帧需要重绘的批次位掩码
+    uint8_t eye_damage_count_[NUM_EYES] = {};   //本帧需要重绘的批次数
+    EyeLidRowRanges eye_lid_ranges_;    //每行眼睑阈值图的最小/最大值，用于判断阈值变化会影响哪些行
+    uint32_t eye_rows_sent_ = 0;    //统计周期内实际重绘的行数
+    uint32_t eye_rows_total_ = 0;   //统计周期内整屏重绘应有的行数
+    uint32_t eye_damage_permille_ = 1000;
+
+    // 虹膜查找表：极坐标图的极角在选定魔眼数据时换算成贴图列，半径表只在iScale变化时重建
+    uint16_t* eye_polar_lut_ = nullptr;
+    const EyeAssets* eye_polar_lut_assets_ = nullptr;
+    int32_t eye_iris_rows_[EYE_IRIS_RADIUS_COUNT];
+    uint32_t eye_iris_rows_scale_ = UINT32_MAX;
+
+    // 贴图分层放置：切换样式后虹膜整张复制到内部RAM（超出预算则PSRAM），
+    // Flash中的巩膜按离注视目标由近到远逐帧复制到PSRAM，已复制的行通过行表直接读副本
+    const uint16_t* eye_place_iris_src_ = nullptr;
+    const uint16_t* eye_place_sclera_src_ = nullptr;
+    uint16_t* eye_place_iris_ = nullptr;
+    uint16_t* eye_place_sclera_ = nullptr;
+    std::vector<const void*> eye_place_rows_;
+    int64_t eye_place_start_us_ = 0;
+    EyePlacementStats eye_place_stats_ = {};
+
+    // 调色板贴图的调色板副本，着色只替换这两张表
+    uint16_t eye_sclera_lut_[EYE_PALETTE_SIZE];
+    uint16_t eye_iris_lut_[EYE_PALETTE_SIZE];
+    const uint16_t* eye_lut_sclera_src_ = nullptr;
+    const uint16_t* eye_lut_iris_src_ = nullptr;
+    std::atomic<uint32_t> eye_tint_{0};     //着色请求：高16位为RGB565颜色，低8位为强度
+    uint32_t eye_tint_applied_ = 0;
+    EyeFrameTables eye_tables_[NUM_EYES] = {};  //本帧每只眼睛合成使用的贴图和查找表
+    EyeRowCache eye_sclera_cache_[NUM_EYES] = {};   //巩膜压缩时每只眼睛的行缓存
+
+    // 表情关键帧动画：SetEyeEmotion只写入请求，frame()开始时切换，不申请内存
+    EyeEmotionTable eye_emotions_ = {};
+    EyeTimeline eye_timeline_ = {};
+    std::atomic<uint8_t> eye_emotion_request_{0};   //待切换的表情编号 + 1，0为没有请求
+
+    // 渲染耗时统计：frame为运动/眨眼计算，render为一帧的合成和提交，compose/wait按核统计
+    EyeProfile eye_prof_frame_;
+    EyeProfile eye_prof_render_;
+    EyeProfile eye_prof_compose_[2];
+    EyeProfile eye_prof_wait_[2];
     
 
     uint16_t oldIris;
     uint16_t newIris;
+    // 虹膜缩放曲线：split预先生成的关键点，每个调度帧按时间插值
+    uint16_t eye_iris_curve_[EYE_IRIS_CURVE_SEGMENTS + 1];
+    uint64_t eye_iris_curve_start_ = 0;
+    uint32_t eye_frames_skipped_ = 0;   //统计周期内因超时丢弃的帧时隙
     
     // 时间相关变量，按逻辑顺序声明
     uint32_t startTime;  // For FPS indicator
@@ -254,6 +427,13 @@ private:
     uint32_t timeToNextBlink;   //记录下一次眨眼事件的时间间隔（以微秒为单位）
     
     TaskHandle_t eye_loop_task_handle_ = NULL;   //魔眼更新任务的句柄
+    TaskHandle_t eye_render_task_handle_ = NULL; //双目时在另一个核上渲染其余眼睛的任务句柄
+    // 常驻DMA行缓冲环，由魔眼任务启动时一次性申请，避免每帧malloc/free造成内部SRAM碎片
+    // 每只眼睛各有一组，两个核同时合成时互不干扰
+    uint16_t* eye_line_buf_[NUM_EYES][EYE_LINE_BUF_COUNT] = {};
+    uint8_t eye_line_buf_idx_[NUM_EYES] = {};   //下一个可用的行缓冲索引，跨帧保持
+    EyeFlushToken eye_line_token_[NUM_EYES][EYE_LINE_BUF_COUNT] = {};  //每个行缓冲最近一次提交的刷新令牌
+    uint32_t eye_frame_count_ = 0;   //已绘制帧数，用于帧率统计
     // static const uint8_t ease[];
 
     #if CONFIG_USE_EYE_STYLE_ES8311
@@ -266,15 +446,30 @@ private:
     void MainEventLoop();
     void OnAudioInput();
     void OnAudioOutput();
-    bool ReadAudio(std::vector<int16_t>& data, int sample_rate, int samples);
+    bool ReadAudio(AudioFrame& frame, int sample_rate, int samples);
 #ifdef CONFIG_USE_AUDIO_CODEC_ENCODE_OPUS
     bool ReadAudio(std::vector<uint8_t>& opus, int sample_rate, int samples);
 #endif
-    void WriteAudio(std::vector<int16_t>& data, int sample_rate);
+    void WriteAudio(const std::vector<int16_t>& data, int sample_rate);
 #ifdef CONFIG_USE_AUDIO_CODEC_DECODE_OPUS
-    void WriteAudio(std::vector<uint8_t>& opus, int sample_rate);
+    void WriteAudio(std::vector<uint8_t>& opus);
 #endif
+    void WritePlayback(const int16_t* data, size_t samples);
+    void AudioDecodeLoop();
+    void DrainDecodeQueue();
+    bool DecodeNextFrame();
+    void NotifyDecoder();
+    void MarkFirstAudio();
     void ResetDecoder();
+    void PrintAudioQueueStats();
+    void PrintEncoderStats();
+    void EncodeAudioFrames();
+    int EncodeBufferedAudio();
+    void AcquireAudioPacket(AudioStreamPacket& packet);
+    bool StampOutgoingPacket(AudioStreamPacket& packet);
+    void PrintJitterStats();
+    void ClearDecodeQueue();
+    bool IsDecodeQueueEmpty();
     void SetDecodeSampleRate(int sample_rate, int frame_duration);
     void CheckNewVersion();
     void ShowActivationCode();
@@ -283,14 +478,34 @@ private:
     void AudioLoop();
 #if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824  //如果开启魔眼显示
     void EyeLoop();
+    void EyeRenderLoop();
+    bool AllocEyeLineBuffers();
+    bool BuildEyePolarTable();
+    bool AllocEyeScleraCache();
+    void PlaceEyeTextures(int targetY);
+    void UpdateEyePalettes();
     void drawEye(uint8_t e, uint32_t iScale, uint32_t scleraX, uint32_t scleraY, uint32_t uT, uint32_t lT);
+    void submitEyeBatch(uint8_t e, uint16_t screenY, uint8_t lines, uint8_t bufIdx);
+    void RunEyeTiles(int worker);
+    void WaitEyeTileSubmit(uint8_t e, int seq);
+    bool SelectEyeAssets(int screen_size);
+    bool LoadEyeAssetPack(int screen_size);
+    const uint16_t* GetEyePackIris(int style);
+    int FindEyeStyle(const std::string& name);
+    bool ResolveEyeStyle(uint8_t style, const uint16_t** styleSclera, const uint16_t** styleIris);
+    void CommitEyeStyle(const EyeStyleManager::Staged& staged);
+    void UpdateEyeStyle();
+    uint32_t ComputeEyeDamage(uint8_t e, bool full);
     void frame(uint16_t iScale);
     void split(int16_t  startValue, // 虹膜缩放的起始值
         int16_t  endValue,   // 虹膜缩放的结束值
-        uint64_t startTime,  // 开始时间（使用`esp_timer_get_time()`获取）
-        int32_t  duration,   // 动画持续时间（微秒）
+        uint16_t first,      // 本段在曲线中的起始关键点
+        uint16_t count,      // 本段包含的分段数
         int16_t  range
     );
+    uint16_t EyeIrisAt(uint64_t now);
+    TickType_t EyeFramePeriod();
+    void LogEyeStats(uint64_t nowUs);
    
 #endif
 };
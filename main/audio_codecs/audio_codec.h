@@ -10,9 +10,8 @@
 #include <functional>
 
 #include "board.h"
+#include "audio_config.h"
 
-#define AUDIO_CODEC_DMA_DESC_NUM 6
-#define AUDIO_CODEC_DMA_FRAME_NUM 240
 #define AUDIO_CODEC_DEFAULT_MIC_GAIN 30.0
 
 class AudioCodec {
@@ -27,6 +26,9 @@ public:
     virtual void Start();
     virtual void OutputData(std::vector<int16_t>& data);
     virtual bool InputData(std::vector<int16_t>& data);
+    // 直接读写调用者的缓冲区（如AudioFrame），不需要先准备std::vector
+    void OutputData(const int16_t* data, int samples);
+    bool InputData(int16_t* data, int samples);
 #ifdef CONFIG_USE_AUDIO_CODEC_DECODE_OPUS
     virtual void OutputData(std::vector<uint8_t>& opus);
 #endif
@@ -86,7 +88,7 @@ protected:
 #endif
 
 #ifdef CONFIG_USE_AUDIO_CODEC_DECODE_OPUS
-    virtual int Write(const uint8_t* opus, int samples) = 0
+    virtual int Write(const uint8_t* opus, int samples) = 0;
 #endif
 };
 
@@ -1,5 +1,6 @@
 #include "afe_audio_processor.h"
 #include <esp_log.h>
+#include <cstring>
 
 #define PROCESSOR_RUNNING 0x01
 
@@ -53,6 +54,7 @@ void AfeAudioProcessor::Initialize(AudioCodec* codec) {
 
     afe_iface_ = esp_afe_handle_from_config(afe_config);
     afe_data_ = afe_iface_->create_from_config(afe_config);
+    output_frames_ = std::make_unique<AudioFramePool>(AUDIO_PROCESSOR_OUTPUT_FRAMES, afe_iface_->get_fetch_chunksize(afe_data_));
     
     xTaskCreate([](void* arg) {
         auto this_ = (AfeAudioProcessor*)arg;
@@ -75,11 +77,11 @@ size_t AfeAudioProcessor::GetFeedSize() {
     return afe_iface_->get_feed_chunksize(afe_data_) * codec_->input_channels();
 }
 
-void AfeAudioProcessor::Feed(const std::vector<int16_t>& data) {
+void AfeAudioProcessor::Feed(AudioFrame&& frame) {
     if (afe_data_ == nullptr) {
         return;
     }
-    afe_iface_->feed(afe_data_, data.data());
+    afe_iface_->feed(afe_data_, frame.data());
 }
 
 void AfeAudioProcessor::Start() {
@@ -97,7 +99,7 @@ bool AfeAudioProcessor::IsRunning() {
     return xEventGroupGetBits(event_group_) & PROCESSOR_RUNNING;
 }
 
-void AfeAudioProcessor::OnOutput(std::function<void(std::vector<int16_t>&& data)> callback) {
+void AfeAudioProcessor::OnOutput(std::function<void(AudioFrame&& frame)> callback) {
     output_callback_ = callback;
 }
 
@@ -137,7 +139,14 @@ void AfeAudioProcessor::AudioProcessorTask() {
         }
 
         if (output_callback_) {
-            output_callback_(std::vector<int16_t>(res->data, res->data + res->data_size / sizeof(int16_t)));
+            // 取不到帧说明编码跟不上，已经有AUDIO_PROCESSOR_OUTPUT_FRAMES帧在排队，丢弃这一帧
+            auto frame = output_frames_->Acquire(res->data_size / sizeof(int16_t));
+            if (!frame) {
+                ESP_LOGW(TAG, "No free output frame, drop %d bytes", res->data_size);
+                continue;
+            }
+            memcpy(frame.data(), res->data, frame.size() * sizeof(int16_t));
+            output_callback_(std::move(frame));
         }
     }
 }
@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <memory>
 
 #include "audio_processor.h"
 #include "audio_codec.h"
@@ -19,11 +20,11 @@ public:
     ~AfeAudioProcessor();
 
     void Initialize(AudioCodec* codec) override;
-    void Feed(const std::vector<int16_t>& data) override;
+    void Feed(AudioFrame&& frame) override;
     void Start() override;
     void Stop() override;
     bool IsRunning() override;
-    void OnOutput(std::function<void(std::vector<int16_t>&& data)> callback) override;
+    void OnOutput(std::function<void(AudioFrame&& frame)> callback) override;
     void OnVadStateChange(std::function<void(bool speaking)> callback) override;
     size_t GetFeedSize() override;
     void EnableDeviceAec(bool enable) override;
@@ -32,9 +33,10 @@ private:
     EventGroupHandle_t event_group_ = nullptr;
     esp_afe_sr_iface_t* afe_iface_ = nullptr;
     esp_afe_sr_data_t* afe_data_ = nullptr;
-    std::function<void(std::vector<int16_t>&& data)> output_callback_;
+    std::function<void(AudioFrame&& frame)> output_callback_;
     std::function<void(bool speaking)> vad_state_change_callback_;
     AudioCodec* codec_ = nullptr;
+    std::unique_ptr<AudioFramePool> output_frames_;    // fetch结果的副本，交给输出回调
     bool is_speaking_ = false;
 
     void AudioProcessorTask();
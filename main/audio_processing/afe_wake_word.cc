@@ -92,11 +92,11 @@ bool AfeWakeWord::IsDetectionRunning() {
     return xEventGroupGetBits(event_group_) & DETECTION_RUNNING_EVENT;
 }
 
-void AfeWakeWord::Feed(const std::vector<int16_t>& data) {
+void AfeWakeWord::Feed(const AudioFrame& frame) {
     if (afe_data_ == nullptr) {
         return;
     }
-    afe_iface_->feed(afe_data_, data.data());
+    afe_iface_->feed(afe_data_, frame.data());
 }
 
 size_t AfeWakeWord::GetFeedSize() {
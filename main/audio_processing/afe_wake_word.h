@@ -24,7 +24,7 @@ public:
     ~AfeWakeWord();
 
     void Initialize(AudioCodec* codec);
-    void Feed(const std::vector<int16_t>& data);
+    void Feed(const AudioFrame& frame);
     void OnWakeWordDetected(std::function<void(const std::string& wake_word)> callback);
     void StartDetection();
     void StopDetection();
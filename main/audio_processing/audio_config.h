@@ -0,0 +1,27 @@
+#ifndef AUDIO_CONFIG_H
+#define AUDIO_CONFIG_H
+
+/*
+    音频通路的缓冲大小和时长。固件和audio_processing/host中的主机测试共用，不依赖ESP-IDF，
+    主机测试直接包含这个文件，不要在测试里另外定义这些值。
+    */
+
+// 上行：一帧Opus的时长，发送队列的包数，发送后回收、保留payload容量的包数
+#define OPUS_FRAME_DURATION_MS 60
+#define MAX_AUDIO_PACKETS_IN_QUEUE (2400 / OPUS_FRAME_DURATION_MS)
+#define AUDIO_PACKET_POOL_SIZE 8
+// ReadAudio（CaptureAudioFrame）读取、拆分声道和重采样时最多同时占用的输入帧数
+#define AUDIO_READ_FRAMES 3
+// 处理器输出帧池的帧数：输出的帧在编码之前一直占用池中的一项，等待编码的帧不会超过这个数
+#define AUDIO_PROCESSOR_OUTPUT_FRAMES 8
+
+// I2S DMA缓冲：描述符个数和每个描述符的样本数（每声道）
+#define AUDIO_CODEC_DMA_DESC_NUM 6
+#define AUDIO_CODEC_DMA_FRAME_NUM 240
+
+// 解码输出：PCM环形缓冲的时长，剩余的PCM少于LEAD时解码下一帧，音频任务每次写入I2S的时长
+#define AUDIO_OUTPUT_RING_MS 180
+#define AUDIO_OUTPUT_LEAD_MS 60
+#define AUDIO_OUTPUT_CHUNK_MS 20
+
+#endif // AUDIO_CONFIG_H
@@ -7,12 +7,14 @@
 #include <sys/socket.h>
 #include <netinet/in.h>
 
+#include "audio_frame_pool.h"
+
 class AudioDebugger {
 public:
     AudioDebugger();
     ~AudioDebugger();
 
-    void Feed(const std::vector<int16_t>& data);
+    void Feed(const AudioFrame& frame);
 
 private:
     int udp_sockfd_ = -1;
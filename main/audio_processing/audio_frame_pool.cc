@@ -0,0 +1,203 @@
+#include "audio_frame_pool.h"
+
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+
+#define TAG "AudioFramePool"
+
+AudioFrame::AudioFrame(AudioFrame&& other) noexcept
+    : pool_(other.pool_), data_(other.data_), size_(other.size_) {
+    other.pool_ = nullptr;
+    other.data_ = nullptr;
+    other.size_ = 0;
+}
+
+AudioFrame& AudioFrame::operator=(AudioFrame&& other) noexcept {
+    if (this != &other) {
+        Release();
+        pool_ = other.pool_;
+        data_ = other.data_;
+        size_ = other.size_;
+        other.pool_ = nullptr;
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+size_t AudioFrame::capacity() const {
+    return pool_ != nullptr ? pool_->frame_samples() : 0;
+}
+
+bool AudioFrame::resize(size_t samples) {
+    if (samples > capacity()) {
+        return false;
+    }
+    size_ = samples;
+    return true;
+}
+
+void AudioFrame::Release() {
+    if (data_ != nullptr) {
+        pool_->Release(data_);
+    }
+    pool_ = nullptr;
+    data_ = nullptr;
+    size_ = 0;
+}
+
+AudioFramePool::AudioFramePool(size_t frames, size_t frame_samples)
+    : frames_(frames), frame_samples_(frame_samples) {
+    size_t size = frames * frame_samples * sizeof(int16_t);
+    storage_ = (int16_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (storage_ == nullptr) {
+        storage_ = (int16_t*)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    }
+    if (storage_ == nullptr) {
+        ESP_LOGE(TAG, "Failed to allocate %u frames of %u samples", (unsigned)frames, (unsigned)frame_samples);
+        frames_ = 0;
+        return;
+    }
+    free_.reserve(frames);
+    for (size_t i = frames; i > 0; i--) {
+        free_.push_back(storage_ + (i - 1) * frame_samples);
+    }
+    ESP_LOGI(TAG, "%u frames of %u samples, %u bytes", (unsigned)frames, (unsigned)frame_samples, (unsigned)size);
+}
+
+AudioFramePool::~AudioFramePool() {
+    if (free_.size() != frames_) {
+        ESP_LOGE(TAG, "Destroyed with %u frames still in use", (unsigned)(frames_ - free_.size()));
+    }
+    heap_caps_free(storage_);
+}
+
+AudioFrame AudioFramePool::Acquire(size_t samples) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_.empty() || samples > frame_samples_) {
+        failures_++;
+        return AudioFrame();
+    }
+    int16_t* data = free_.back();
+    free_.pop_back();
+    if (frames_ - free_.size() > peak_in_use_) {
+        peak_in_use_ = frames_ - free_.size();
+    }
+    return AudioFrame(this, data, samples);
+}
+
+void AudioFramePool::Release(int16_t* data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(data);
+}
+
+size_t AudioFramePool::in_use() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return frames_ - free_.size();
+}
+
+size_t AudioFramePool::peak_in_use() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return peak_in_use_;
+}
+
+uint32_t AudioFramePool::failures() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return failures_;
+}
+
+bool AudioFrameQueue::Push(AudioFrame&& frame) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (count_ == frames_.size()) {
+        return false;
+    }
+    frames_[(head_ + count_) % frames_.size()] = std::move(frame);
+    count_++;
+    return true;
+}
+
+bool AudioFrameQueue::Pop(AudioFrame& frame) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (count_ == 0) {
+        return false;
+    }
+    frame = std::move(frames_[head_]);
+    head_ = (head_ + 1) % frames_.size();
+    count_--;
+    return true;
+}
+
+void AudioFrameQueue::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (; count_ > 0; count_--) {
+        frames_[head_].Release();
+        head_ = (head_ + 1) % frames_.size();
+    }
+}
+
+size_t AudioFrameQueue::size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return count_;
+}
+
+bool CaptureAudioFrame(AudioFramePool& pool, AudioCaptureSource& source, int sample_rate, int samples, AudioFrame& frame) {
+    if (source.input_sample_rate() == sample_rate) {
+        frame = pool.Acquire(samples);
+        return frame && source.Read(frame.data(), frame.size());
+    }
+
+    auto input = pool.Acquire(samples * source.input_sample_rate() / sample_rate);
+    if (!input || !source.Read(input.data(), input.size())) {
+        return false;
+    }
+    if (source.input_channels() != 2) {
+        frame = pool.Acquire(source.ResampledSamples(input.size()));
+        if (!frame) {
+            return false;
+        }
+        source.Resample(0, input.data(), input.size(), frame.data());
+        return true;
+    }
+
+    // 先把交错的两个声道拆到channels的前后两半，分别重采样到input，再交错写入frame
+    size_t channel_samples = input.size() / 2;
+    auto channels = pool.Acquire(channel_samples * 2);
+    if (!channels) {
+        return false;
+    }
+    int16_t* mic_channel = channels.data();
+    int16_t* reference_channel = channels.data() + channel_samples;
+    for (size_t i = 0, j = 0; i < channel_samples; ++i, j += 2) {
+        mic_channel[i] = input.data()[j];
+        reference_channel[i] = input.data()[j + 1];
+    }
+    int resampled_samples = source.ResampledSamples(channel_samples);
+    int16_t* resampled_mic = input.data();
+    int16_t* resampled_reference = input.data() + resampled_samples;
+    source.Resample(0, mic_channel, channel_samples, resampled_mic);
+    source.Resample(1, reference_channel, channel_samples, resampled_reference);
+    frame = pool.Acquire(resampled_samples * 2);
+    if (!frame) {
+        return false;
+    }
+    for (int i = 0, j = 0; i < resampled_samples; ++i, j += 2) {
+        frame.data()[j] = resampled_mic[i];
+        frame.data()[j + 1] = resampled_reference[i];
+    }
+    return true;
+}
+
+bool AudioFrameHandoff::Push(AudioFrame&& frame, bool* schedule) {
+    *schedule = false;
+    if (!frames_.Push(std::move(frame))) {
+        return false;
+    }
+    *schedule = !scheduled_.exchange(true);
+    return true;
+}
+
+// 先清标志再检查队列：清之前入队的帧由这次取走，之后入队的帧已经由生产者重新安排了消费者
+bool AudioFrameHandoff::Finish() {
+    scheduled_ = false;
+    return frames_.size() != 0 && !scheduled_.exchange(true);
+}
@@ -0,0 +1,136 @@
+#ifndef AUDIO_FRAME_POOL_H
+#define AUDIO_FRAME_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/*
+    预先分配的PCM帧池：启动时按帧数和每帧的最大样本数一次性申请存储，之后取帧、还帧只操作空闲链表，不再分配内存。
+    AudioFrame是从池中取出的一帧，只能移动，析构时自动还给所属的池；帧从读取、重采样、AFE一直传到编码，
+    中间不再拷贝成新的std::vector。池用尽时取到的是空帧，调用者丢弃这一帧即可，不会去抢剩余的内部RAM。
+    */
+class AudioFramePool;
+
+class AudioFrame {
+public:
+    AudioFrame() = default;
+    AudioFrame(AudioFrame&& other) noexcept;
+    AudioFrame& operator=(AudioFrame&& other) noexcept;
+    AudioFrame(const AudioFrame&) = delete;
+    AudioFrame& operator=(const AudioFrame&) = delete;
+    ~AudioFrame() { Release(); }
+
+    explicit operator bool() const { return data_ != nullptr; }
+    int16_t* data() { return data_; }
+    const int16_t* data() const { return data_; }
+    size_t size() const { return size_; }
+    size_t capacity() const;
+    // 改变有效样本数，超过capacity()时返回false且不改变
+    bool resize(size_t samples);
+    // 提前把存储还给池，之后是空帧
+    void Release();
+
+private:
+    friend class AudioFramePool;
+    AudioFrame(AudioFramePool* pool, int16_t* data, size_t size) : pool_(pool), data_(data), size_(size) {}
+
+    AudioFramePool* pool_ = nullptr;
+    int16_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+class AudioFramePool {
+public:
+    // 存储优先放在PSRAM，没有时使用内部RAM；池必须比从中取出的所有帧活得更久
+    AudioFramePool(size_t frames, size_t frame_samples);
+    ~AudioFramePool();
+    AudioFramePool(const AudioFramePool&) = delete;
+    AudioFramePool& operator=(const AudioFramePool&) = delete;
+
+    // 取一帧，有效样本数为samples；池已用尽或samples超过每帧的容量时返回空帧
+    AudioFrame Acquire(size_t samples);
+
+    size_t frames() const { return frames_; }
+    size_t frame_samples() const { return frame_samples_; }
+    size_t in_use();            // 当前被取出的帧数
+    size_t peak_in_use();       // 取出帧数的最大值
+    uint32_t failures();        // 取帧失败的次数
+
+private:
+    friend class AudioFrame;
+    void Release(int16_t* data);
+
+    std::mutex mutex_;
+    size_t frames_;
+    size_t frame_samples_;
+    int16_t* storage_ = nullptr;
+    std::vector<int16_t*> free_;    // 容量在构造时预留为frames_，之后push/pop不分配内存
+    size_t peak_in_use_ = 0;
+    uint32_t failures_ = 0;
+};
+
+// 麦克风输入：固件中是音频编解码芯片和重采样器，主机测试中用模拟的输入代替
+class AudioCaptureSource {
+public:
+    virtual ~AudioCaptureSource() = default;
+    virtual int input_sample_rate() = 0;
+    virtual int input_channels() = 0;
+    // 读取samples个交错的输入样本
+    virtual bool Read(int16_t* data, size_t samples) = 0;
+    // 每个声道samples个样本重采样后的样本数
+    virtual int ResampledSamples(size_t samples) = 0;
+    // 重采样一个声道：channel为0是麦克风，1是回采参考
+    virtual void Resample(int channel, const int16_t* input, size_t samples, int16_t* output) = 0;
+};
+
+/*
+    从source采集samples个sample_rate采样率的样本到frame，每个声道交错排列。
+    需要重采样时输入和拆分的声道放在池中的临时帧里，函数返回时归还，最多同时占用池中的AUDIO_READ_FRAMES帧。
+    池用尽或读取失败时返回false，不分配内存。
+    */
+bool CaptureAudioFrame(AudioFramePool& pool, AudioCaptureSource& source, int sample_rate, int samples, AudioFrame& frame);
+
+// 固定容量的AudioFrame先进先出队列，用于在任务之间传递帧；容量在构造时确定，入队出队都不分配内存
+class AudioFrameQueue {
+public:
+    explicit AudioFrameQueue(size_t capacity) : frames_(capacity) {}
+
+    // 队列满时返回false，frame保持不变（由调用者丢弃或重试）
+    bool Push(AudioFrame&& frame);
+    // 取出最早入队的帧，队列为空时返回false
+    bool Pop(AudioFrame& frame);
+    void Clear();
+    size_t size();
+
+private:
+    std::mutex mutex_;
+    std::vector<AudioFrame> frames_;
+    size_t head_ = 0;
+    size_t count_ = 0;
+};
+
+/*
+    把帧交给按需安排的消费者（后台任务中的编码阶段）：生产者入队后，只有消费者没有在运行或等待运行时才需要安排一次；
+    消费者取空队列后调用Finish()，清标志前后又有帧入队、而生产者没有另外安排时返回true，由它继续取。
+    每个入队的帧都会被取走，同一时间最多只有一个消费者。主机上的多线程测试见audio_processing/host。
+    */
+class AudioFrameHandoff {
+public:
+    explicit AudioFrameHandoff(size_t capacity) : frames_(capacity) {}
+
+    // 生产者：队列满时返回false，frame保持不变；入队成功且*schedule为true时调用者要安排一次消费者
+    bool Push(AudioFrame&& frame, bool* schedule);
+    // 消费者
+    bool Pop(AudioFrame& frame) { return frames_.Pop(frame); }
+    bool Finish();
+    size_t size() { return frames_.size(); }
+
+private:
+    AudioFrameQueue frames_;
+    std::atomic<bool> scheduled_{false};
+};
+
+#endif // AUDIO_FRAME_POOL_H
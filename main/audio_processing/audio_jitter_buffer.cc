@@ -0,0 +1,269 @@
+#include "audio_jitter_buffer.h"
+
+#include <utility>
+
+#define JITTER_MAX_BOOST 3              // 欠载后最多临时加深的帧数
+#define JITTER_BOOST_DECAY_FRAMES 100   // 连续正常播放这么多帧后减少一帧临时深度
+
+AudioJitterBuffer::AudioJitterBuffer() {
+    for (int i = 0; i < JITTER_BUFFER_SLOTS; i++) {
+        slot_sequence_[i] = 0;
+        slot_present_[i] = false;
+    }
+}
+
+void AudioJitterBuffer::Reset() {
+    for (int i = 0; i < JITTER_BUFFER_SLOTS; i++) {
+        if (slot_present_[i]) {
+            slots_[i] = AudioStreamPacket();
+            slot_present_[i] = false;
+        }
+    }
+    count_ = 0;
+    started_ = false;
+    played_ = false;
+    playing_ = false;
+    starved_ = false;
+    conceal_run_ = 0;
+    expand_pending_ = 0;
+    has_transit_ = false;
+}
+
+void AudioJitterBuffer::ResetStats() {
+    late_ = duplicate_ = overflow_ = received_ = 0;
+    lost_ = recovered_ = concealed_ = skipped_ = expanded_ = underruns_ = 0;
+}
+
+int AudioJitterBuffer::target_depth() const {
+    int depth = JITTER_MIN_DEPTH + (jitter_q4_ / 16 + frame_ms_ - 1) / frame_ms_ + underrun_boost_;
+    if (depth > JITTER_MAX_DEPTH) {
+        depth = JITTER_MAX_DEPTH;
+    }
+    return depth;
+}
+
+JitterBufferStats AudioJitterBuffer::stats() const {
+    JitterBufferStats stats;
+    stats.received = received_;
+    stats.late = late_;
+    stats.duplicate = duplicate_;
+    stats.overflow = overflow_;
+    stats.lost = lost_;
+    stats.recovered = recovered_;
+    stats.concealed = concealed_;
+    stats.skipped = skipped_;
+    stats.expanded = expanded_;
+    stats.underruns = underruns_;
+    stats.jitter_ms = jitter_q4_ / 16;
+    stats.target_depth = target_depth();
+    stats.depth = count_;
+    return stats;
+}
+
+bool AudioJitterBuffer::Has(uint32_t sequence) const {
+    int index = sequence % JITTER_BUFFER_SLOTS;
+    return slot_present_[index] && slot_sequence_[index] == sequence;
+}
+
+void AudioJitterBuffer::Take(uint32_t sequence, AudioStreamPacket& packet) {
+    int index = sequence % JITTER_BUFFER_SLOTS;
+    packet = std::move(slots_[index]);
+    slot_present_[index] = false;
+    count_--;
+}
+
+// 缓存窗口[next_sequence_, next_sequence_ + JITTER_BUFFER_SLOTS)中最早的包
+bool AudioJitterBuffer::FirstPresent(uint32_t* sequence) const {
+    for (uint32_t i = 0; i < JITTER_BUFFER_SLOTS; i++) {
+        if (Has(next_sequence_ + i)) {
+            *sequence = next_sequence_ + i;
+            return true;
+        }
+    }
+    return false;
+}
+
+void AudioJitterBuffer::Start(uint32_t sequence, uint32_t now_ms) {
+    started_ = true;
+    next_sequence_ = sequence;
+    max_sequence_ = sequence;
+    buffering_since_ms_ = now_ms;
+}
+
+void AudioJitterBuffer::UpdateJitter(uint32_t sequence, uint32_t now_ms) {
+    uint32_t transit = now_ms - sequence * (uint32_t)frame_ms_;
+    if (!has_transit_) {
+        has_transit_ = true;
+        transit_base_ = transit;
+        return;
+    }
+    int32_t lateness = (int32_t)(transit - transit_base_);
+    if (lateness < 0) {
+        transit_base_ = transit;
+        lateness = 0;
+    } else if (lateness > 0) {
+        transit_base_++;
+    }
+    if (lateness > JITTER_MAX_DEPTH * frame_ms_) {
+        lateness = JITTER_MAX_DEPTH * frame_ms_;
+    }
+    // 快升慢降：一次明显的迟到立即加深，之后十几秒内逐渐恢复
+    int32_t delta = lateness * 16 - jitter_q4_;
+    jitter_q4_ += delta > 0 ? delta / 4 : delta / 64;
+}
+
+void AudioJitterBuffer::Put(AudioStreamPacket&& packet, uint32_t now_ms) {
+    received_++;
+    if (packet.sequence == 0) {
+        packet.sequence = ++auto_sequence_;
+    }
+    if (packet.frame_duration > 0) {
+        frame_ms_ = packet.frame_duration;
+    }
+    uint32_t sequence = packet.sequence;
+
+    if (starved_ || expand_pending_ > 0) {
+        if (!starved_ || (int32_t)(now_ms - starved_since_ms_) <= JITTER_MAX_DEPTH * frame_ms_) {
+            // 放空后很快又有包到达：包迟到或丢了，加深缓冲。
+            // 迟到的是补偿过的帧时从它继续播放，补偿的帧相当于加大了播放延迟，只有它之前的帧算丢失
+            underruns_++;
+            int32_t behind = (int32_t)(next_sequence_ - sequence);
+            int lost = expand_pending_;
+            if (behind > 0 && behind <= expand_pending_) {
+                lost -= behind;
+                next_sequence_ = sequence;
+            }
+            lost_ += lost;
+            concealed_ += lost;
+            expanded_ -= lost;
+            if (underrun_boost_ < JITTER_MAX_BOOST) {
+                underrun_boost_++;
+            }
+            clean_frames_ = 0;
+            starved_ = false;
+            expand_pending_ = 0;
+        } else {
+            // 句子之间的停顿：新的一段语音，序号和传输时间重新开始
+            Reset();
+        }
+    }
+
+    if (!started_) {
+        Start(sequence, now_ms);
+    } else {
+        int32_t ahead = (int32_t)(sequence - next_sequence_);
+        if (ahead < 0) {
+            if (-ahead >= JITTER_BUFFER_SLOTS) {
+                // 序号重新开始（新的音频通道）
+                Reset();
+                Start(sequence, now_ms);
+            } else if (played_) {
+                late_++;
+                return;
+            } else if ((int32_t)(max_sequence_ - sequence) < JITTER_BUFFER_SLOTS) {
+                next_sequence_ = sequence;  // 开始播放前乱序到达的更早的包
+            } else {
+                overflow_++;
+                return;
+            }
+        } else if (ahead >= JITTER_BUFFER_SLOTS) {
+            if (count_ > 0) {
+                overflow_++;
+                return;
+            }
+            // 缓存为空时直接跳到这个包，中间的帧不会再来了
+            if (played_) {
+                lost_ += ahead;
+                skipped_ += ahead;
+            }
+            next_sequence_ = sequence;
+        }
+    }
+
+    int index = sequence % JITTER_BUFFER_SLOTS;
+    if (slot_present_[index]) {
+        duplicate_++;
+        return;
+    }
+    slots_[index] = std::move(packet);
+    slot_sequence_[index] = sequence;
+    slot_present_[index] = true;
+    count_++;
+    if ((int32_t)(sequence - max_sequence_) > 0) {
+        max_sequence_ = sequence;
+    }
+    if (count_ == 1 && !playing_) {
+        buffering_since_ms_ = now_ms;
+    }
+    UpdateJitter(sequence, now_ms);
+}
+
+JitterAction AudioJitterBuffer::Get(AudioStreamPacket& packet, uint32_t now_ms) {
+    bool resumed = false;
+    if (!playing_) {
+        if (count_ == 0) {
+            return JitterAction::kNone;
+        }
+        int target = target_depth();
+        if (count_ < target && (int32_t)(now_ms - buffering_since_ms_) < target * frame_ms_) {
+            return JitterAction::kNone;
+        }
+        playing_ = true;
+        resumed = played_;
+    }
+
+    if (Has(next_sequence_)) {
+        Take(next_sequence_, packet);
+        next_sequence_++;
+        conceal_run_ = 0;
+        played_ = true;
+        if (underrun_boost_ > 0 && ++clean_frames_ >= JITTER_BOOST_DECAY_FRAMES) {
+            underrun_boost_--;
+            clean_frames_ = 0;
+        }
+        return JitterAction::kDecode;
+    }
+
+    if (count_ == 0) {
+        // 缓冲放空：可能是包迟到或丢失，也可能是这段语音结束了，先补偿几帧再停下来等待
+        if (conceal_run_ < JITTER_MAX_CONCEAL) {
+            next_sequence_++;
+            conceal_run_++;
+            expanded_++;
+            expand_pending_++;
+            return JitterAction::kConceal;
+        }
+        playing_ = false;
+        starved_ = true;
+        starved_since_ms_ = now_ms;
+        return JitterAction::kNone;
+    }
+
+    // 下一帧缺失，但后面的包已经到了
+    lost_++;
+    played_ = true;
+    if (Has(next_sequence_ + 1)) {
+        Take(next_sequence_ + 1, packet);
+        next_sequence_ += 2;
+        conceal_run_ = 0;
+        recovered_++;
+        return JitterAction::kRecover;
+    }
+    // 放空后恢复播放时缺少的帧已经被停顿占掉了，不再补偿
+    if (!resumed && conceal_run_ < JITTER_MAX_CONCEAL) {
+        next_sequence_++;
+        conceal_run_++;
+        concealed_++;
+        return JitterAction::kConceal;
+    }
+
+    uint32_t first = next_sequence_;
+    FirstPresent(&first);
+    uint32_t missing = first - next_sequence_;
+    lost_ += missing - 1;
+    skipped_ += missing;
+    Take(first, packet);
+    next_sequence_ = first + 1;
+    conceal_run_ = 0;
+    return JitterAction::kDecode;
+}
@@ -0,0 +1,101 @@
+#ifndef AUDIO_JITTER_BUFFER_H
+#define AUDIO_JITTER_BUFFER_H
+
+#include <cstdint>
+
+#include "audio_stream_packet.h"
+
+/*
+    下行Opus包的自适应抖动缓冲，只在音频任务中使用，不加锁，也不依赖ESP-IDF（主机上的模拟见audio_processing/host）。
+    包按序号放进以序号取模的槽位，乱序到达的包在播放前自动排好；已经播放过或判定丢失之后才到的包计为迟到并丢弃。
+    每段语音开始时先缓存到目标深度再播放。目标深度由到达抖动和最近的欠载决定：
+    包的传输时间（到达时间减去序号对应的播放时间）相对本段语音中最短传输时间的延迟即该包的迟到量，
+    迟到量快升慢降地平滑后作为抖动估计；缓冲放空后很快又有包到达算作欠载，临时加深一帧，
+    放空很久才到的包是新一段语音（句子之间的停顿），不算欠载，也重新开始估计传输时间。
+    播放时缺少的帧：下一个包已到时用它携带的FEC数据恢复，否则交给解码器的PLC补偿，
+    连续补偿JITTER_MAX_CONCEAL帧后仍没有到达就跳到后面已到的包，缓冲已经放空时停下来重新缓冲。
+    */
+#define JITTER_BUFFER_SLOTS 64      // 最多缓存的包数，60ms的帧约3.8秒
+#define JITTER_MIN_DEPTH 2          // 目标缓冲深度的范围（帧）
+#define JITTER_MAX_DEPTH 8
+#define JITTER_MAX_CONCEAL 3
+
+enum class JitterAction {
+    kNone,      // 没有要播放的帧：缓冲中、已放空或没有数据
+    kDecode,    // 正常解码packet
+    kRecover,   // packet的前一帧丢失：先用packet中的FEC数据恢复前一帧，再正常解码packet
+    kConceal,   // 这一帧丢失，后面的包也还没到，用解码器的PLC补偿一帧
+};
+
+struct JitterBufferStats {
+    uint32_t received;      // 放入的包
+    uint32_t late;          // 到达时该帧已经播放或判定丢失
+    uint32_t duplicate;     // 重复的序号
+    uint32_t overflow;      // 超出缓存窗口被丢弃
+    uint32_t lost;          // 播放时缺少的帧，等于recovered + concealed + skipped
+    uint32_t recovered;     // 用FEC恢复的丢失帧
+    uint32_t concealed;     // 用PLC补偿的丢失帧
+    uint32_t skipped;       // 连续丢失太多直接跳过的帧
+    uint32_t expanded;      // 缓冲放空时PLC补偿、但不算丢失的帧：语音结束，或之后迟到的包接着播放。
+                            // 放空后很快又有包到达时，补偿帧中确实丢失的部分从这里转到concealed
+    uint32_t underruns;     // 播放中缓冲放空的次数
+    uint32_t jitter_ms;     // 到达间隔的抖动估计
+    int target_depth;       // 当前的目标缓冲深度（帧）
+    int depth;              // 当前缓存的包数
+};
+
+class AudioJitterBuffer {
+public:
+    AudioJitterBuffer();
+
+    // 新的一段语音：丢弃缓存的包和序号状态，保留抖动估计和统计
+    void Reset();
+    void ResetStats();
+
+    // 放入收到的包，now_ms为到达时间（毫秒，允许回绕）；sequence为0的包按放入顺序编号
+    void Put(AudioStreamPacket&& packet, uint32_t now_ms);
+    // 播放完上一帧后取下一帧的动作，kDecode/kRecover时packet为要解码的包
+    JitterAction Get(AudioStreamPacket& packet, uint32_t now_ms);
+
+    bool playing() const { return playing_; }
+    int depth() const { return count_; }
+    int target_depth() const;
+    JitterBufferStats stats() const;
+
+private:
+    AudioStreamPacket slots_[JITTER_BUFFER_SLOTS];
+    uint32_t slot_sequence_[JITTER_BUFFER_SLOTS];
+    bool slot_present_[JITTER_BUFFER_SLOTS];
+    int count_ = 0;
+
+    bool started_ = false;      // 收到本段语音的第一个包后next_sequence_才有效
+    bool played_ = false;       // 本段语音已经播放过帧，之后next_sequence_不再后退
+    bool playing_ = false;      // 正在播放（已缓冲到目标深度且没有放空）
+    uint32_t next_sequence_ = 0;
+    uint32_t auto_sequence_ = 0;
+    int conceal_run_ = 0;       // 连续补偿的帧数
+    uint32_t max_sequence_ = 0;         // 本段语音收到的最大序号
+    uint32_t buffering_since_ms_ = 0;   // 开始缓冲的时间，积压不够时等够目标深度对应的时长也开始播放
+    bool starved_ = false;              // 播放中放空，等待下一个包
+    int expand_pending_ = 0;            // 放空时补偿的帧数，下一个包到达后才知道是丢失还是语音结束
+    uint32_t starved_since_ms_ = 0;
+
+    // 抖动估计
+    bool has_transit_ = false;
+    uint32_t transit_base_ = 0; // 本段语音中最短的传输时间（回绕的毫秒数），每个包缓慢上移以跟随路径变化
+    int frame_ms_ = 60;
+    int32_t jitter_q4_ = 0;     // 抖动估计，1/16毫秒
+    int underrun_boost_ = 0;    // 欠载后临时加深的帧数
+    int clean_frames_ = 0;      // 上次欠载后正常播放的帧数
+
+    uint32_t late_ = 0, duplicate_ = 0, overflow_ = 0, received_ = 0;
+    uint32_t lost_ = 0, recovered_ = 0, concealed_ = 0, skipped_ = 0, expanded_ = 0, underruns_ = 0;
+
+    bool Has(uint32_t sequence) const;
+    void Take(uint32_t sequence, AudioStreamPacket& packet);
+    bool FirstPresent(uint32_t* sequence) const;
+    void Start(uint32_t sequence, uint32_t now_ms);
+    void UpdateJitter(uint32_t sequence, uint32_t now_ms);
+};
+
+#endif // AUDIO_JITTER_BUFFER_H
@@ -0,0 +1,23 @@
+#include "audio_output_pacer.h"
+#include "audio_config.h"
+
+#include <algorithm>
+
+size_t DrainAudioOutput(PcmRing& ring, AudioOutputPacer& pacer, std::vector<int16_t>& chunk,
+    const std::function<int64_t()>& now_us, const std::function<void(const int16_t* data, size_t samples)>& write) {
+    size_t total = 0;
+    while (size_t writable = std::min(pacer.Writable(now_us()), chunk.size())) {
+        size_t samples = ring.Read(chunk.data(), writable);
+        if (samples == 0) {
+            break;
+        }
+        write(chunk.data(), samples);
+        pacer.Wrote(samples, now_us());
+        total += samples;
+    }
+    return total;
+}
+
+bool AudioOutputWantsDecode(const PcmRing& ring, int sample_rate) {
+    return ring.size() <= (size_t)sample_rate * AUDIO_OUTPUT_LEAD_MS / 1000;
+}
@@ -0,0 +1,65 @@
+#ifndef AUDIO_OUTPUT_PACER_H
+#define AUDIO_OUTPUT_PACER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "pcm_ring.h"
+
+/*
+    估计I2S发送DMA缓冲中已写入、还没播放的音频，音频任务据此决定这次循环写入多少：
+    一直写到输出环读空，或DMA缓冲剩下的空间不到一个描述符（再写就会阻塞）为止。
+    音频任务每次循环还要读取麦克风，一次循环往往长于一块输出，只写一块会让播放慢于实时。
+    写入按样本数累计到播放结束的时间，超过当前时间的部分就是DMA缓冲中的积压；放空后从当前时间重新计算。
+    不依赖ESP-IDF，时间由调用者传入（微秒），主机上的测试见audio_processing/host。
+    */
+class AudioOutputPacer {
+public:
+    // sample_rate为输出采样率；DMA缓冲有descriptors个描述符，每个frame_samples个样本（每声道）
+    void Configure(int sample_rate, size_t descriptors, size_t frame_samples) {
+        sample_rate_ = sample_rate;
+        capacity_ = descriptors * frame_samples;
+        min_write_ = frame_samples;
+    }
+
+    // now_us时最多可以写入而不阻塞的样本数，不到一个描述符时为0
+    size_t Writable(int64_t now_us) const {
+        size_t buffered = (size_t)(buffered_us(now_us) * sample_rate_ / 1000000);
+        if (buffered + min_write_ > capacity_) {
+            return 0;
+        }
+        return capacity_ - buffered;
+    }
+
+    void Wrote(size_t samples, int64_t now_us) {
+        if (played_until_us_ < now_us) {
+            played_until_us_ = now_us;
+        }
+        played_until_us_ += (int64_t)samples * 1000000 / sample_rate_;
+    }
+
+    // 已写入还没播放的时长
+    int64_t buffered_us(int64_t now_us) const {
+        return played_until_us_ > now_us ? played_until_us_ - now_us : 0;
+    }
+
+private:
+    int sample_rate_ = 16000;
+    size_t capacity_ = 0;
+    size_t min_write_ = 0;
+    int64_t played_until_us_ = 0;
+};
+
+/*
+    音频任务每次循环调用：从ring读出PCM交给write写入I2S，一直写到环读空或DMA缓冲放不下一个描述符为止，
+    每块不超过chunk的大小。now_us返回当前时间（微秒），写入后按写入完成的时间记入pacer。返回写入的样本数。
+    */
+size_t DrainAudioOutput(PcmRing& ring, AudioOutputPacer& pacer, std::vector<int16_t>& chunk,
+    const std::function<int64_t()>& now_us, const std::function<void(const int16_t* data, size_t samples)>& write);
+
+// 解码任务：输出环中剩余的PCM不超过AUDIO_OUTPUT_LEAD_MS时才解码下一帧
+bool AudioOutputWantsDecode(const PcmRing& ring, int sample_rate);
+
+#endif // AUDIO_OUTPUT_PACER_H
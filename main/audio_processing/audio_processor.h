@@ -6,17 +6,19 @@
 #include <functional>
 
 #include "audio_codec.h"
+#include "audio_config.h"
+#include "audio_frame_pool.h"
 
 class AudioProcessor {
 public:
     virtual ~AudioProcessor() = default;
     
     virtual void Initialize(AudioCodec* codec) = 0;
-    virtual void Feed(const std::vector<int16_t>& data) = 0;
+    virtual void Feed(AudioFrame&& frame) = 0;
     virtual void Start() = 0;
     virtual void Stop() = 0;
     virtual bool IsRunning() = 0;
-    virtual void OnOutput(std::function<void(std::vector<int16_t>&& data)> callback) = 0;
+    virtual void OnOutput(std::function<void(AudioFrame&& frame)> callback) = 0;
     virtual void OnVadStateChange(std::function<void(bool speaking)> callback) = 0;
     virtual size_t GetFeedSize() = 0;
     virtual void EnableDeviceAec(bool enable) = 0;
@@ -59,8 +59,8 @@ bool EspWakeWord::IsDetectionRunning() {
     return xEventGroupGetBits(event_group_) & DETECTION_RUNNING_EVENT;
 }
 
-void EspWakeWord::Feed(const std::vector<int16_t>& data) {
-    int res = wakenet_iface_->detect(wakenet_data_, (int16_t *)data.data());
+void EspWakeWord::Feed(const AudioFrame& frame) {
+    int res = wakenet_iface_->detect(wakenet_data_, (int16_t *)frame.data());
     if (res > 0) {
         StopDetection();
         last_detected_wake_word_ = wakenet_iface_->get_word_name(wakenet_data_, res);
@@ -0,0 +1,291 @@
+// 上行音频的多线程压力测试，时间按比例缩短（32毫秒的AFE输出在这里是几十到几百微秒）：
+//   AFE输出任务   从8帧的输出池取帧，写入帧号，交给AudioFrameHandoff，需要时安排一次编码阶段
+//   后台任务      按Application::EncodeAudioFrames取空交接队列：每帧从包池取一个包，写入帧号后放进发送队列
+//   主循环        按Application::MainEventLoop从发送队列取包、检查帧号，发送后还回包池
+// 先在编码和发送都跟得上时运行，必须一帧不丢；再让编码和发送间歇停顿，使输出池和包池用尽，
+// 丢弃的帧和包必须都有计数；最后恢复正常运行，包池要回到满的状态。每个阶段结束时交接队列中不能留下没人取的帧，
+// 同一时间只能有一个编码阶段在运行。handshake阶段成对送帧，第二帧常在编码阶段取空队列之后、Finish之前到达，
+// 每对之后等编码结束，交接队列必须为空。默认用ThreadSanitizer编译（AUDIO_TSAN）。
+//   audio_encode_stress
+#include "audio_config.h"
+#include "audio_frame_pool.h"
+#include "audio_stream_packet.h"
+#include "spsc_ring.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+
+#define FRAME_SAMPLES 512
+
+static void SleepUs(int us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+// 与BackgroundTask相同：一个线程按顺序运行安排的任务
+class BackgroundModel {
+public:
+    BackgroundModel() : thread_([this]() { Loop(); }) {}
+    ~BackgroundModel() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_all();
+        thread_.join();
+    }
+
+    void Schedule(std::function<void()> callback) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(callback));
+        active_++;
+        condition_.notify_all();
+    }
+
+    void WaitForCompletion() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this]() { return active_ == 0; });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::list<std::function<void()>> tasks_;
+    size_t active_ = 0;
+    bool stop_ = false;
+    std::thread thread_;
+
+    void Loop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            condition_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+            if (stop_) {
+                return;
+            }
+            auto tasks = std::move(tasks_);
+            lock.unlock();
+            for (auto& task : tasks) {
+                task();
+            }
+            lock.lock();
+            active_ -= tasks.size();
+            condition_.notify_all();
+        }
+    }
+};
+
+struct Phase {
+    const char* name;
+    int frames;
+    int frame_us;               // AFE输出一帧的间隔；不允许丢帧的阶段留出足够的余量，避免主机调度的抖动造成误报
+    int encode_stall_every;     // 每编码这么多帧停顿一次，0为不停顿
+    int encode_stall_us;
+    int send_stall_every;
+    int send_stall_us;
+    int finish_delay_us;        // 交接队列取空后等这么久再Finish，放大新帧恰好在此时到达的窗口
+    int burst;                  // 大于0时每送完这么多帧等编码结束，检查交接队列中没有留下帧
+    bool expect_no_drops;
+};
+
+class Uplink {
+public:
+    bool Run(const Phase& phase) {
+        phase_ = phase;
+        uint32_t produced_before = produced_;
+        uint32_t encoded_before = encoded_;
+        uint32_t dropped_before = DroppedFrames();
+        std::atomic<bool> producing{true};
+        std::thread sender([&]() { SendLoop(producing); });
+
+        uint32_t stranded = 0;
+        auto next = std::chrono::steady_clock::now();
+        for (int i = 0; i < phase.frames; i++) {
+            next += std::chrono::microseconds(phase.frame_us);
+            std::this_thread::sleep_until(next);
+            Produce();
+            if (phase.burst && (i + 1) % phase.burst == 0) {
+                background_.WaitForCompletion();
+                if (encode_frames_.size() != 0) {
+                    stranded++;
+                    AudioFrame frame;
+                    while (encode_frames_.Pop(frame)) {
+                        frame.Release();    // 取出留下的帧，不影响后面的检查
+                        encoded_++;
+                    }
+                }
+                next = std::chrono::steady_clock::now();
+            }
+        }
+        background_.WaitForCompletion();
+        producing = false;
+        sender.join();
+
+        bool ok = true;
+        if (stranded != 0) {
+            printf("  %u bursts left frames in the handoff after the encode job finished\n", stranded);
+            ok = false;
+        }
+        uint32_t produced = produced_ - produced_before;
+        uint32_t encoded = encoded_ - encoded_before;
+        uint32_t dropped = DroppedFrames() - dropped_before;
+        auto send = send_queue_.stats();
+        printf("%-9s frames %u: encoded %u, dropped %u (pool %u, queue %u); packets acquired %u, sent %u, "
+            "dropped oldest %u, pool misses %u, pool %zu/%d\n", phase.name, produced, encoded, dropped,
+            frame_pool_.failures(), handoff_full_, acquired_.load(), sent_.load(), send.dropped_oldest, pool_misses_.load(),
+            packet_pool_.size(), AUDIO_PACKET_POOL_SIZE);
+        if (encode_frames_.size() != 0) {
+            printf("  %zu frames left in the handoff with no encode job scheduled\n", encode_frames_.size());
+            ok = false;
+        }
+        if (produced != encoded + dropped) {
+            printf("  %u frames neither encoded nor counted as dropped\n", produced - encoded - dropped);
+            ok = false;
+        }
+        if (phase.expect_no_drops && dropped != 0) {
+            printf("  frames dropped while the encoder kept up\n");
+            ok = false;
+        }
+        if (acquired_ != sent_ + send.dropped_oldest) {
+            printf("  %u packets neither sent nor dropped by the send queue\n", acquired_.load() - sent_.load() - send.dropped_oldest);
+            ok = false;
+        }
+        if (out_of_order_ != 0 || concurrent_encoders_ != 0) {
+            printf("  %u packets out of order, %u overlapping encode jobs\n", out_of_order_.load(), concurrent_encoders_.load());
+            ok = false;
+        }
+        if (frame_pool_.in_use() != 0) {
+            printf("  %zu output frames never returned to the pool\n", frame_pool_.in_use());
+            ok = false;
+        }
+        return ok;
+    }
+
+    bool PoolFull() const { return packet_pool_.size() == AUDIO_PACKET_POOL_SIZE; }
+
+private:
+    Phase phase_ = {};
+    AudioFramePool frame_pool_{AUDIO_PROCESSOR_OUTPUT_FRAMES, FRAME_SAMPLES};
+    AudioFrameHandoff encode_frames_{AUDIO_PROCESSOR_OUTPUT_FRAMES};
+    BackgroundModel background_;
+    SpscRing<AudioStreamPacket> packet_pool_{AUDIO_PACKET_POOL_SIZE, RingOverflow::kDropNewest};
+    SpscRing<AudioStreamPacket> send_queue_{MAX_AUDIO_PACKETS_IN_QUEUE, RingOverflow::kDropOldest};
+
+    // AFE输出任务
+    uint32_t produced_ = 0;
+    uint32_t handoff_full_ = 0;
+    // 后台任务
+    std::atomic<uint32_t> encoded_{0};
+    std::atomic<uint32_t> acquired_{0};
+    std::atomic<uint32_t> pool_misses_{0};
+    std::atomic<int> encoders_running_{0};
+    std::atomic<uint32_t> concurrent_encoders_{0};
+    // 主循环
+    std::atomic<uint32_t> sent_{0};
+    std::atomic<uint32_t> out_of_order_{0};
+    uint32_t last_sent_ = 0;
+
+    uint32_t DroppedFrames() { return frame_pool_.failures() + handoff_full_; }
+
+    // 与AfeAudioProcessor和Application中OnOutput的回调相同
+    void Produce() {
+        uint32_t sequence = ++produced_;
+        auto frame = frame_pool_.Acquire(FRAME_SAMPLES);
+        if (!frame) {
+            return;     // 输出池用尽，AFE丢弃这一帧（计入failures）
+        }
+        frame.data()[0] = sequence & 0xFFFF;
+        frame.data()[1] = sequence >> 16;
+        bool schedule;
+        if (!encode_frames_.Push(std::move(frame), &schedule)) {
+            handoff_full_++;
+            return;
+        }
+        if (schedule) {
+            background_.Schedule([this]() { EncodeAudioFrames(); });
+        }
+    }
+
+    void EncodeAudioFrames() {
+        if (encoders_running_.fetch_add(1) != 0) {
+            concurrent_encoders_++;
+        }
+        AudioFrame frame;
+        while (true) {
+            while (encode_frames_.Pop(frame)) {
+                uint32_t sequence = (uint16_t)frame.data()[0] | (uint32_t)(uint16_t)frame.data()[1] << 16;
+                frame.Release();
+                uint32_t count = ++encoded_;
+                if (phase_.encode_stall_every && count % phase_.encode_stall_every == 0) {
+                    SleepUs(phase_.encode_stall_us);
+                }
+                AudioStreamPacket packet;
+                AcquireAudioPacket(packet);
+                packet.payload.resize(4);
+                packet.sequence = sequence;
+                send_queue_.Push(std::move(packet));
+            }
+            if (phase_.finish_delay_us) {
+                SleepUs(phase_.finish_delay_us);
+            }
+            if (!encode_frames_.Finish()) {
+                break;
+            }
+        }
+        encoders_running_--;
+    }
+
+    void AcquireAudioPacket(AudioStreamPacket& packet) {
+        acquired_++;
+        if (!packet_pool_.Pop(packet)) {
+            packet = AudioStreamPacket();
+            pool_misses_++;
+        }
+    }
+
+    void SendLoop(std::atomic<bool>& producing) {
+        AudioStreamPacket packet;
+        while (producing || !send_queue_.empty()) {
+            if (!send_queue_.Pop(packet)) {
+                SleepUs(phase_.frame_us / 4);
+                continue;
+            }
+            // 发送队列丢弃最旧的包时帧号会跳过，但不能后退
+            if (packet.sequence <= last_sent_) {
+                out_of_order_++;
+            }
+            last_sent_ = packet.sequence;
+            uint32_t count = ++sent_;
+            if (phase_.send_stall_every && count % phase_.send_stall_every == 0) {
+                SleepUs(phase_.send_stall_us);
+            }
+            packet_pool_.Push(std::move(packet));
+        }
+    }
+};
+
+int main() {
+    const Phase phases[] = {
+        { "steady",    1000,  2000, 0,   0,   0,   0,    0,  0, true },
+        { "handshake", 3000,  20,   0,   0,   0,   0,    20, 2, true },
+        { "stalls",    20000, 32,   200, 600, 300, 3000, 0,  0, false },
+        { "recover",   500,   2000, 0,   0,   0,   0,    0,  0, true },
+    };
+    Uplink uplink;
+    int failures = 0;
+    for (auto& phase : phases) {
+        if (!uplink.Run(phase)) {
+            failures++;
+        }
+    }
+    if (!uplink.PoolFull()) {
+        printf("the packet pool did not refill after the stalls\n");
+        failures++;
+    }
+    printf("audio_encode_stress: %d failures\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,182 @@
+// 采集路径的分配计数测试：按Application::ReadAudio和OnOutput的顺序让帧流过CaptureAudioFrame和AudioFrameHandoff，
+// 热身之后统计operator new和heap_caps_malloc的调用次数，必须为0；池用尽时取帧失败也不能分配，
+// 最后所有帧都要还回池中。
+//   audio_frame_pool_test
+#include "audio_config.h"
+#include "audio_frame_pool.h"
+#include "esp_heap_caps.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+
+static std::atomic<size_t> new_calls{0};
+
+void* operator new(size_t size) {
+    new_calls++;
+    void* p = malloc(size ? size : 1);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+void operator delete(void* p) noexcept {
+    free(p);
+}
+void operator delete[](void* p) noexcept {
+    free(p);
+}
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+void operator delete[](void* p, size_t) noexcept {
+    free(p);
+}
+
+static size_t Allocations() {
+    return new_calls + host_heap_caps_allocs;
+}
+
+#define FEED_SAMPLES 512            // AFE按16kHz喂入的样本数（两个声道）
+#define INPUT_RATE_RATIO 3          // 48kHz的麦克风，重采样到16kHz
+
+// 48kHz双声道的麦克风：样本值从seed开始递增，重采样器用每INPUT_RATE_RATIO个样本取一个代替
+class FakeMicrophone : public AudioCaptureSource {
+public:
+    int16_t seed = 0;
+
+    int input_sample_rate() override { return 16000 * INPUT_RATE_RATIO; }
+    int input_channels() override { return 2; }
+    bool Read(int16_t* data, size_t samples) override {
+        for (size_t i = 0; i < samples; i++) {
+            data[i] = seed + i;
+        }
+        return true;
+    }
+    int ResampledSamples(size_t samples) override { return samples / INPUT_RATE_RATIO; }
+    void Resample(int /*channel*/, const int16_t* input, size_t samples, int16_t* output) override {
+        for (size_t i = 0; i < samples / INPUT_RATE_RATIO; i++) {
+            output[i] = input[i * INPUT_RATE_RATIO];
+        }
+    }
+};
+
+// 一次采集：与Application::ReadAudio相同，调用CaptureAudioFrame，16kHz双声道共FEED_SAMPLES个样本
+static bool ReadAudio(AudioFramePool& pool, AudioFrame& frame, int16_t seed) {
+    static FakeMicrophone microphone;
+    microphone.seed = seed;
+    return CaptureAudioFrame(pool, microphone, 16000, FEED_SAMPLES, frame);
+}
+
+int main() {
+    int failures = 0;
+    AudioFramePool pool(AUDIO_READ_FRAMES + AUDIO_PROCESSOR_OUTPUT_FRAMES, FEED_SAMPLES * INPUT_RATE_RATIO);
+    AudioFrameHandoff encode_frames(AUDIO_PROCESSOR_OUTPUT_FRAMES);
+    size_t encoded = 0, encoded_samples = 0, scheduled = 0;
+
+    // 与NoAudioProcessor::Feed和Application中的OnOutput回调相同：帧移动进编码队列，编码阶段没在运行时才安排
+    std::function<void(AudioFrame&& frame)> output_callback = [&](AudioFrame&& frame) {
+        bool schedule;
+        if (encode_frames.Push(std::move(frame), &schedule) && schedule) {
+            scheduled++;
+        }
+    };
+    auto encode = [&]() {
+        AudioFrame frame;
+        do {
+            while (encode_frames.Pop(frame)) {
+                encoded++;
+                encoded_samples += frame.size();
+                frame.Release();
+            }
+        } while (encode_frames.Finish());
+    };
+
+    auto capture = [&](int iterations, int encode_every) {
+        for (int i = 0; i < iterations; i++) {
+            AudioFrame frame;
+            if (ReadAudio(pool, frame, i)) {
+                output_callback(std::move(frame));
+            }
+            if ((i + 1) % encode_every == 0) {
+                encode();
+            }
+        }
+        encode();
+    };
+
+    // 输出帧中麦克风和参考声道交错排列：第i对来自输入的第i * INPUT_RATE_RATIO对
+    {
+        AudioFrame frame;
+        bool ok = ReadAudio(pool, frame, 100) && frame.size() == FEED_SAMPLES;
+        for (size_t i = 0; ok && i < FEED_SAMPLES / 2; i++) {
+            int16_t mic = 100 + 2 * i * INPUT_RATE_RATIO;
+            ok = frame.data()[2 * i] == mic && frame.data()[2 * i + 1] == mic + 1;
+        }
+        if (!ok) {
+            printf("capture: the frame does not interleave the resampled mic and reference channels\n");
+            failures++;
+        }
+    }
+
+    // 热身：std::function和队列的存储都在构造时分配，这里不应再有分配，先跑一轮确认路径走通
+    capture(16, 1);
+    size_t before = Allocations();
+    const int kIterations = 10000;
+    capture(kIterations, 1);
+    capture(kIterations, AUDIO_PROCESSOR_OUTPUT_FRAMES);   // 编码落后时队列积压到满
+    size_t allocations = Allocations() - before;
+    if (allocations != 0) {
+        printf("capture: %zu allocations in %d frames\n", allocations, 2 * kIterations);
+        failures++;
+    }
+    if (encoded != 16 + 2 * (size_t)kIterations || encoded_samples != encoded * FEED_SAMPLES) {
+        printf("capture: encoded %zu frames (%zu samples), want %d\n", encoded, encoded_samples, 16 + 2 * kIterations);
+        failures++;
+    }
+    if (pool.failures() != 0 || pool.in_use() != 0) {
+        printf("capture: %u acquire failures, %zu frames still in use\n", pool.failures(), pool.in_use());
+        failures++;
+    }
+    printf("capture: %zu frames, peak %zu of %zu pool frames in use, %zu encode jobs scheduled, %zu allocations\n",
+        encoded, pool.peak_in_use(), pool.frames(), scheduled, allocations);
+
+    // 池用尽：取帧返回空帧并计数，不分配；编码队列满时新帧留在调用者手里，析构时归还
+    AudioFrameQueue queue(AUDIO_PROCESSOR_OUTPUT_FRAMES);
+    before = Allocations();
+    {
+        AudioFrame held[AUDIO_READ_FRAMES + AUDIO_PROCESSOR_OUTPUT_FRAMES];
+        for (auto& frame : held) {
+            frame = pool.Acquire(FEED_SAMPLES);
+        }
+        AudioFrame frame;
+        if (ReadAudio(pool, frame, 0) || pool.failures() != 1) {
+            printf("exhausted: acquire from an empty pool succeeded or was not counted\n");
+            failures++;
+        }
+        for (auto& frame : held) {
+            if (!queue.Push(std::move(frame)) && !frame) {
+                printf("exhausted: a frame rejected by a full queue was lost\n");
+                failures++;
+            }
+        }
+        queue.Clear();
+    }
+    allocations = Allocations() - before;
+    if (allocations != 0 || pool.in_use() != 0) {
+        printf("exhausted: %zu allocations, %zu frames still in use\n", allocations, pool.in_use());
+        failures++;
+    }
+    if (pool.Acquire(pool.frame_samples() + 1)) {
+        printf("oversized: acquire larger than a frame succeeded\n");
+        failures++;
+    }
+
+    printf("audio_frame_pool: %d failures\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,224 @@
+// 抖动缓冲按序号处理的单元测试：MQTT UDP包头中的序号（乱序、迟到、重复、通道重开后序号重新开始），
+// 以及没有序号的传输（WebSocket，sequence为0）按到达顺序自动编号；每个用例结束时检查丢失帧的统计能对上。
+//   audio_jitter_buffer_test
+#include "audio_jitter_buffer.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#define FRAME_MS 60
+
+static int failures = 0;
+
+static void Expect(bool condition, const std::string& name, const char* what) {
+    if (!condition) {
+        printf("%s: %s\n", name.c_str(), what);
+        failures++;
+    }
+}
+
+struct Played {
+    JitterAction action;
+    uint32_t sequence;
+};
+
+class Session {
+public:
+    explicit Session(const std::string& name) : name_(name) {}
+
+    // 按MQTT的方式放入：sequence来自包头，0表示没有序号
+    void Put(uint32_t sequence) {
+        AudioStreamPacket packet;
+        packet.sample_rate = 24000;
+        packet.frame_duration = FRAME_MS;
+        packet.sequence = sequence;
+        packet.payload.assign(1, (uint8_t)sequence);
+        jitter_.Put(std::move(packet), now_);
+    }
+
+    // 播放frames帧的时长，每播完一帧取下一帧；kNone时等1毫秒再取
+    std::vector<Played> Play(int frames) {
+        std::vector<Played> played;
+        uint32_t end = now_ + frames * FRAME_MS;
+        while (now_ < end) {
+            AudioStreamPacket packet;
+            auto action = jitter_.Get(packet, now_);
+            if (action == JitterAction::kNone) {
+                now_++;
+                continue;
+            }
+            uint32_t sequence = action == JitterAction::kConceal ? 0 : packet.sequence;
+            played.push_back({ action, sequence });
+            now_ += (action == JitterAction::kRecover ? 2 : 1) * FRAME_MS;
+        }
+        return played;
+    }
+
+    void Wait(uint32_t ms) { now_ += ms; }
+
+    // 依次解码的序号，补偿的帧记为0，FEC恢复记为恢复出的前一帧和packet本身
+    static std::vector<uint32_t> Sequences(const std::vector<Played>& played) {
+        std::vector<uint32_t> sequences;
+        for (auto& p : played) {
+            if (p.action == JitterAction::kRecover) {
+                sequences.push_back(p.sequence - 1);
+            }
+            sequences.push_back(p.sequence);
+        }
+        return sequences;
+    }
+
+    void ExpectPlayed(const std::vector<Played>& played, const std::vector<uint32_t>& sequences) {
+        auto got = Sequences(played);
+        if (got != sequences) {
+            std::string text = "played";
+            for (auto s : got) {
+                text += " " + std::to_string(s);
+            }
+            text += ", want";
+            for (auto s : sequences) {
+                text += " " + std::to_string(s);
+            }
+            Expect(false, name_, text.c_str());
+        }
+    }
+
+    JitterBufferStats Finish() {
+        auto stats = jitter_.stats();
+        Expect(stats.lost == stats.recovered + stats.concealed + stats.skipped, name_,
+            "lost does not equal fec + plc + skipped");
+        return stats;
+    }
+
+    const std::string& name() const { return name_; }
+
+private:
+    std::string name_;
+    AudioJitterBuffer jitter_;
+    uint32_t now_ = 1000;
+};
+
+// 开始播放前乱序到达：按序号排好再播放
+static void TestReorderBeforePlayback() {
+    Session s("reorder before playback");
+    s.Put(3);
+    s.Put(1);
+    s.Put(2);
+    s.Put(4);
+    s.ExpectPlayed(s.Play(4), { 1, 2, 3, 4 });
+    auto stats = s.Finish();
+    Expect(stats.lost == 0 && stats.late == 0, s.name(), "nothing should be lost or late");
+}
+
+// 播放中乱序：后一个包先到，前一个在轮到它之前到达，不算丢失
+static void TestReorderDuringPlayback() {
+    Session s("reorder during playback");
+    s.Put(1);
+    s.Put(2);
+    s.Put(3);
+    s.ExpectPlayed(s.Play(1), { 1 });
+    s.Put(5);
+    s.Put(4);
+    s.Put(6);
+    s.ExpectPlayed(s.Play(5), { 2, 3, 4, 5, 6 });
+    auto stats = s.Finish();
+    Expect(stats.lost == 0 && stats.late == 0, s.name(), "nothing should be lost or late");
+}
+
+// 轮到时缺少的包用后一个包的FEC恢复，之后才到的原包计为迟到并丢弃，不会再播放
+static void TestLatePacket() {
+    Session s("late packet");
+    s.Put(1);
+    s.Put(2);
+    s.Put(4);
+    s.Put(5);
+    s.ExpectPlayed(s.Play(4), { 1, 2, 3, 4 });
+    s.Put(3);
+    s.ExpectPlayed(s.Play(1), { 5 });
+    auto stats = s.Finish();
+    Expect(stats.late == 1, s.name(), "the packet after its playout should count as late");
+    Expect(stats.lost == 1 && stats.recovered == 1, s.name(), "the missing frame should be recovered by FEC");
+}
+
+// 后面没有包可用FEC时用PLC补偿，补偿之后才到的包同样是迟到
+static void TestConcealedThenLate() {
+    Session s("concealed then late");
+    s.Put(1);
+    s.Put(2);
+    s.Put(5);
+    s.ExpectPlayed(s.Play(5), { 1, 2, 0, 4, 5 });
+    s.Put(3);
+    auto stats = s.Finish();
+    Expect(stats.concealed == 1 && stats.recovered == 1 && stats.lost == 2, s.name(),
+        "frame 3 should be concealed and frame 4 recovered");
+    Expect(stats.late == 1, s.name(), "frame 3 arriving after concealment should be late");
+}
+
+static void TestDuplicate() {
+    Session s("duplicate");
+    s.Put(1);
+    s.Put(2);
+    s.Put(2);
+    s.ExpectPlayed(s.Play(2), { 1, 2 });
+    auto stats = s.Finish();
+    Expect(stats.duplicate == 1, s.name(), "the second copy should count as duplicate");
+}
+
+// 通道重开后服务器从1重新编号：整个窗口之前的序号不当作迟到
+static void TestSequenceRestart() {
+    Session s("sequence restart");
+    for (uint32_t i = 1000; i < 1003; i++) {
+        s.Put(i);
+    }
+    s.ExpectPlayed(s.Play(3), { 1000, 1001, 1002 });
+    s.Put(1);
+    s.Put(2);
+    s.ExpectPlayed(s.Play(2), { 1, 2 });
+    auto stats = s.Finish();
+    Expect(stats.late == 0 && stats.lost == 0, s.name(), "a restarted sequence should not be late or lost");
+}
+
+// 没有序号的传输：按到达顺序编号，句子之间的停顿之后继续编号
+static void TestAutoNumbering() {
+    Session s("auto numbering");
+    for (int i = 0; i < 4; i++) {
+        s.Put(0);
+    }
+    s.ExpectPlayed(s.Play(4), { 1, 2, 3, 4 });
+    s.Play(JITTER_MAX_CONCEAL);
+    s.Wait(2000);
+    s.Put(0);
+    s.Put(0);
+    s.ExpectPlayed(s.Play(2), { 5, 6 });
+    auto stats = s.Finish();
+    Expect(stats.lost == 0 && stats.late == 0, s.name(), "arrival order has no losses");
+    Expect(stats.expanded == JITTER_MAX_CONCEAL && stats.concealed == 0, s.name(),
+        "end-of-speech concealment should be counted apart from lost frames");
+}
+
+// 放空时补偿的帧：很快又有包到达时，补偿的帧中确实缺少的部分从expanded转为丢失
+static void TestUnderrunAccounting() {
+    Session s("underrun accounting");
+    s.Put(1);
+    s.Put(2);
+    s.ExpectPlayed(s.Play(2 + JITTER_MAX_CONCEAL), { 1, 2, 0, 0, 0 });
+    s.Put(6);
+    auto stats = s.Finish();
+    Expect(stats.lost == JITTER_MAX_CONCEAL && stats.concealed == JITTER_MAX_CONCEAL && stats.expanded == 0,
+        s.name(), "frames 3-5 should move from end-of-speech to lost");
+    Expect(stats.underruns == 1, s.name(), "the quick return should count as an underrun");
+}
+
+int main() {
+    TestReorderBeforePlayback();
+    TestReorderDuringPlayback();
+    TestLatePacket();
+    TestConcealedThenLate();
+    TestDuplicate();
+    TestSequenceRestart();
+    TestAutoNumbering();
+    TestUnderrunAccounting();
+    printf("audio_jitter_buffer: %d failures\n", failures);
+    return failures ? 1 : 0;
+}
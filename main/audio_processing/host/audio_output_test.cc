@@ -0,0 +1,144 @@
+// 音频任务写I2S的速度测试：按1毫秒的步长模拟解码任务（AudioOutputWantsDecode为真时解一帧）、
+// 音频任务（每次循环读麦克风加等待共loop毫秒，然后写输出）和按实时消耗的I2S DMA缓冲。
+// 音频任务调用与Application::OnAudioOutput相同的DrainAudioOutput，常量来自audio_config.h。
+// 任何循环周期不超过DMA缓冲时长的情况下都不能欠载、写入不能阻塞、样本按顺序一个不少；
+// 同时给出原来每次循环只写一块的结果作对比。
+//   audio_output_test
+#include "audio_config.h"
+#include "audio_output_pacer.h"
+#include "pcm_ring.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#define FRAME_MS 60
+#define SPEECH_MS 10000
+
+struct DrainResult {
+    int underrun_ms;        // 开始播放后DMA缓冲为空的毫秒数
+    int blocked_writes;     // 写入时DMA缓冲放不下，实际会阻塞
+    int out_of_order;       // 播放的样本不是连续的
+    int played_ms;          // 从第一次写入到播完的时间
+};
+
+// 按实时消耗的I2S DMA缓冲
+class I2sModel {
+public:
+    explicit I2sModel(size_t capacity) : capacity_(capacity) {}
+
+    bool Write(const int16_t* data, size_t samples) {
+        bool fits = pending_.size() + samples <= capacity_;
+        pending_.insert(pending_.end(), data, data + samples);
+        return fits;
+    }
+
+    // 播放一毫秒，返回是否在播放中放空
+    bool Play(size_t samples, std::vector<int16_t>& played) {
+        size_t n = std::min(samples, pending_.size());
+        played.insert(played.end(), pending_.begin(), pending_.begin() + n);
+        pending_.erase(pending_.begin(), pending_.begin() + n);
+        return n < samples;
+    }
+
+private:
+    size_t capacity_;
+    std::vector<int16_t> pending_;
+};
+
+static DrainResult Simulate(int sample_rate, int loop_ms, bool paced) {
+    const size_t per_ms = sample_rate / 1000;
+    const size_t total = (size_t)SPEECH_MS * per_ms;
+    const size_t frame = FRAME_MS * per_ms;
+    PcmRing ring(sample_rate * AUDIO_OUTPUT_RING_MS / 1000);
+    std::vector<int16_t> chunk(sample_rate * AUDIO_OUTPUT_CHUNK_MS / 1000);
+    std::vector<int16_t> decoded(frame);
+    AudioOutputPacer pacer;
+    pacer.Configure(sample_rate, AUDIO_CODEC_DMA_DESC_NUM, AUDIO_CODEC_DMA_FRAME_NUM);
+    I2sModel i2s(AUDIO_CODEC_DMA_DESC_NUM * AUDIO_CODEC_DMA_FRAME_NUM);
+
+    DrainResult result = {};
+    std::vector<int16_t> played;
+    size_t produced = 0;
+    int first_write_ms = -1, next_loop_ms = 0;
+    for (int now = 0; played.size() < total && now < 4 * SPEECH_MS; now++) {
+        int64_t now_us = (int64_t)now * 1000;
+        // 解码任务：输出环中不超过提前量时解一帧，环中放不下时WriteAudio会等待，这里等到下一毫秒
+        while (produced < total && AudioOutputWantsDecode(ring, sample_rate) && ring.free_space() >= frame) {
+            for (size_t i = 0; i < frame; i++) {
+                decoded[i] = (int16_t)(produced + i);
+            }
+            ring.Write(decoded.data(), frame);
+            produced += frame;
+        }
+        // 音频任务
+        if (now >= next_loop_ms) {
+            next_loop_ms = now + loop_ms;
+            if (paced) {
+                size_t wrote = DrainAudioOutput(ring, pacer, chunk, [now_us]() { return now_us; },
+                    [&](const int16_t* data, size_t samples) {
+                        result.blocked_writes += !i2s.Write(data, samples);
+                    });
+                if (wrote > 0 && first_write_ms < 0) {
+                    first_write_ms = now;
+                }
+            } else {
+                size_t samples = ring.Read(chunk.data(), chunk.size());
+                if (samples > 0) {
+                    result.blocked_writes += !i2s.Write(chunk.data(), samples);
+                    if (first_write_ms < 0) {
+                        first_write_ms = now;
+                    }
+                }
+            }
+        }
+        // I2S按实时播放
+        if (first_write_ms >= 0 && i2s.Play(per_ms, played) && played.size() < total) {
+            result.underrun_ms++;
+        }
+        result.played_ms = now + 1 - first_write_ms;
+    }
+    for (size_t i = 0; i < played.size(); i++) {
+        if (played[i] != (int16_t)i) {
+            result.out_of_order++;
+        }
+    }
+    if (played.size() != total) {
+        result.out_of_order += total - played.size();
+    }
+    return result;
+}
+
+int main() {
+    int failures = 0;
+    for (int sample_rate : { 16000, 24000 }) {
+        const int dma_ms = AUDIO_CODEC_DMA_DESC_NUM * AUDIO_CODEC_DMA_FRAME_NUM * 1000 / sample_rate;
+        // 循环周期：1000Hz节拍下读一次AFE输入（32毫秒）加10毫秒等待为42毫秒，其余用于比较
+        for (int loop_ms : { 10, 20, 32, 42, 50 }) {
+            auto single = Simulate(sample_rate, loop_ms, false);
+            auto paced = Simulate(sample_rate, loop_ms, true);
+            printf("%d Hz, loop %2d ms: one chunk per loop: %5d ms to play %d ms, underrun %5d ms | "
+                "paced: %5d ms, underrun %d ms, blocked %d\n", sample_rate, loop_ms,
+                single.played_ms, SPEECH_MS, single.underrun_ms, paced.played_ms, paced.underrun_ms, paced.blocked_writes);
+            if (paced.out_of_order != 0) {
+                printf("  paced: %d samples missing or out of order\n", paced.out_of_order);
+                failures++;
+            }
+            if (paced.blocked_writes != 0) {
+                printf("  paced: %d writes would have blocked\n", paced.blocked_writes);
+                failures++;
+            }
+            // DMA缓冲保存的时长内，只要循环周期不超过它减去一个描述符就不能欠载
+            if (loop_ms <= dma_ms - AUDIO_CODEC_DMA_FRAME_NUM * 1000 / sample_rate && paced.underrun_ms != 0) {
+                printf("  paced: underrun with a %d ms loop and a %d ms DMA buffer\n", loop_ms, dma_ms);
+                failures++;
+            }
+            if (loop_ms > AUDIO_OUTPUT_CHUNK_MS && single.underrun_ms == 0) {
+                printf("  one chunk per loop should fall behind with a %d ms loop\n", loop_ms);
+                failures++;
+            }
+        }
+    }
+    printf("audio_output: %d failures\n", failures);
+    return failures ? 1 : 0;
+}
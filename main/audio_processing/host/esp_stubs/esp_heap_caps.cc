@@ -0,0 +1,14 @@
+#include "esp_heap_caps.h"
+
+#include <cstdlib>
+
+std::atomic<size_t> host_heap_caps_allocs{0};
+
+void* heap_caps_malloc(size_t size, uint32_t /*caps*/) {
+    host_heap_caps_allocs++;
+    return malloc(size);
+}
+
+void heap_caps_free(void* ptr) {
+    free(ptr);
+}
@@ -0,0 +1,18 @@
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// 主机构建用的heap_caps，全部从malloc分配；host_heap_caps_allocs记录调用次数，供测试检查分配
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_8BIT     (1 << 2)
+
+extern std::atomic<size_t> host_heap_caps_allocs;
+
+void* heap_caps_malloc(size_t size, uint32_t caps);
+void heap_caps_free(void* ptr);
+
+#endif // HOST_ESP_HEAP_CAPS_H
@@ -0,0 +1,209 @@
+// 抖动缓冲的主机模拟：服务器按帧长发送几段语音，经过有丢包、突发丢包、抖动和乱序的网络，
+// 设备端按1毫秒的步长放入到达的包，上一帧播完后取下一帧，统计缓冲的处理结果和播放延迟。
+// 随机数用固定种子，同样的参数每次结果相同，便于比较策略修改前后的差别。
+#include "audio_jitter_buffer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct NetworkProfile {
+    const char* name;
+    double loss;            // 平均丢包率
+    double burst;           // 平均连续丢包长度，1为独立丢包
+    int base_delay_ms;      // 固定的传输延迟
+    int jitter_ms;          // 随机附加延迟的上限
+    double spike;           // 出现延迟尖峰（整段jitter_ms的4倍）的概率
+    double reorder;         // 包被推迟一帧半到达的概率
+};
+
+static const NetworkProfile kProfiles[] = {
+    {"clean",   0.00, 1, 20,   2, 0.000, 0.00},
+    {"wifi",    0.01, 1, 30,  30, 0.005, 0.01},
+    {"lossy",   0.05, 1, 40,  20, 0.000, 0.00},
+    {"burst",   0.05, 4, 40,  20, 0.000, 0.00},
+    {"reorder", 0.01, 1, 40,  20, 0.000, 0.10},
+    {"cellular", 0.03, 2, 80, 120, 0.010, 0.03},
+};
+
+// xorshift32，与平台无关的确定性序列
+class Random {
+public:
+    explicit Random(uint32_t seed) : state_(seed != 0 ? seed : 1) {}
+    uint32_t Next() {
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 17;
+        state_ ^= state_ << 5;
+        return state_;
+    }
+    double Uniform() { return (Next() >> 8) / 16777216.0; }
+
+private:
+    uint32_t state_;
+};
+
+struct Arrival {
+    uint32_t time_ms;
+    uint32_t sequence;
+    uint32_t send_ms;
+};
+
+static void Usage(const char* program) {
+    fprintf(stderr, "usage: %s [profile] [--loss P] [--burst N] [--delay MS] [--jitter MS] [--spike P] [--reorder P]\n"
+        "          [--frame MS] [--spurts N] [--frames N] [--pause MS] [--seed N]\n", program);
+    fprintf(stderr, "profiles:");
+    for (auto& profile : kProfiles) {
+        fprintf(stderr, " %s", profile.name);
+    }
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char** argv) {
+    NetworkProfile profile = kProfiles[1];
+    int frame_ms = 60;
+    int spurts = 5;
+    int frames_per_spurt = 200;
+    int pause_ms = 2000;
+    uint32_t seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg[0] != '-') {
+            bool found = false;
+            for (auto& p : kProfiles) {
+                if (arg == p.name) {
+                    profile = p;
+                    found = true;
+                }
+            }
+            if (!found) {
+                Usage(argv[0]);
+                return 1;
+            }
+            continue;
+        }
+        if (i + 1 >= argc) {
+            Usage(argv[0]);
+            return 1;
+        }
+        double value = atof(argv[++i]);
+        if (arg == "--loss") profile.loss = value;
+        else if (arg == "--burst") profile.burst = std::max(1.0, value);
+        else if (arg == "--delay") profile.base_delay_ms = (int)value;
+        else if (arg == "--jitter") profile.jitter_ms = (int)value;
+        else if (arg == "--spike") profile.spike = value;
+        else if (arg == "--reorder") profile.reorder = value;
+        else if (arg == "--frame") frame_ms = std::max(10, (int)value);
+        else if (arg == "--spurts") spurts = std::max(1, (int)value);
+        else if (arg == "--frames") frames_per_spurt = std::max(1, (int)value);
+        else if (arg == "--pause") pause_ms = (int)value;
+        else if (arg == "--seed") seed = (uint32_t)value;
+        else {
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    // 两状态的突发丢包模型：坏状态下全部丢失，平均停留burst个包，平均丢包率为loss
+    Random random(seed);
+    double p_bad = profile.loss < 1 ? profile.loss / (profile.burst * (1 - profile.loss)) : 1;
+    double p_good = 1 / profile.burst;
+    bool bad = false;
+
+    std::vector<Arrival> arrivals;
+    uint32_t sent = 0, dropped = 0;
+    uint32_t sequence = 0;
+    uint32_t send_ms = 0;
+    for (int s = 0; s < spurts; s++) {
+        for (int f = 0; f < frames_per_spurt; f++) {
+            sequence++;
+            sent++;
+            bad = bad ? random.Uniform() >= p_good : random.Uniform() < p_bad;
+            if (!bad) {
+                uint32_t delay = profile.base_delay_ms + (uint32_t)(random.Uniform() * profile.jitter_ms);
+                if (random.Uniform() < profile.spike) {
+                    delay += profile.jitter_ms * 4;
+                }
+                if (random.Uniform() < profile.reorder) {
+                    delay += frame_ms * 3 / 2;
+                }
+                arrivals.push_back({send_ms + delay, sequence, send_ms});
+            } else {
+                dropped++;
+            }
+            send_ms += frame_ms;
+        }
+        send_ms += pause_ms;
+    }
+    std::stable_sort(arrivals.begin(), arrivals.end(), [](const Arrival& a, const Arrival& b) {
+        return a.time_ms < b.time_ms;
+    });
+
+    AudioJitterBuffer jitter;
+    size_t next_arrival = 0;
+    uint32_t busy_until = 0;
+    uint32_t decoded = 0, gaps = 0, gap_ms = 0;
+    uint64_t latency_sum = 0;
+    uint32_t latency_max = 0;
+    bool in_gap = false;
+    uint32_t end_ms = send_ms + profile.base_delay_ms + profile.jitter_ms * 5 + frame_ms * (JITTER_MAX_DEPTH + 4);
+
+    for (uint32_t now = 0; now < end_ms; now++) {
+        while (next_arrival < arrivals.size() && arrivals[next_arrival].time_ms <= now) {
+            AudioStreamPacket packet;
+            packet.sample_rate = 24000;
+            packet.frame_duration = frame_ms;
+            packet.timestamp = arrivals[next_arrival].send_ms;
+            packet.sequence = arrivals[next_arrival].sequence;
+            jitter.Put(std::move(packet), now);
+            next_arrival++;
+        }
+        if (now < busy_until) {
+            continue;
+        }
+
+        bool was_playing = jitter.playing();
+        AudioStreamPacket packet;
+        auto action = jitter.Get(packet, now);
+        if (action == JitterAction::kNone) {
+            // 播放中放空且后面还有包要来，是一次可听见的停顿
+            if (was_playing && next_arrival < arrivals.size() && arrivals[next_arrival].time_ms < now + pause_ms / 2) {
+                gaps++;
+                in_gap = true;
+            }
+            if (in_gap) {
+                gap_ms++;
+            }
+            continue;
+        }
+        in_gap = false;
+        int frames = action == JitterAction::kRecover ? 2 : 1;
+        busy_until = now + frames * frame_ms;
+        if (action != JitterAction::kConceal) {
+            decoded++;
+            uint32_t latency = now - packet.timestamp;
+            latency_sum += latency;
+            latency_max = std::max(latency_max, latency);
+        }
+    }
+
+    auto stats = jitter.stats();
+    printf("profile %s: loss %.3f burst %.1f delay %d ms jitter %d ms spike %.3f reorder %.3f, frame %d ms, seed %u\n",
+        profile.name, profile.loss, profile.burst, profile.base_delay_ms, profile.jitter_ms,
+        profile.spike, profile.reorder, frame_ms, seed);
+    printf("network:  sent %u, dropped %u (%.2f%%)\n", sent, dropped, sent ? 100.0 * dropped / sent : 0.0);
+    printf("buffer:   received %u, late %u, duplicate %u, overflow %u\n",
+        stats.received, stats.late, stats.duplicate, stats.overflow);
+    printf("playout:  decoded %u, lost %u (fec %u, plc %u, skipped %u), end-of-speech plc %u, underruns %u\n",
+        decoded, stats.lost, stats.recovered, stats.concealed, stats.skipped, stats.expanded, stats.underruns);
+    printf("          gaps %u (%u ms), latency avg %.1f ms max %u ms, jitter %u ms, target depth %d\n",
+        gaps, gap_ms, decoded ? (double)latency_sum / decoded : 0.0, latency_max, stats.jitter_ms, stats.target_depth);
+    if (stats.lost != stats.recovered + stats.concealed + stats.skipped) {
+        printf("lost frames do not add up to fec + plc + skipped\n");
+        return 1;
+    }
+    return 0;
+}
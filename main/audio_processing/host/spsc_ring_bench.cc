@@ -0,0 +1,239 @@
+// 音频包队列的主机基准，时间按1000倍缩短（固件的60毫秒帧在这里是60微秒）：
+//   spsc_ring_bench queue    原来的std::list加互斥锁与SpscRing比较：每次入队、出队的耗时分布和分配次数。
+//                            另有一个线程反复短时间持有同一把锁，模拟主循环等其他使用者
+//   spsc_ring_bench waiter   解码队列的两个写入者：网络回调按帧长入队，PlaySound在队列满时等待解码腾出位置。
+//                            比较等待时持有audio_decode_push_mutex_与只在入队时持有，网络回调入队被阻塞的时间
+#include "audio_stream_packet.h"
+#include "spsc_ring.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+static std::atomic<long> new_calls{0};
+
+void* operator new(size_t size) {
+    new_calls++;
+    void* p = malloc(size ? size : 1);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+void operator delete(void* p) noexcept {
+    free(p);
+}
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+// 与application.h相同：60毫秒一帧，队列容量2.4秒
+#define FRAME_US 60
+#define QUEUE_PACKETS (2400 / 60)
+#define PACKET_BYTES 120
+
+using Clock = std::chrono::steady_clock;
+
+static long ElapsedNs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+static void PrintPercentiles(const char* name, std::vector<long>& samples) {
+    if (samples.empty()) {
+        printf("  %-6s no samples\n", name);
+        return;
+    }
+    std::sort(samples.begin(), samples.end());
+    printf("  %-6s n=%zu p50=%ld p99=%ld max=%ld ns\n", name, samples.size(),
+        samples[samples.size() / 2], samples[samples.size() * 99 / 100], samples.back());
+}
+
+struct QueueResult {
+    std::vector<long> push;
+    std::vector<long> pop;
+    long allocations;
+};
+
+// 生产者按帧长入队，消费者空闲时等四分之一帧再取；payload预先分配，只统计队列本身的分配
+template <typename Push, typename Pop>
+static QueueResult RunQueue(Push push, Pop pop, std::mutex& shared, int packets) {
+    QueueResult result;
+    result.push.reserve(packets);
+    result.pop.reserve(packets);
+    std::vector<AudioStreamPacket> source(packets);
+    for (auto& packet : source) {
+        packet.payload.resize(PACKET_BYTES);
+    }
+    std::atomic<bool> produced{false}, done{false};
+
+    std::thread contention([&]() {
+        while (!done) {
+            {
+                std::lock_guard<std::mutex> lock(shared);
+                volatile int sink = 0;
+                for (int i = 0; i < 200; i++) {
+                    sink += i;
+                }
+            }
+            std::this_thread::yield();
+        }
+    });
+
+    std::thread consumer([&]() {
+        AudioStreamPacket packet;
+        while (true) {
+            auto start = Clock::now();
+            bool got = pop(packet);
+            auto end = Clock::now();
+            if (got) {
+                result.pop.push_back(ElapsedNs(start, end));
+                packet.payload.clear();
+            } else if (produced) {
+                break;
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(FRAME_US / 4));
+            }
+        }
+    });
+
+    // 线程本身的分配不计入，此时还没有入队
+    long allocations = new_calls;
+    auto next = Clock::now();
+    for (int i = 0; i < packets; i++) {
+        next += std::chrono::microseconds(FRAME_US);
+        std::this_thread::sleep_until(next);
+        auto start = Clock::now();
+        push(std::move(source[i]));
+        result.push.push_back(ElapsedNs(start, Clock::now()));
+    }
+    produced = true;
+    consumer.join();
+    result.allocations = new_calls - allocations;
+    done = true;
+    contention.join();
+    return result;
+}
+
+static void BenchQueue(int packets) {
+    {
+        std::mutex mutex;
+        std::list<AudioStreamPacket> queue;
+        auto result = RunQueue([&](AudioStreamPacket&& packet) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (queue.size() >= QUEUE_PACKETS) {
+                queue.pop_front();
+            }
+            queue.emplace_back(std::move(packet));
+        }, [&](AudioStreamPacket& packet) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (queue.empty()) {
+                return false;
+            }
+            packet = std::move(queue.front());
+            queue.pop_front();
+            return true;
+        }, mutex, packets);
+        printf("list+mutex: %ld allocations\n", result.allocations);
+        PrintPercentiles("push", result.push);
+        PrintPercentiles("pop", result.pop);
+    }
+    {
+        std::mutex mutex;
+        SpscRing<AudioStreamPacket> queue(QUEUE_PACKETS, RingOverflow::kDropOldest);
+        auto result = RunQueue([&](AudioStreamPacket&& packet) {
+            queue.Push(std::move(packet));
+        }, [&](AudioStreamPacket& packet) {
+            return queue.Pop(packet);
+        }, mutex, packets);
+        auto stats = queue.stats();
+        printf("spsc ring:  %ld allocations, high water %zu, dropped %u\n", result.allocations,
+            stats.high_water, stats.dropped_oldest + stats.dropped_newest);
+        PrintPercentiles("push", result.push);
+        PrintPercentiles("pop", result.pop);
+    }
+}
+
+// 解码任务按帧长取包；PlaySound一次放入比队列长的提示音，网络回调同时按帧长入队
+static void BenchWaiter(bool hold_lock_while_waiting, int packets) {
+    SpscRing<AudioStreamPacket> queue(QUEUE_PACKETS, RingOverflow::kDropNewest);
+    std::mutex push_mutex;
+    std::atomic<bool> done{false};
+    std::vector<long> network;
+    network.reserve(packets);
+
+    std::thread decoder([&]() {
+        AudioStreamPacket packet;
+        auto next = Clock::now();
+        while (!done) {
+            next += std::chrono::microseconds(FRAME_US);
+            std::this_thread::sleep_until(next);
+            queue.Pop(packet);
+        }
+    });
+
+    std::thread play_sound([&]() {
+        for (int i = 0; i < packets * 2; i++) {
+            AudioStreamPacket packet;
+            if (hold_lock_while_waiting) {
+                std::lock_guard<std::mutex> lock(push_mutex);
+                while (queue.full()) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(FRAME_US / 2));
+                }
+                queue.Push(std::move(packet));
+                continue;
+            }
+            while (true) {
+                {
+                    std::lock_guard<std::mutex> lock(push_mutex);
+                    if (!queue.full()) {
+                        queue.Push(std::move(packet));
+                        break;
+                    }
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(FRAME_US / 2));
+            }
+        }
+    });
+
+    auto next = Clock::now();
+    for (int i = 0; i < packets; i++) {
+        next += std::chrono::microseconds(FRAME_US);
+        std::this_thread::sleep_until(next);
+        AudioStreamPacket packet;
+        auto start = Clock::now();
+        {
+            std::lock_guard<std::mutex> lock(push_mutex);
+            queue.Push(std::move(packet));
+        }
+        network.push_back(ElapsedNs(start, Clock::now()));
+    }
+    play_sound.join();
+    done = true;
+    decoder.join();
+
+    printf("%s: network callback push\n", hold_lock_while_waiting ? "lock held while waiting" : "lock only to push");
+    PrintPercentiles("push", network);
+}
+
+int main(int argc, char** argv) {
+    const char* mode = argc > 1 ? argv[1] : "queue";
+    int packets = argc > 2 ? atoi(argv[2]) : 20000;
+    if (strcmp(mode, "queue") == 0) {
+        BenchQueue(packets);
+    } else if (strcmp(mode, "waiter") == 0) {
+        BenchWaiter(true, packets / 10);
+        BenchWaiter(false, packets / 10);
+    } else {
+        fprintf(stderr, "usage: %s [queue|waiter] [packets]\n", argv[0]);
+        return 2;
+    }
+    return 0;
+}
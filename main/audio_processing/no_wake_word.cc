@@ -7,7 +7,7 @@ void NoWakeWord::Initialize(AudioCodec* codec) {
     codec_ = codec;
 }
 
-void NoWakeWord::Feed(const std::vector<int16_t>& data) {
+void NoWakeWord::Feed(const AudioFrame& frame) {
     // Do nothing - no wake word processing
 }
 
@@ -14,7 +14,7 @@ public:
     ~NoWakeWord() = default;
 
     void Initialize(AudioCodec* codec) override;
-    void Feed(const std::vector<int16_t>& data) override;
+    void Feed(const AudioFrame& frame) override;
     void OnWakeWordDetected(std::function<void(const std::string& wake_word)> callback) override;
     void StartDetection() override;
     void StopDetection() override;
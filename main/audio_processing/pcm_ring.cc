@@ -0,0 +1,84 @@
+#include "pcm_ring.h"
+
+#include <cstring>
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+
+#define TAG "PcmRing"
+
+// 存储按2的幂分配，位置用回绕的32位计数取模；可用容量仍是请求的样本数
+PcmRing::PcmRing(size_t samples) {
+    size_t slots = 1;
+    while (slots < samples) {
+        slots <<= 1;
+    }
+    storage_ = (int16_t*)heap_caps_malloc(slots * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+    if (storage_ == nullptr) {
+        storage_ = (int16_t*)heap_caps_malloc(slots * sizeof(int16_t), MALLOC_CAP_8BIT);
+    }
+    if (storage_ == nullptr) {
+        ESP_LOGE(TAG, "Failed to allocate %u samples", (unsigned)slots);
+        return;
+    }
+    capacity_ = samples;
+    mask_ = slots - 1;
+    ESP_LOGI(TAG, "%u samples, %u bytes", (unsigned)samples, (unsigned)(slots * sizeof(int16_t)));
+}
+
+PcmRing::~PcmRing() {
+    heap_caps_free(storage_);
+}
+
+uint32_t PcmRing::Tail(uint32_t tail) const {
+    uint32_t flush = flush_to_.load(std::memory_order_acquire);
+    return (int32_t)(flush - tail) > 0 ? flush : tail;
+}
+
+size_t PcmRing::size() const {
+    uint32_t tail = Tail(tail_.load(std::memory_order_acquire));
+    uint32_t head = head_.load(std::memory_order_acquire);
+    return (int32_t)(head - tail) > 0 ? head - tail : 0;
+}
+
+size_t PcmRing::Write(const int16_t* data, size_t samples) {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    uint32_t read = tail_.load(std::memory_order_acquire);
+    size_t free = capacity_ - (head - Tail(read));
+    // Clear()之后消费者可能还在拷贝被跳过的旧样本，不覆盖它还没释放的槽位
+    if (free > mask_ + 1 - (head - read)) {
+        free = mask_ + 1 - (head - read);
+    }
+    if (samples > free) {
+        samples = free;
+    }
+    size_t first = mask_ + 1 - (head & mask_);
+    if (first > samples) {
+        first = samples;
+    }
+    memcpy(storage_ + (head & mask_), data, first * sizeof(int16_t));
+    memcpy(storage_, data + first, (samples - first) * sizeof(int16_t));
+    head_.store(head + samples, std::memory_order_release);
+    return samples;
+}
+
+size_t PcmRing::Read(int16_t* data, size_t samples) {
+    // flush先于head读取，跳过的位置不会超过head
+    uint32_t tail = Tail(tail_.load(std::memory_order_relaxed));
+    uint32_t head = head_.load(std::memory_order_acquire);
+    size_t available = head - tail;
+    if (samples > available) {
+        samples = available;
+    }
+    size_t first = mask_ + 1 - (tail & mask_);
+    if (first > samples) {
+        first = samples;
+    }
+    memcpy(data, storage_ + (tail & mask_), first * sizeof(int16_t));
+    memcpy(data + first, storage_, (samples - first) * sizeof(int16_t));
+    tail_.store(tail + samples, std::memory_order_release);
+    return samples;
+}
+
+void PcmRing::Clear() {
+    flush_to_.store(head_.load(std::memory_order_acquire), std::memory_order_release);
+}
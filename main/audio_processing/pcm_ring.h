@@ -0,0 +1,45 @@
+#ifndef PCM_RING_H
+#define PCM_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/*
+    解码输出的PCM环形缓冲：解码任务写入，I2S写入方（音频任务）读取，单生产者单消费者，不加锁。
+    存储在构造时一次分配（优先PSRAM），之后读写只拷贝样本。按样本读写，一次可以只写入或读出一部分，
+    写满时由生产者等待读取方腾出空间，这就是解码的背压。
+    Clear()可以在任何任务中调用：只记下当前的写入位置，读取方下次读取时跳过此前的样本。
+    */
+class PcmRing {
+public:
+    explicit PcmRing(size_t samples);
+    ~PcmRing();
+    PcmRing(const PcmRing&) = delete;
+    PcmRing& operator=(const PcmRing&) = delete;
+
+    // 生产者：写入最多samples个样本，返回实际写入的样本数（空间不足时只写入一部分）
+    size_t Write(const int16_t* data, size_t samples);
+    // 消费者：读出最多samples个样本，返回实际读出的样本数
+    size_t Read(int16_t* data, size_t samples);
+    // 任何任务：丢弃当前缓存的所有样本
+    void Clear();
+
+    // 任何任务：缓存的样本数和剩余空间，并发修改时是近似值
+    size_t size() const;
+    size_t free_space() const { return capacity_ - size(); }
+    bool empty() const { return size() == 0; }
+    size_t capacity() const { return capacity_; }
+
+private:
+    int16_t* storage_ = nullptr;
+    size_t capacity_ = 0;
+    uint32_t mask_ = 0;
+    std::atomic<uint32_t> head_{0};     // 下一个写入的样本位置，只由生产者修改
+    std::atomic<uint32_t> tail_{0};     // 下一个读取的样本位置，只由消费者修改
+    std::atomic<uint32_t> flush_to_{0}; // Clear()时的head，消费者跳过此前的样本
+
+    uint32_t Tail(uint32_t tail) const;
+};
+
+#endif // PCM_RING_H
@@ -0,0 +1,137 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+    有界的单生产者单消费者无锁环形队列，用于音频包在任务之间传递。
+    生产者只写head_，消费者只写tail_，槽位在构造时一次分配，之后入队出队不分配内存也不加锁。
+    槽位数是capacity的两倍以上，多出的部分给还没被消费者释放的项使用。满时的策略：
+      kDropNewest  积压达到capacity时新的一项入队失败，由生产者决定丢弃或稍后重试；
+      kDropOldest  生产者照常入队，消费者出队时丢掉超出capacity的最旧项，保证取到的积压不超过capacity；
+                   消费者长时间不出队、槽位用完时才拒绝新的一项。
+    Clear()可以在任何任务中调用：只记下当前的head，已入队的项由消费者下次出队时丢弃并释放，
+    Clear()之后积压立即为0，生产者可以继续入队capacity项。
+    */
+enum class RingOverflow {
+    kDropNewest,
+    kDropOldest,
+};
+
+struct SpscRingStats {
+    size_t capacity;
+    size_t size;
+    size_t high_water;          // 入队后积压的最大值
+    uint32_t dropped_newest;    // 因为满而入队失败的次数
+    uint32_t dropped_oldest;    // 消费者丢掉的最旧项数（kDropOldest）
+};
+
+template <typename T>
+class SpscRing {
+public:
+    SpscRing(size_t capacity, RingOverflow policy) : capacity_(capacity), policy_(policy) {
+        size_t slots = 1;
+        while (slots < capacity * 2) {
+            slots <<= 1;
+        }
+        slots_.resize(slots);
+        mask_ = slots - 1;
+    }
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // 生产者：成功时移走item，失败时item保持不变
+    bool Push(T&& item) {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        uint32_t tail = tail_.load(std::memory_order_acquire);
+        if (head - tail >= slots_.size() || (policy_ == RingOverflow::kDropNewest && Backlog(head, tail) >= capacity_)) {
+            dropped_newest_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        slots_[head & mask_] = std::move(item);
+        head_.store(head + 1, std::memory_order_release);
+
+        size_t size = Backlog(head + 1, tail);
+        if (size > high_water_.load(std::memory_order_relaxed)) {
+            high_water_.store(size, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    // 消费者：取出最早的一项，先丢弃Clear()之前和超出capacity的项，为空时返回false
+    bool Pop(T& item) {
+        uint32_t tail = tail_.load(std::memory_order_relaxed);
+        uint32_t flush = flush_to_.load(std::memory_order_acquire);
+        uint32_t head = head_.load(std::memory_order_acquire);
+        uint32_t skip_to = tail;
+        if ((int32_t)(flush - skip_to) > 0) {
+            skip_to = flush;    // flush先于head读取，不会超过head
+        }
+        if (policy_ == RingOverflow::kDropOldest && head - skip_to > capacity_) {
+            dropped_oldest_.fetch_add(head - capacity_ - skip_to, std::memory_order_relaxed);
+            skip_to = head - capacity_;
+        }
+        for (; tail != skip_to; tail++) {
+            slots_[tail & mask_] = T();     // 立即释放被丢弃项持有的内存
+        }
+        if (tail == head) {
+            tail_.store(tail, std::memory_order_release);
+            return false;
+        }
+        item = std::move(slots_[tail & mask_]);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 任何任务：丢弃当前已入队的所有项
+    void Clear() {
+        flush_to_.store(head_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    // 任何任务：当前积压的项数（消费者取到的项数），并发修改时是近似值
+    size_t size() const {
+        return Backlog(head_.load(std::memory_order_acquire), tail_.load(std::memory_order_acquire));
+    }
+    bool empty() const { return size() == 0; }
+    bool full() const { return size() >= capacity_; }
+    size_t capacity() const { return capacity_; }
+
+    SpscRingStats stats() const {
+        return {
+            capacity_,
+            size(),
+            high_water_.load(std::memory_order_relaxed),
+            dropped_newest_.load(std::memory_order_relaxed),
+            dropped_oldest_.load(std::memory_order_relaxed),
+        };
+    }
+
+private:
+    size_t capacity_;
+    RingOverflow policy_;
+    std::vector<T> slots_;
+    uint32_t mask_;
+    std::atomic<uint32_t> head_{0};     // 下一个写入的位置，只由生产者修改
+    std::atomic<uint32_t> tail_{0};     // 下一个读取的位置，只由消费者修改
+    std::atomic<uint32_t> flush_to_{0}; // Clear()时的head，消费者丢弃此前的项
+    std::atomic<size_t> high_water_{0};
+    std::atomic<uint32_t> dropped_newest_{0};
+    std::atomic<uint32_t> dropped_oldest_{0};
+
+    size_t Backlog(uint32_t head, uint32_t tail) const {
+        uint32_t flush = flush_to_.load(std::memory_order_acquire);
+        if ((int32_t)(flush - tail) > 0) {
+            tail = flush;
+        }
+        if ((int32_t)(head - tail) <= 0) {
+            return 0;
+        }
+        size_t size = head - tail;
+        return size > capacity_ ? capacity_ : size;
+    }
+};
+
+#endif // SPSC_RING_H
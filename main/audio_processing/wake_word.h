@@ -6,13 +6,14 @@
 #include <functional>
 
 #include "audio_codec.h"
+#include "audio_frame_pool.h"
 
 class WakeWord {
 public:
     virtual ~WakeWord() = default;
     
     virtual void Initialize(AudioCodec* codec) = 0;
-    virtual void Feed(const std::vector<int16_t>& data) = 0;
+    virtual void Feed(const AudioFrame& frame) = 0;
     virtual void OnWakeWordDetected(std::function<void(const std::string& wake_word)> callback) = 0;
     virtual void StartDetection() = 0;
     virtual void StopDetection() = 0;
@@ -76,9 +76,12 @@ void TouchButton::handleButtonEvent(touch_button_handle_t out_handle, touch_butt
             case TP4_NUM_4:
             if (out_message->event == TOUCH_BUTTON_EVT_ON_PRESS) {  
                 //处理按钮按下的逻辑
-                app.eyeNewX = app.random_max(1024);  app.eyeNewY = app.random_max(1024);
-                app.is_track = false;
-                ESP_LOGI(TAG, "eyeX=[%d],eyeNewY=[%d]", app.eyeNewX,app.eyeNewY);
+                EyeCommand command = {};
+                command.x = app.random_max(1024);  command.y = app.random_max(1024);
+                command.track = false;
+                command.changed = EYE_COMMAND_GAZE | EYE_COMMAND_TRACK;     // 注视点和跟踪一起生效
+                app.PostEyeCommand(command);
+                ESP_LOGI(TAG, "eyeX=[%d],eyeNewY=[%d]", command.x, command.y);
                 ESP_LOGI(TAG, "Button[%d] Press", (int)arg);
             } else if (out_message->event == TOUCH_BUTTON_EVT_ON_RELEASE) { 
                 
@@ -92,9 +95,12 @@ void TouchButton::handleButtonEvent(touch_button_handle_t out_handle, touch_butt
             case TP3_NUM_5:
             if (out_message->event == TOUCH_BUTTON_EVT_ON_PRESS) {  
                 //处理按钮按下的逻辑
-                app.eyeNewX =  app.random_max(1024);  app.eyeNewY = app.random_max(1024);
-                app.is_track = true;
-                ESP_LOGI(TAG, "eyeX=[%d],eyeNewY=[%d]", app.eyeNewX,app.eyeNewY);
+                EyeCommand command = {};
+                command.x = app.random_max(1024);  command.y = app.random_max(1024);
+                command.track = true;
+                command.changed = EYE_COMMAND_GAZE | EYE_COMMAND_TRACK;     // 注视点和跟踪一起生效
+                app.PostEyeCommand(command);
+                ESP_LOGI(TAG, "eyeX=[%d],eyeNewY=[%d]", command.x, command.y);
                 ESP_LOGI(TAG, "Button[%d] Release", (int)arg);
             } else if (out_message->event == TOUCH_BUTTON_EVT_ON_RELEASE) { 
                 //处理按钮松开的逻辑
@@ -112,7 +118,7 @@ void TouchButton::handleButtonEvent(touch_button_handle_t out_handle, touch_butt
                 ESP_LOGI(TAG, "Button[%d] Press", (int)arg);
             } else if (out_message->event == TOUCH_BUTTON_EVT_ON_RELEASE) { 
                 //处理按钮松开的逻辑
-                app.sclera = sclera_style_ocean_girl;
+                app.SetEyeSclera(kEyeScleraOceanGirl);
                 ESP_LOGI(TAG, "Button[%d] Release", (int)arg);
             } else if (out_message->event == TOUCH_BUTTON_EVT_ON_LONGPRESS) {   
                 //处理按钮长按的逻辑
@@ -125,7 +131,7 @@ void TouchButton::handleButtonEvent(touch_button_handle_t out_handle, touch_butt
                 ESP_LOGI(TAG, "Button[%d] Press", (int)arg);
             } else if (out_message->event == TOUCH_BUTTON_EVT_ON_RELEASE) { 
                 //处理按钮松开的逻辑
-                app.sclera = sclera_default;
+                app.SetEyeSclera(kEyeScleraDefault);
                 ESP_LOGI(TAG, "Button[%d] Release", (int)arg);
             } else if (out_message->event == TOUCH_BUTTON_EVT_ON_LONGPRESS) {   
                 //处理按钮长按的逻辑
@@ -253,4 +253,16 @@ void Display::SetTheme(const std::string& theme_name) {
     // 设置眼睛的位置和颜色
     void Display::SetEye(int x_start, int y_start, int x_end, int y_end, const void *color_data) {
     }
+
+    // 默认实现为同步刷新，返回的token总是已完成
+    void Display::SetEyeAsync(int x_start, int y_start, int x_end, int y_end, const void *color_data, EyeFlushToken* token) {
+        SetEye(x_start, y_start, x_end, y_end, color_data);
+        if (token != nullptr) {
+            *token = EyeFlushToken();
+        }
+    }
+
+    void Display::SetEyePanelAsync(int panel, int x_start, int y_start, int x_end, int y_end, const void *color_data, EyeFlushToken* token) {
+        SetEyeAsync(x_start, y_start, x_end, y_end, color_data, token);
+    }
 #endif
\ No newline at end of file
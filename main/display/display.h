@@ -8,6 +8,15 @@
 
 #include <string>
 
+#if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824  //如果开启魔眼显示
+#define EYE_MAX_PANELS 2    // 魔眼最多驱动的屏幕数量（双目板每只眼一块屏）
+
+// 魔眼异步刷新的完成令牌：记录每块屏幕提交时分配的递增序号，0表示该屏幕没有待完成的传输
+struct EyeFlushToken {
+    uint32_t seq[EYE_MAX_PANELS] = {};
+};
+#endif
+
 struct DisplayFonts {
     const lv_font_t* text_font = nullptr;
     const lv_font_t* icon_font = nullptr;
@@ -32,6 +41,16 @@ public:
 
      #if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824  //如果开启魔眼显示
         virtual void SetEye(int x_start, int y_start, int x_end, int y_end, const void *color_data);
+        // 异步提交一块魔眼区域，立即返回；color_data在token完成前不能被改写
+        virtual void SetEyeAsync(int x_start, int y_start, int x_end, int y_end, const void *color_data, EyeFlushToken* token);
+        // 只向指定的屏幕提交，用于双目板上每只眼睛显示各自的画面
+        virtual void SetEyePanelAsync(int panel, int x_start, int y_start, int x_end, int y_end, const void *color_data, EyeFlushToken* token);
+        virtual bool IsEyeFlushDone(const EyeFlushToken& token) { return true; }
+        // 等待token对应的DMA传输结束，超时返回false
+        virtual bool WaitEyeFlush(const EyeFlushToken& token, int timeout_ms = 1000) { return true; }
+        virtual int GetEyePanelCount() { return 1; }
+        // 该屏幕的SPI总线上是否还有未完成的传输
+        virtual bool IsEyePanelBusy(int panel) { return false; }
     #endif
 
     inline int width() const { return width_; }
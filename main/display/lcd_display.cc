@@ -10,6 +10,7 @@
 #include "assets/lang_config.h"
 #include <cstring>
 #include "settings.h"
+#include "rgb565_ops.h"
 
 #include "board.h"
 
@@ -115,7 +116,7 @@ SpiLcdDisplay::SpiLcdDisplay(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_h
     : LcdDisplay(panel_io, panel, fonts, width, height) {
 
     #if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824    //魔眼
-
+    InitializeEyeFlush();
     #else
     // draw white
     std::vector<uint16_t> buffer(width_, 0xFFFF);
@@ -158,7 +159,7 @@ SpiLcdDisplay::SpiLcdDisplay(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_h
             .buff_dma = 1,
             .buff_spiram = 0,
             .sw_rotate = 0,
-            .swap_bytes = 1,
+            .swap_bytes = 0,    // 在LV_EVENT_FLUSH_START中交换，见下
             .full_refresh = 0,
             .direct_mode = 0,
         },
@@ -170,6 +171,15 @@ SpiLcdDisplay::SpiLcdDisplay(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_h
         return;
     }
 
+    // 刷新前在LVGL缓冲中原地交换字节序，代替esp_lvgl_port中逐像素的交换（开启CONFIG_RGB565_PIE时用PIE向量指令）。
+    // FLUSH_START在flush_cb之前发出，此时正在刷新的就是当前活动的绘制缓冲
+    lv_display_add_event_cb(display_, [](lv_event_t* e) {
+        lv_display_t* display = static_cast<lv_display_t*>(lv_event_get_user_data(e));
+        const lv_area_t* area = static_cast<const lv_area_t*>(lv_event_get_param(e));
+        uint16_t* pixels = reinterpret_cast<uint16_t*>(lv_display_get_buf_active(display)->data);
+        Rgb565Swap(pixels, pixels, lv_area_get_size(area));
+    }, LV_EVENT_FLUSH_START, display_);
+
     if (offset_x != 0 || offset_y != 0) {
         lv_display_set_offset(display_, offset_x, offset_y);
     }
@@ -185,7 +195,7 @@ DualScreenDisplay::DualScreenDisplay(esp_lcd_panel_io_handle_t panel_io1, esp_lc
     DisplayFonts fonts)
     : LcdDisplay(panel_io1, panel1, panel_io2, panel2, fonts,width,height) {
     #if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824    //魔眼
-
+    InitializeEyeFlush();
     #else
     // draw white
     std::vector<uint16_t> buffer(width_, 0xFFFF);
@@ -956,72 +966,197 @@ void LcdDisplay::SetPreviewImage(const lv_img_dsc_t* img_dsc) {
 
 #if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824
 
-    typedef struct {
-        const char* name;
-        int eyeNewX;
-        int eyeNewY;
-        bool isBlinking;
-        bool isTrack;
-    } EmotionConfig;
-
-   
+    // 表情的眼睛动画（注视、眼睑、瞳孔、眨眼和着色）由关键帧表驱动，见 scripts/gen_eye_emotions.py
     void LcdDisplay::SetEmotion(const char* emotion) {
         ESP_LOGI(TAG,"%s",emotion);
-        
-        static const EmotionConfig emotionConfigs[] = {
-            {"neutral", 505, 805, true, true}, // 默认表情，眼球居中，正常眨眼"😶" ok
-            {"happy", 520, 1005, true, true},   // 眼睛稍微向下看，显得开心"🙂" ok
-            {"laughing", 500, 1015, true, true}, // 眼睛向下看，显得大笑"😆"    ok
-            {"funny", 520, 25, true, true},   // 眼睛向下看，显得搞笑"😂"
-            {"sad",265, 335, true, true},     // 眼睛向上看，显得悲伤"😔" ok
-            {"angry", 700, 510, true, true},  // 眼睛向右看，显得生气 "😠"
-            {"crying", 514, 100, true, true},  // 眼睛向上看，显得哭泣 "😭"
-            {"loving", 510, 540, true, true}, // 眼睛稍微向下看，显得爱慕 "😍"
-            {"embarrassed", 1000, 510, true, true}, // 眼睛稍微向上看，显得尴尬 "😳" ok
-            {"surprised", 150, 445, true, false}, // 眼睛向右看，显得惊讶    "😯" ok
-            {"shocked", 985, 615, true, false},   // 眼睛向右看，显得震惊 "😱"  ok
-            {"thinking", 65,670, true, true}, // 眼睛稍微向上看，显得思考 "🤔"
-            {"winking", 510, 520, false, true},  // 眼睛眨眼，显得眨眼 "😉"
-            {"cool",510, 510, true, true},     // 眼睛正常，显得酷 "😎"
-            {"relaxed", 510, 490, true, true},  // 眼睛稍微闭合，显得放松 "😌"
-            {"delicious", 510, 490, true, true}, // 眼睛稍微向下看，显得享受美食 "🤤"
-            {"kissy", 1015, 510, true, true},    // 眼睛正常，显得亲吻 "😘"
-            {"confident", 890, 650, true, true}, // 眼睛正常，显得自信 "😏" ok ?
-            {"sleepy", 535, 605, true, true},   // 眼睛稍微闭合，显得困倦 "😴" ok
-            {"silly", 515, 750, true, true},    // 眼睛向上看，显得愚蠢 "😜"
-            {"confused", 1020, 1020, true, true}  // 眼睛稍微向上看，显得困惑 "🙄"
-            // 添加更多表情配置
-        };
-       // 查找表情配置
-    for (size_t i = 0; i < sizeof(emotionConfigs) / sizeof(EmotionConfig); i++) {
-        if (strcmp(emotionConfigs[i].name, emotion) == 0) {
-            //ESP_LOGI(TAG,"emotion:%s,name:%s,c_eyeX:%d,c_eyeY=%d,eyeX=%d,eyeY=%d,uT=%d,lT=%d",emotion,emotionConfigs[i].name,emotionConfigs[i].eyeX,emotionConfigs[i].eyeY,eyeX,eyeY,uThreshold,lThreshold);
-            auto& app = Application::GetInstance();
-            //更新眼睛状态x`
-            app.eyeNewX= emotionConfigs[i].eyeNewX;
-            app.eyeNewY = emotionConfigs[i].eyeNewY;
-            app.is_blink = emotionConfigs[i].isBlinking;
-            app.is_track = emotionConfigs[i].isTrack;
-
-    // If low power, the material ready event will be triggered by the modem because of a reset
-            // ESP_LOGI(TAG,"eyeNewX=%d,eyeNewY=%d,is_blink=%d,is_track=%d",eyeNewX,eyeNewY,is_blink,is_track);
-            break;
-        }
-    }
-
+        Application::GetInstance().SetEyeEmotion(emotion);
     }
     void LcdDisplay::SetIcon(const char* icon) {}
     void LcdDisplay::SetTheme(const std::string& theme_name) {}
 
     #if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824  //如果开启魔眼显示
-    void LcdDisplay::SetEye(int x_start, int y_start, int x_end, int y_end, const void *color_data){
-         Lock();
-        esp_err_t ret = esp_lcd_panel_draw_bitmap(panel_, x_start, y_start, x_end, y_end, color_data);
+    // SPI颜色数据传输完成回调，运行在ISR上下文
+    bool IRAM_ATTR LcdDisplay::OnEyeTransDone(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t* edata, void* user_ctx) {
+        auto eye_panel = static_cast<EyePanel*>(user_ctx);
+        uint32_t done = eye_panel->done.fetch_add(1) + 1;
+        BaseType_t need_yield = pdFALSE;
+        for (auto& waiter : eye_panel->waiters) {
+            if (waiter.busy.load() && (int32_t)(done - waiter.seq.load()) >= 0) {
+                xSemaphoreGiveFromISR(waiter.sem, &need_yield);
+            }
+        }
+        xSemaphoreGiveFromISR(eye_panel->owner->eye_flush_sem_, &need_yield);
+        return need_yield == pdTRUE;
+    }
+
+    // 为魔眼屏幕注册传输完成回调，魔眼模式下不启用LVGL，回调不会与lvgl_port冲突
+    void LcdDisplay::InitializeEyeFlush() {
+        eye_flush_sem_ = xSemaphoreCreateBinary();
+        eye_panels_[eye_panel_count_].io = panel_io_;
+        eye_panels_[eye_panel_count_].panel = panel_;
+        eye_panel_count_++;
         #if CONFIG_USE_EYE_STYLE_ES8311
-            esp_err_t ret2 = esp_lcd_panel_draw_bitmap(panel_2, x_start, y_start, x_end, y_end, color_data);
+            eye_panels_[eye_panel_count_].io = panel_io_2;
+            eye_panels_[eye_panel_count_].panel = panel_2;
+            eye_panel_count_++;
         #endif
-         Unlock();
+
+        const esp_lcd_panel_io_callbacks_t callbacks = {
+            .on_color_trans_done = OnEyeTransDone,
+        };
+        for (int i = 0; i < eye_panel_count_; i++) {
+            eye_panels_[i].owner = this;
+            for (auto& waiter : eye_panels_[i].waiters) {
+                waiter.sem = xSemaphoreCreateBinary();
+            }
+            ESP_ERROR_CHECK(esp_lcd_panel_io_register_event_callbacks(eye_panels_[i].io, &callbacks, &eye_panels_[i]));
+        }
+    }
+
+    bool LcdDisplay::IsEyePanelDone(const EyePanel& eye_panel, uint32_t seq) const {
+        return (int32_t)(eye_panel.done.load(std::memory_order_acquire) - seq) >= 0;
+    }
+
+    /*
+        等待本屏幕第seq次传输完成，超过deadline_us时返回false。
+        先占槽位、写入seq，再检查done：ISR先推进done再检查槽位，两边都是顺序一致的原子操作，
+        所以要么这里看到传输已完成，要么ISR看到这个等待者并释放它的信号量。
+        信号量可能留有上一次使用者多余的释放，醒来后总是重新检查done。
+        */
+    bool LcdDisplay::WaitEyePanel(EyePanel& eye_panel, uint32_t seq, int64_t deadline_us) {
+        EyePanelWaiter* slot = nullptr;
+        for (auto& waiter : eye_panel.waiters) {
+            bool expected = false;
+            if (waiter.busy.compare_exchange_strong(expected, true)) {
+                slot = &waiter;
+                break;
+            }
+        }
+        if (slot != nullptr) {
+            slot->seq.store(seq);
+        }
+        bool done = true;
+        while (!IsEyePanelDone(eye_panel, seq)) {
+            if (esp_timer_get_time() >= deadline_us) {
+                done = false;
+                break;
+            }
+            if (slot != nullptr) {
+                xSemaphoreTake(slot->sem, pdMS_TO_TICKS(10));
+            } else {
+                vTaskDelay(1);  // 槽位用完时退回轮询，不会发生在正常配置下
+            }
+        }
+        if (slot != nullptr) {
+            slot->busy.store(false);
+        }
+        return done;
+    }
+
+    bool LcdDisplay::IsEyePanelBusy(int panel) {
+        if (panel < 0 || panel >= eye_panel_count_) {
+            return false;
+        }
+        return !IsEyePanelDone(eye_panels_[panel], eye_panels_[panel].submitted);
     }
+
+    // 向单块屏幕提交一次传输，返回该次传输的序号
+    uint32_t LcdDisplay::SubmitEyePanel(int index, int x_start, int y_start, int x_end, int y_end, const void *color_data) {
+        EyePanel& eye_panel = eye_panels_[index];
+        uint32_t seq = ++eye_panel.submitted;
+        esp_err_t ret = esp_lcd_panel_draw_bitmap(eye_panel.panel, x_start, y_start, x_end, y_end, color_data);
+        if (ret != ESP_OK) {
+            // 提交失败不会产生完成回调，等前面的传输结束后直接记为完成，避免等待者卡死
+            ESP_LOGE(TAG, "Eye panel %d draw failed: %s", index, esp_err_to_name(ret));
+            WaitEyePanel(eye_panel, seq - 1, INT64_MAX);
+            uint32_t done = eye_panel.done.fetch_add(1) + 1;
+            for (auto& waiter : eye_panel.waiters) {
+                if (waiter.busy.load() && (int32_t)(done - waiter.seq.load()) >= 0) {
+                    xSemaphoreGive(waiter.sem);
+                }
+            }
+        }
+        return seq;
+    }
+
+    // 把同一块数据依次提交到所有魔眼屏幕，不等待DMA完成
+    void LcdDisplay::SetEyeAsync(int x_start, int y_start, int x_end, int y_end, const void *color_data, EyeFlushToken* token) {
+        EyeFlushToken submitted;
+        Lock();
+        for (int i = 0; i < eye_panel_count_; i++) {
+            submitted.seq[i] = SubmitEyePanel(i, x_start, y_start, x_end, y_end, color_data);
+        }
+        Unlock();
+        if (token != nullptr) {
+            *token = submitted;
+        }
+    }
+
+    void LcdDisplay::SetEyePanelAsync(int panel, int x_start, int y_start, int x_end, int y_end, const void *color_data, EyeFlushToken* token) {
+        EyeFlushToken submitted;
+        if (panel >= 0 && panel < eye_panel_count_) {
+            Lock();
+            submitted.seq[panel] = SubmitEyePanel(panel, x_start, y_start, x_end, y_end, color_data);
+            Unlock();
+        }
+        if (token != nullptr) {
+            *token = submitted;
+        }
+    }
+
+    bool LcdDisplay::IsEyeFlushDone(const EyeFlushToken& token) {
+        for (int i = 0; i < eye_panel_count_; i++) {
+            if (!IsEyePanelDone(eye_panels_[i], token.seq[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 只在调用者要改写仍被DMA占用的缓冲区时才阻塞，各屏幕并行传输，总等待时间取最慢的一块
+    bool LcdDisplay::WaitEyeFlush(const EyeFlushToken& token, int timeout_ms) {
+        int64_t deadline = esp_timer_get_time() + (int64_t)timeout_ms * 1000;
+        for (int i = 0; i < eye_panel_count_; i++) {
+            if (!WaitEyePanel(eye_panels_[i], token.seq[i], deadline)) {
+                ESP_LOGW(TAG, "Wait eye panel %d flush timeout", i);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void LcdDisplay::SetEye(int x_start, int y_start, int x_end, int y_end, const void *color_data){
+        EyeFlushToken token;
+        SetEyeAsync(x_start, y_start, x_end, y_end, color_data, &token);
+        WaitEyeFlush(token);
+    }
+
+    #if CONFIG_USE_EYE_STYLE_ES8311
+    // 双屏并行提交：esp_lcd_panel_draw_bitmap会先等待本屏上一次传输结束，
+    // 按顺序提交时屏幕2要陪着屏幕1等待；这里先提交已空闲的屏幕，两路SPI同时传输
+    void DualScreenDisplay::SetEyeAsync(int x_start, int y_start, int x_end, int y_end, const void *color_data, EyeFlushToken* token) {
+        EyeFlushToken submitted;
+        uint32_t pending = (1 << eye_panel_count_) - 1;
+        Lock();
+        while (pending != 0) {
+            bool progressed = false;
+            for (int i = 0; i < eye_panel_count_; i++) {
+                if ((pending & (1 << i)) && !IsEyePanelBusy(i)) {
+                    submitted.seq[i] = SubmitEyePanel(i, x_start, y_start, x_end, y_end, color_data);
+                    pending &= ~(1 << i);
+                    progressed = true;
+                }
+            }
+            if (!progressed) {
+                xSemaphoreTake(eye_flush_sem_, pdMS_TO_TICKS(10));
+            }
+        }
+        Unlock();
+        if (token != nullptr) {
+            *token = submitted;
+        }
+    }
+    #endif
     #endif
 #else
 void LcdDisplay::SetEmotion(const char* emotion) {
@@ -9,6 +9,12 @@
 
 #include <atomic>
 
+#if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#endif
+
 // Theme color structure
 struct ThemeColors {
     lv_color_t background;
@@ -35,6 +41,35 @@ protected:
 
     #if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824
         SemaphoreHandle_t eye_mutex = NULL; // 魔眼互斥锁
+
+        // 同一块屏幕可能同时有几个任务等待不同的序号（分块渲染的两个渲染任务、提交失败时的补记），
+        // 每个等待者占一个槽位和自己的信号量，传输完成时ISR唤醒所有已等到序号的等待者，
+        // 而不是让一个共用的二值信号量只唤醒其中一个
+        #define EYE_PANEL_WAITERS 4
+        struct EyePanelWaiter {
+            std::atomic<bool> busy{false};
+            std::atomic<uint32_t> seq{0};
+            SemaphoreHandle_t sem = nullptr;
+        };
+
+        // 魔眼屏幕的异步刷新状态，done由on_color_trans_done回调在ISR中推进
+        struct EyePanel {
+            LcdDisplay* owner = nullptr;
+            esp_lcd_panel_io_handle_t io = nullptr;
+            esp_lcd_panel_handle_t panel = nullptr;
+            uint32_t submitted = 0;     // 已提交的传输序号，只在提交该屏幕的任务中修改
+            std::atomic<uint32_t> done{0};
+            EyePanelWaiter waiters[EYE_PANEL_WAITERS];
+        };
+        EyePanel eye_panels_[EYE_MAX_PANELS];
+        int eye_panel_count_ = 0;
+        SemaphoreHandle_t eye_flush_sem_ = nullptr;   // 任一屏幕传输完成时释放，用于等待任意一块屏幕空闲
+
+        void InitializeEyeFlush();
+        bool IsEyePanelDone(const EyePanel& eye_panel, uint32_t seq) const;
+        bool WaitEyePanel(EyePanel& eye_panel, uint32_t seq, int64_t deadline_us);
+        uint32_t SubmitEyePanel(int index, int x_start, int y_start, int x_end, int y_end, const void *color_data);
+        static bool OnEyeTransDone(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t* edata, void* user_ctx);
     #endif
 
     lv_draw_buf_t draw_buf_;
@@ -74,6 +109,12 @@ public:
     virtual void SetTheme(const std::string& theme_name) override;
     #if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824  //如果开启魔眼显示
         virtual void SetEye(int x_start, int y_start, int x_end, int y_end, const void *color_data) override; // 设置眼睛
+        virtual void SetEyeAsync(int x_start, int y_start, int x_end, int y_end, const void *color_data, EyeFlushToken* token) override;
+        virtual void SetEyePanelAsync(int panel, int x_start, int y_start, int x_end, int y_end, const void *color_data, EyeFlushToken* token) override;
+        virtual bool IsEyeFlushDone(const EyeFlushToken& token) override;
+        virtual bool WaitEyeFlush(const EyeFlushToken& token, int timeout_ms = 1000) override;
+        virtual int GetEyePanelCount() override { return eye_panel_count_; }
+        virtual bool IsEyePanelBusy(int panel) override;
     #endif
 };
 
@@ -113,6 +154,11 @@ DualScreenDisplay(esp_lcd_panel_io_handle_t panel_io1, esp_lcd_panel_handle_t pa
     int width, int height, int offset_x, int offset_y,
     bool mirror_x, bool mirror_y, bool swap_xy,
     DisplayFonts fonts);
+
+#if CONFIG_USE_EYE_STYLE_ES8311
+    // 两块屏幕分别挂在两路SPI上，哪块先空闲就先提交哪块，两路总线并行传输
+    virtual void SetEyeAsync(int x_start, int y_start, int x_end, int y_end, const void *color_data, EyeFlushToken* token) override;
+#endif
 };
 #endif
 
@@ -0,0 +1,927 @@
+// 由 scripts/gen_eye_lid_spans.py 根据 upper_lower_common.h 生成，请勿手动修改
+#pragma once
+#include "common.h"
+
+#ifdef SYMMETRICAL_EYELID
+
+// 眼球在巩膜贴图的(x, y)处时上眼睑跟随的阈值，按[y][x / 3]索引
+const uint8_t lid_follow_default[91][31] = {
+  { // 0
+    0x75, 0x74, 0x72, 0x71, 0x71, 0x71, 0x6F, 0x6E, 0x6C, 0x6C, 0x6C, 0x6B,
+    0x6B, 0x6B, 0x69, 0x69, 0x68, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x65,
+    0x65, 0x65, 0x63, 0x63, 0x63, 0x63, 0x63,
+  },
+  { // 1
+    0x72, 0x71, 0x6F, 0x6E, 0x6E, 0x6C, 0x6C, 0x6B, 0x69, 0x69, 0x69, 0x68,
+    0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x65, 0x63, 0x63, 0x63, 0x62, 0x62,
+    0x62, 0x62, 0x62, 0x60, 0x60, 0x60, 0x60,
+  },
+  { // 2
+    0x6E, 0x6C, 0x6C, 0x6C, 0x6B, 0x68, 0x68, 0x66, 0x66, 0x66, 0x65, 0x65,
+    0x65, 0x65, 0x63, 0x63, 0x62, 0x62, 0x62, 0x5F, 0x60, 0x60, 0x5D, 0x5D,
+    0x5F, 0x5D, 0x5F, 0x5C, 0x5C, 0x5D, 0x5C,
+  },
+  { // 3
+    0x69, 0x68, 0x68, 0x68, 0x66, 0x65, 0x63, 0x63, 0x63, 0x62, 0x62, 0x60,
+    0x60, 0x60, 0x5F, 0x5F, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59,
+  },
+  { // 4
+    0x66, 0x65, 0x63, 0x63, 0x63, 0x62, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5D,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59,
+    0x57, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56,
+  },
+  { // 5
+    0x62, 0x60, 0x5F, 0x5D, 0x5D, 0x5D, 0x5C, 0x5A, 0x5A, 0x5A, 0x59, 0x59,
+    0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x54, 0x54, 0x54, 0x54,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x51,
+  },
+  { // 6
+    0x5D, 0x5D, 0x5C, 0x5A, 0x5A, 0x5A, 0x59, 0x57, 0x57, 0x57, 0x56, 0x56,
+    0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51,
+    0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  },
+  { // 7
+    0x59, 0x59, 0x59, 0x57, 0x57, 0x56, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53,
+    0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E,
+    0x4E, 0x4B, 0x4D, 0x4D, 0x4D, 0x4B, 0x4D,
+  },
+  { // 8
+    0x56, 0x54, 0x54, 0x54, 0x53, 0x51, 0x51, 0x50, 0x50, 0x50, 0x4E, 0x4E,
+    0x4D, 0x4D, 0x4D, 0x4D, 0x4B, 0x4B, 0x4B, 0x4B, 0x4A, 0x4A, 0x4A, 0x4A,
+    0x4A, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  },
+  { // 9
+    0x53, 0x51, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4B, 0x4B,
+    0x4A, 0x4A, 0x4A, 0x4A, 0x48, 0x48, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47,
+    0x47, 0x47, 0x45, 0x45, 0x45, 0x45, 0x45,
+  },
+  { // 10
+    0x4D, 0x4D, 0x4B, 0x4A, 0x4A, 0x4A, 0x48, 0x48, 0x48, 0x48, 0x47, 0x47,
+    0x45, 0x45, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41,
+  },
+  { // 11
+    0x4A, 0x48, 0x48, 0x47, 0x47, 0x47, 0x45, 0x45, 0x45, 0x44, 0x44, 0x44,
+    0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x3E,
+  },
+  { // 12
+    0x47, 0x44, 0x45, 0x45, 0x44, 0x44, 0x42, 0x41, 0x41, 0x3F, 0x41, 0x41,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3B, 0x3C, 0x3C, 0x3B, 0x39,
+  },
+  { // 13
+    0x42, 0x41, 0x41, 0x41, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3C, 0x3C, 0x3C,
+    0x3B, 0x3B, 0x3B, 0x3B, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36,
+  },
+  { // 14
+    0x3E, 0x3E, 0x3C, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x39, 0x39, 0x39,
+    0x38, 0x38, 0x38, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  },
+  { // 15
+    0x39, 0x38, 0x38, 0x38, 0x38, 0x36, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  },
+  { // 16
+    0x36, 0x35, 0x35, 0x35, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x32, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+    0x2F, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  },
+  { // 17
+    0x32, 0x32, 0x30, 0x30, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2C,
+    0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2A, 0x2A,
+    0x2C, 0x2A, 0x29, 0x29, 0x29, 0x2A, 0x2A,
+  },
+  { // 18
+    0x2D, 0x2D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x29,
+    0x29, 0x29, 0x29, 0x29, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x26, 0x26, 0x26, 0x26, 0x26,
+  },
+  { // 19
+    0x2A, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23,
+  },
+  { // 20
+    0x26, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x21,
+    0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1E,
+  },
+  { // 21
+    0x21, 0x21, 0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+  },
+  { // 22
+    0x1D, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1B, 0x1B, 0x1D, 0x1A, 0x1B,
+    0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x18, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x18, 0x1A,
+  },
+  { // 23
+    0x1A, 0x1A, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17,
+    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+  },
+  { // 24
+    0x17, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+  },
+  { // 25
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+  },
+  { // 26
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  },
+  { // 27
+    0x0B, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x09, 0x09,
+    0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  },
+  { // 28
+    0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  },
+  { // 29
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  },
+  { // 30
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+  },
+  { // 31
+    0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+  },
+  { // 32
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF6, 0xF6, 0xF7, 0xF7, 0xF6, 0xF7,
+    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  },
+  { // 33
+    0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF3, 0xF3, 0xF3, 0xF3,
+    0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+    0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  },
+  { // 34
+    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  },
+  { // 35
+    0xE8, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEB,
+    0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB,
+    0xEB, 0xEB, 0xEB, 0xED, 0xED, 0xED, 0xED,
+  },
+  { // 36
+    0xE5, 0xE5, 0xE5, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE8,
+    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+    0xE8, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
+  },
+  { // 37
+    0xE2, 0xE1, 0xE1, 0xE2, 0xE2, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE4, 0xE5,
+    0xE5, 0xE7, 0xE7, 0xE5, 0xE5, 0xE5, 0xE5,
+  },
+  { // 38
+    0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+  },
+  { // 39
+    0xD9, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
+    0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDF, 0xDF,
+    0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+  },
+  { // 40
+    0xD5, 0xD5, 0xD6, 0xD6, 0xD6, 0xD6, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+    0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xDB, 0xDB, 0xDB,
+    0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB,
+  },
+  { // 41
+    0xD2, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3, 0xD3, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5,
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+    0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD9,
+  },
+  { // 42
+    0xCD, 0xCF, 0xCD, 0xCF, 0xCF, 0xCF, 0xCF, 0xD2, 0xD0, 0xD2, 0xD2, 0xD2,
+    0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD5, 0xD5, 0xD5, 0xD3, 0xD5, 0xD5,
+    0xD5, 0xD5, 0xD3, 0xD5, 0xD5, 0xD5, 0xD6,
+  },
+  { // 43
+    0xC9, 0xCA, 0xCA, 0xCA, 0xCA, 0xCC, 0xCC, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
+    0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+    0xD0, 0xD0, 0xD0, 0xD2, 0xD2, 0xD2, 0xD2,
+  },
+  { // 44
+    0xC6, 0xC6, 0xC7, 0xC7, 0xC7, 0xC9, 0xC9, 0xC9, 0xCA, 0xCA, 0xCA, 0xCA,
+    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
+    0xCD, 0xCD, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+  },
+  { // 45
+    0xC1, 0xC1, 0xC3, 0xC3, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC6, 0xC6, 0xC6,
+    0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+    0xC9, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+  },
+  { // 46
+    0xBD, 0xBE, 0xBE, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xC3,
+    0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC7,
+    0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+  },
+  { // 47
+    0xB8, 0xBB, 0xBA, 0xBD, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBD, 0xC0, 0xC0,
+    0xBE, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC4,
+    0xC4, 0xC3, 0xC4, 0xC4, 0xC3, 0xC3, 0xC3,
+  },
+  { // 48
+    0xB5, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8, 0xBA, 0xBA, 0xBA, 0xBA, 0xBB, 0xBB,
+    0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  },
+  { // 49
+    0xB2, 0xB2, 0xB4, 0xB4, 0xB4, 0xB5, 0xB5, 0xB7, 0xB7, 0xB7, 0xB8, 0xB8,
+    0xB8, 0xBA, 0xBA, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xBD,
+    0xBD, 0xBD, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE,
+  },
+  { // 50
+    0xAC, 0xAE, 0xAF, 0xAF, 0xAF, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB4, 0xB4,
+    0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB7, 0xB7, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xBA, 0xBA, 0xBA, 0xBA,
+  },
+  { // 51
+    0xA9, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB1,
+    0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB4, 0xB4, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5,
+    0xB5, 0xB5, 0xB5, 0xB7, 0xB7, 0xB7, 0xB7,
+  },
+  { // 52
+    0xA6, 0xA6, 0xA6, 0xA9, 0xA9, 0xA8, 0xAB, 0xAB, 0xAC, 0xAC, 0xAB, 0xAE,
+    0xAE, 0xAC, 0xAF, 0xAF, 0xAE, 0xB1, 0xB1, 0xB1, 0xAF, 0xB1, 0xB2, 0xB2,
+    0xB2, 0xB1, 0xB2, 0xB2, 0xB4, 0xB4, 0xB4,
+  },
+  { // 53
+    0xA2, 0xA2, 0xA3, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA8, 0xA8, 0xA8, 0xA9,
+    0xA9, 0xA9, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAE, 0xAE, 0xAE,
+    0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+  },
+  { // 54
+    0x9D, 0x9F, 0xA0, 0xA0, 0xA0, 0xA2, 0xA3, 0xA3, 0xA5, 0xA5, 0xA5, 0xA6,
+    0xA6, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAB, 0xAB, 0xAB, 0xAB,
+    0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+  },
+  { // 55
+    0x99, 0x9A, 0x9A, 0x9A, 0x9C, 0x9D, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA2,
+    0xA2, 0xA3, 0xA3, 0xA3, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6,
+    0xA6, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9,
+  },
+  { // 56
+    0x96, 0x96, 0x97, 0x97, 0x99, 0x9A, 0x9A, 0x9C, 0x9D, 0x9D, 0x9D, 0x9F,
+    0x9F, 0xA0, 0xA0, 0xA0, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6,
+  },
+  { // 57
+    0x91, 0x91, 0x94, 0x96, 0x96, 0x96, 0x96, 0x99, 0x9A, 0x9A, 0x9A, 0x9C,
+    0x9C, 0x9D, 0x9D, 0x9D, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0x9F, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xA0, 0xA3, 0xA3, 0xA2,
+  },
+  { // 58
+    0x8D, 0x8E, 0x90, 0x91, 0x91, 0x91, 0x93, 0x94, 0x96, 0x96, 0x96, 0x97,
+    0x97, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9C, 0x9C, 0x9C, 0x9D,
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9F, 0x9F, 0x9F,
+  },
+  { // 59
+    0x8A, 0x8B, 0x8D, 0x8D, 0x8D, 0x8E, 0x90, 0x91, 0x91, 0x91, 0x93, 0x94,
+    0x94, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A,
+    0x9A, 0x9A, 0x9A, 0x9C, 0x9C, 0x9C, 0x9C,
+  },
+  { // 60
+    0x85, 0x85, 0x87, 0x88, 0x88, 0x8A, 0x8B, 0x8D, 0x8D, 0x8D, 0x8E, 0x90,
+    0x90, 0x91, 0x91, 0x91, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x96, 0x96,
+    0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97,
+  },
+  { // 61
+    0x81, 0x82, 0x84, 0x85, 0x85, 0x87, 0x88, 0x8A, 0x8A, 0x8A, 0x8B, 0x8B,
+    0x8D, 0x8E, 0x8E, 0x8E, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x93, 0x93,
+    0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94,
+  },
+  { // 62
+    0x7E, 0x7F, 0x81, 0x81, 0x81, 0x84, 0x85, 0x85, 0x85, 0x87, 0x88, 0x87,
+    0x8A, 0x8B, 0x8B, 0x8B, 0x8D, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x90, 0x90,
+    0x90, 0x90, 0x90, 0x91, 0x90, 0x90, 0x91,
+  },
+  { // 63
+    0x79, 0x7B, 0x7C, 0x7E, 0x7E, 0x7F, 0x81, 0x81, 0x81, 0x82, 0x84, 0x84,
+    0x85, 0x87, 0x87, 0x87, 0x88, 0x88, 0x8A, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B,
+    0x8B, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8E,
+  },
+  { // 64
+    0x75, 0x78, 0x79, 0x7B, 0x7B, 0x7B, 0x7C, 0x7E, 0x7E, 0x7F, 0x81, 0x81,
+    0x82, 0x84, 0x84, 0x84, 0x85, 0x85, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88,
+    0x88, 0x8A, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B,
+  },
+  { // 65
+    0x70, 0x72, 0x73, 0x75, 0x75, 0x76, 0x78, 0x79, 0x79, 0x7B, 0x7C, 0x7C,
+    0x7E, 0x7F, 0x7F, 0x7F, 0x81, 0x81, 0x82, 0x82, 0x82, 0x84, 0x84, 0x84,
+    0x84, 0x85, 0x85, 0x85, 0x87, 0x87, 0x87,
+  },
+  { // 66
+    0x6D, 0x6F, 0x70, 0x72, 0x72, 0x73, 0x75, 0x76, 0x76, 0x78, 0x79, 0x79,
+    0x7B, 0x7C, 0x7C, 0x7C, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x81, 0x81, 0x81,
+    0x82, 0x82, 0x82, 0x84, 0x84, 0x84, 0x84,
+  },
+  { // 67
+    0x69, 0x6C, 0x6D, 0x6D, 0x6F, 0x70, 0x72, 0x73, 0x73, 0x75, 0x75, 0x76,
+    0x78, 0x79, 0x79, 0x79, 0x7B, 0x7B, 0x7C, 0x7C, 0x7B, 0x7E, 0x7E, 0x7C,
+    0x7F, 0x7F, 0x7E, 0x81, 0x81, 0x81, 0x7F,
+  },
+  { // 68
+    0x64, 0x67, 0x69, 0x69, 0x6A, 0x6C, 0x6D, 0x6F, 0x70, 0x70, 0x70, 0x72,
+    0x73, 0x75, 0x75, 0x75, 0x76, 0x76, 0x78, 0x78, 0x78, 0x79, 0x79, 0x79,
+    0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  { // 69
+    0x61, 0x63, 0x64, 0x67, 0x67, 0x69, 0x6A, 0x6C, 0x6D, 0x6D, 0x6D, 0x6F,
+    0x70, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x75, 0x76, 0x76, 0x76, 0x78,
+    0x78, 0x78, 0x79, 0x79, 0x79, 0x79, 0x7B,
+  },
+  { // 70
+    0x5D, 0x5E, 0x60, 0x61, 0x63, 0x64, 0x66, 0x67, 0x69, 0x69, 0x69, 0x6A,
+    0x6C, 0x6D, 0x6D, 0x6D, 0x6F, 0x6F, 0x6F, 0x70, 0x72, 0x72, 0x73, 0x73,
+    0x73, 0x73, 0x75, 0x75, 0x75, 0x75, 0x76,
+  },
+  { // 71
+    0x58, 0x5B, 0x5D, 0x5D, 0x5E, 0x60, 0x61, 0x63, 0x64, 0x64, 0x66, 0x67,
+    0x69, 0x6A, 0x6A, 0x6A, 0x6C, 0x6D, 0x6D, 0x6D, 0x6F, 0x6F, 0x70, 0x70,
+    0x70, 0x70, 0x72, 0x72, 0x72, 0x73, 0x73,
+  },
+  { // 72
+    0x54, 0x57, 0x58, 0x5A, 0x5A, 0x5B, 0x5D, 0x5E, 0x60, 0x60, 0x63, 0x64,
+    0x66, 0x67, 0x67, 0x67, 0x69, 0x6A, 0x6A, 0x6A, 0x6C, 0x6C, 0x6C, 0x6D,
+    0x6D, 0x6D, 0x6F, 0x6D, 0x6F, 0x70, 0x70,
+  },
+  { // 73
+    0x51, 0x52, 0x54, 0x57, 0x57, 0x58, 0x5A, 0x5B, 0x5D, 0x5D, 0x5E, 0x60,
+    0x61, 0x63, 0x63, 0x63, 0x64, 0x66, 0x66, 0x66, 0x67, 0x67, 0x69, 0x69,
+    0x69, 0x6A, 0x6A, 0x6A, 0x6C, 0x6C, 0x6C,
+  },
+  { // 74
+    0x4E, 0x4F, 0x51, 0x54, 0x54, 0x55, 0x57, 0x58, 0x5A, 0x5A, 0x5B, 0x5D,
+    0x5E, 0x60, 0x60, 0x60, 0x61, 0x63, 0x63, 0x63, 0x64, 0x64, 0x66, 0x66,
+    0x66, 0x67, 0x67, 0x69, 0x69, 0x69, 0x69,
+  },
+  { // 75
+    0x48, 0x4B, 0x4C, 0x4E, 0x4F, 0x51, 0x52, 0x54, 0x55, 0x55, 0x57, 0x58,
+    0x5A, 0x5B, 0x5B, 0x5B, 0x5D, 0x5E, 0x5E, 0x5E, 0x60, 0x61, 0x61, 0x61,
+    0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64,
+  },
+  { // 76
+    0x45, 0x48, 0x49, 0x49, 0x4C, 0x4E, 0x4F, 0x51, 0x52, 0x52, 0x54, 0x55,
+    0x57, 0x58, 0x58, 0x58, 0x5A, 0x5B, 0x5B, 0x5B, 0x5D, 0x5E, 0x5E, 0x60,
+    0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x63,
+  },
+  { // 77
+    0x42, 0x43, 0x45, 0x46, 0x48, 0x49, 0x4C, 0x4E, 0x4E, 0x4F, 0x51, 0x52,
+    0x54, 0x55, 0x55, 0x55, 0x57, 0x58, 0x58, 0x58, 0x5A, 0x5A, 0x5B, 0x5D,
+    0x5B, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x60,
+  },
+  { // 78
+    0x3D, 0x3F, 0x40, 0x43, 0x43, 0x45, 0x48, 0x49, 0x49, 0x4B, 0x4C, 0x4E,
+    0x4F, 0x51, 0x51, 0x51, 0x52, 0x54, 0x55, 0x55, 0x55, 0x57, 0x57, 0x58,
+    0x58, 0x58, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B,
+  },
+  { // 79
+    0x39, 0x3C, 0x3D, 0x3F, 0x40, 0x42, 0x43, 0x45, 0x48, 0x48, 0x49, 0x4B,
+    0x4C, 0x4E, 0x4E, 0x4E, 0x4F, 0x51, 0x52, 0x52, 0x52, 0x54, 0x54, 0x55,
+    0x55, 0x55, 0x57, 0x57, 0x57, 0x58, 0x58,
+  },
+  { // 80
+    0x34, 0x37, 0x39, 0x3A, 0x3C, 0x3D, 0x3F, 0x40, 0x43, 0x43, 0x45, 0x46,
+    0x48, 0x49, 0x49, 0x49, 0x4B, 0x4C, 0x4E, 0x4E, 0x4E, 0x4F, 0x51, 0x51,
+    0x51, 0x52, 0x52, 0x52, 0x54, 0x54, 0x54,
+  },
+  { // 81
+    0x31, 0x33, 0x34, 0x37, 0x39, 0x3A, 0x3C, 0x3D, 0x3F, 0x40, 0x42, 0x43,
+    0x45, 0x46, 0x46, 0x46, 0x48, 0x49, 0x4B, 0x4B, 0x4B, 0x4C, 0x4E, 0x4E,
+    0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x51, 0x51,
+  },
+  { // 82
+    0x2D, 0x2E, 0x31, 0x33, 0x36, 0x37, 0x39, 0x3A, 0x3A, 0x3C, 0x3D, 0x40,
+    0x42, 0x43, 0x43, 0x42, 0x45, 0x46, 0x46, 0x48, 0x48, 0x49, 0x49, 0x4B,
+    0x4B, 0x4B, 0x4C, 0x4E, 0x4C, 0x4E, 0x4E,
+  },
+  { // 83
+    0x28, 0x2B, 0x2E, 0x2E, 0x31, 0x33, 0x34, 0x36, 0x36, 0x39, 0x3A, 0x3C,
+    0x3D, 0x3F, 0x3F, 0x3F, 0x40, 0x42, 0x42, 0x43, 0x45, 0x45, 0x46, 0x46,
+    0x46, 0x48, 0x48, 0x49, 0x49, 0x49, 0x4B,
+  },
+  { // 84
+    0x25, 0x28, 0x2A, 0x2B, 0x2D, 0x2E, 0x31, 0x33, 0x33, 0x36, 0x37, 0x39,
+    0x3A, 0x3A, 0x3C, 0x3D, 0x3D, 0x3F, 0x40, 0x40, 0x42, 0x42, 0x43, 0x43,
+    0x43, 0x45, 0x45, 0x46, 0x46, 0x46, 0x48,
+  },
+  { // 85
+    0x21, 0x22, 0x24, 0x27, 0x28, 0x2A, 0x2D, 0x2E, 0x30, 0x30, 0x31, 0x34,
+    0x36, 0x36, 0x37, 0x39, 0x39, 0x3A, 0x3C, 0x3C, 0x3D, 0x3D, 0x3F, 0x40,
+    0x40, 0x40, 0x42, 0x42, 0x42, 0x43, 0x43,
+  },
+  { // 86
+    0x1C, 0x1F, 0x21, 0x24, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x2D, 0x2E, 0x31,
+    0x33, 0x33, 0x34, 0x36, 0x36, 0x37, 0x39, 0x39, 0x3A, 0x3A, 0x3C, 0x3D,
+    0x3D, 0x3D, 0x3F, 0x3F, 0x3F, 0x40, 0x40,
+  },
+  { // 87
+    0x18, 0x1C, 0x1E, 0x1F, 0x21, 0x22, 0x25, 0x27, 0x28, 0x2A, 0x2B, 0x2D,
+    0x2E, 0x30, 0x31, 0x33, 0x33, 0x34, 0x34, 0x36, 0x37, 0x37, 0x39, 0x3A,
+    0x39, 0x39, 0x3A, 0x3A, 0x3C, 0x3C, 0x3D,
+  },
+  { // 88
+    0x15, 0x18, 0x1B, 0x1B, 0x1E, 0x1F, 0x21, 0x22, 0x25, 0x25, 0x27, 0x28,
+    0x2A, 0x2D, 0x2D, 0x2E, 0x2E, 0x30, 0x31, 0x31, 0x33, 0x34, 0x34, 0x36,
+    0x36, 0x36, 0x37, 0x37, 0x39, 0x39, 0x39,
+  },
+  { // 89
+    0x12, 0x15, 0x16, 0x18, 0x1B, 0x1C, 0x1E, 0x1F, 0x22, 0x22, 0x24, 0x25,
+    0x27, 0x2A, 0x2A, 0x2B, 0x2B, 0x2D, 0x2E, 0x2E, 0x30, 0x31, 0x31, 0x31,
+    0x33, 0x34, 0x34, 0x36, 0x36, 0x36, 0x36,
+  },
+  { // 90
+    0x0C, 0x0F, 0x10, 0x13, 0x15, 0x16, 0x19, 0x1C, 0x1E, 0x1E, 0x1F, 0x21,
+    0x22, 0x24, 0x25, 0x27, 0x28, 0x28, 0x28, 0x2A, 0x2B, 0x2D, 0x2D, 0x2D,
+    0x2E, 0x30, 0x30, 0x31, 0x31, 0x31, 0x33,
+  },
+};
+
+#else
+
+// 眼球在巩膜贴图的(x, y)处时上眼睑跟随的阈值，按[y][x / 3]索引
+const uint8_t lid_follow_default[91][31] = {
+  { // 0
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  },
+  { // 1
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D,
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D,
+  },
+  { // 2
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D,
+    0x7D, 0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 0x7B,
+    0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B,
+  },
+  { // 3
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7C, 0x7B, 0x7B,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+  },
+  { // 4
+    0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7C, 0x7B, 0x7B, 0x7B, 0x7A, 0x7A, 0x79,
+    0x79, 0x79, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x76,
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75,
+  },
+  { // 5
+    0x7C, 0x7C, 0x7B, 0x7B, 0x7A, 0x79, 0x79, 0x78, 0x77, 0x77, 0x77, 0x76,
+    0x76, 0x76, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x71,
+  },
+  { // 6
+    0x7A, 0x79, 0x78, 0x77, 0x77, 0x77, 0x76, 0x75, 0x75, 0x75, 0x75, 0x74,
+    0x74, 0x74, 0x73, 0x73, 0x73, 0x71, 0x71, 0x71, 0x71, 0x71, 0x6F, 0x6F,
+    0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E,
+  },
+  { // 7
+    0x77, 0x76, 0x75, 0x75, 0x75, 0x75, 0x74, 0x73, 0x73, 0x73, 0x73, 0x72,
+    0x72, 0x71, 0x70, 0x70, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6C, 0x6B, 0x6B,
+    0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+  },
+  { // 8
+    0x75, 0x74, 0x73, 0x73, 0x73, 0x71, 0x71, 0x70, 0x6F, 0x6F, 0x6F, 0x6D,
+    0x6D, 0x6D, 0x6C, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x66,
+  },
+  { // 9
+    0x73, 0x71, 0x70, 0x70, 0x6F, 0x6D, 0x6D, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63,
+  },
+  { // 10
+    0x6E, 0x6C, 0x6B, 0x6A, 0x6A, 0x69, 0x68, 0x68, 0x67, 0x66, 0x66, 0x65,
+    0x65, 0x65, 0x64, 0x63, 0x62, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x60,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+  },
+  { // 11
+    0x69, 0x69, 0x67, 0x66, 0x66, 0x65, 0x64, 0x63, 0x63, 0x62, 0x62, 0x60,
+    0x60, 0x60, 0x60, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B,
+  },
+  { // 12
+    0x65, 0x64, 0x63, 0x63, 0x62, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5D, 0x5D,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x59, 0x59, 0x59,
+    0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x58,
+  },
+  { // 13
+    0x61, 0x5F, 0x5E, 0x5E, 0x5E, 0x5D, 0x5C, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A,
+    0x59, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x55, 0x55,
+    0x55, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  },
+  { // 14
+    0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x59, 0x58, 0x58, 0x58, 0x57, 0x56, 0x55,
+    0x55, 0x55, 0x54, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x51, 0x51,
+    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+  },
+  { // 15
+    0x58, 0x57, 0x56, 0x55, 0x54, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x50,
+    0x50, 0x50, 0x50, 0x50, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+    0x4D, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C,
+  },
+  { // 16
+    0x53, 0x52, 0x52, 0x52, 0x51, 0x50, 0x4F, 0x4E, 0x4E, 0x4E, 0x4D, 0x4D,
+    0x4D, 0x4D, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  },
+  { // 17
+    0x4F, 0x4E, 0x4F, 0x4E, 0x4D, 0x4C, 0x4B, 0x4A, 0x4B, 0x4A, 0x48, 0x4A,
+    0x48, 0x48, 0x47, 0x47, 0x48, 0x47, 0x47, 0x46, 0x46, 0x46, 0x45, 0x45,
+    0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  },
+  { // 18
+    0x4B, 0x4A, 0x4A, 0x4A, 0x49, 0x48, 0x48, 0x47, 0x47, 0x46, 0x46, 0x45,
+    0x44, 0x44, 0x45, 0x45, 0x44, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41,
+  },
+  { // 19
+    0x48, 0x47, 0x45, 0x45, 0x45, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x42,
+    0x42, 0x42, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+  },
+  { // 20
+    0x41, 0x41, 0x40, 0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3B, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+    0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x39, 0x39,
+  },
+  { // 21
+    0x3E, 0x3D, 0x3D, 0x3D, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3A, 0x39, 0x39,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37,
+    0x37, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36,
+  },
+  { // 22
+    0x39, 0x38, 0x38, 0x38, 0x38, 0x36, 0x37, 0x37, 0x36, 0x36, 0x36, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x34, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  },
+  { // 23
+    0x34, 0x34, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+  },
+  { // 24
+    0x32, 0x31, 0x30, 0x30, 0x30, 0x2F, 0x2F, 0x2E, 0x2E, 0x2E, 0x2D, 0x2D,
+    0x2D, 0x2D, 0x2D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2B,
+  },
+  { // 25
+    0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+  },
+  { // 26
+    0x27, 0x27, 0x26, 0x26, 0x26, 0x27, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+  },
+  { // 27
+    0x23, 0x22, 0x22, 0x23, 0x22, 0x22, 0x21, 0x21, 0x21, 0x21, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  },
+  { // 28
+    0x1F, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+    0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+  },
+  { // 29
+    0x1A, 0x1B, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+  },
+  { // 30
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x14, 0x14, 0x14, 0x15, 0x15,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  },
+  { // 31
+    0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x0F, 0x0F, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11,
+  },
+  { // 32
+    0x0D, 0x0C, 0x0C, 0x0C, 0x0D, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D,
+  },
+  { // 33
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x09, 0x09, 0x08, 0x08, 0x08,
+  },
+  { // 34
+    0x03, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06,
+  },
+  { // 35
+    0xFE, 0xFF, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02,
+  },
+  { // 36
+    0xFA, 0xFA, 0xF9, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+    0xFA, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xFC, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+  },
+  { // 37
+    0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 0xF5, 0xF5, 0xF6, 0xF6,
+    0xF6, 0xF6, 0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF9, 0xF9,
+    0xF9, 0xF8, 0xF9, 0xFA, 0xFA, 0xFA, 0xF9,
+  },
+  { // 38
+    0xF0, 0xF0, 0xF1, 0xF2, 0xF2, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3,
+    0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF5, 0xF5,
+    0xF5, 0xF5, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6,
+  },
+  { // 39
+    0xEC, 0xED, 0xEC, 0xED, 0xED, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF2, 0xF2,
+    0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3,
+  },
+  { // 40
+    0xE6, 0xE7, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9,
+    0xEA, 0xEA, 0xEA, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEC, 0xEC, 0xEC, 0xEC,
+    0xEC, 0xEC, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+  },
+  { // 41
+    0xE1, 0xE2, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE4, 0xE4, 0xE4, 0xE4, 0xE6,
+    0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE9, 0xE9,
+    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
+  },
+  { // 42
+    0xDD, 0xDE, 0xDE, 0xDE, 0xDF, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xE0, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE4, 0xE5,
+    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+  },
+  { // 43
+    0xD9, 0xDA, 0xDA, 0xDA, 0xDA, 0xDB, 0xDB, 0xDD, 0xDD, 0xDD, 0xDD, 0xDE,
+    0xDE, 0xDE, 0xDE, 0xDF, 0xDF, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE1,
+    0xE1, 0xE1, 0xE2, 0xE2, 0xE2, 0xE2, 0xE3,
+  },
+  { // 44
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD7, 0xD7, 0xD7, 0xD9, 0xD9, 0xD9, 0xDA, 0xDA,
+    0xDB, 0xDB, 0xDB, 0xDB, 0xDC, 0xDD, 0xDD, 0xDD, 0xDE, 0xDE, 0xDE, 0xDE,
+    0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xE0,
+  },
+  { // 45
+    0xCF, 0xCF, 0xD0, 0xD0, 0xD0, 0xD1, 0xD1, 0xD2, 0xD3, 0xD3, 0xD4, 0xD4,
+    0xD5, 0xD5, 0xD5, 0xD5, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD9,
+    0xD9, 0xD9, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA,
+  },
+  { // 46
+    0xCB, 0xCC, 0xCC, 0xCD, 0xCD, 0xCD, 0xCE, 0xCE, 0xCF, 0xCF, 0xCF, 0xD0,
+    0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD3, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5,
+    0xD5, 0xD6, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+  },
+  { // 47
+    0xC6, 0xC7, 0xC8, 0xC8, 0xC9, 0xC9, 0xC9, 0xCA, 0xCA, 0xCB, 0xCB, 0xCB,
+    0xCD, 0xCD, 0xCD, 0xCD, 0xCE, 0xCF, 0xCF, 0xCF, 0xD0, 0xD0, 0xD0, 0xD2,
+    0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD4,
+  },
+  { // 48
+    0xC0, 0xC1, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC5, 0xC5, 0xC6, 0xC7, 0xC7,
+    0xC8, 0xC8, 0xC8, 0xC9, 0xC9, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCC, 0xCD,
+    0xCD, 0xCD, 0xCE, 0xCE, 0xCE, 0xCE, 0xCF,
+  },
+  { // 49
+    0xBC, 0xBC, 0xBE, 0xBF, 0xBF, 0xC0, 0xC0, 0xC1, 0xC2, 0xC2, 0xC3, 0xC3,
+    0xC4, 0xC5, 0xC5, 0xC6, 0xC6, 0xC7, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+    0xC9, 0xCA, 0xCA, 0xCB, 0xCB, 0xCB, 0xCB,
+  },
+  { // 50
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBA, 0xBB, 0xBB, 0xBC, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xBF, 0xBF, 0xC0, 0xC0, 0xC2, 0xC2, 0xC2, 0xC2, 0xC3, 0xC3, 0xC4,
+    0xC4, 0xC4, 0xC5, 0xC5, 0xC6, 0xC6, 0xC6,
+  },
+  { // 51
+    0xB1, 0xB2, 0xB4, 0xB5, 0xB5, 0xB6, 0xB6, 0xB8, 0xB9, 0xB9, 0xB9, 0xBB,
+    0xBB, 0xBC, 0xBC, 0xBD, 0xBE, 0xBE, 0xBE, 0xBF, 0xC0, 0xC0, 0xC1, 0xC1,
+    0xC1, 0xC1, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  },
+  { // 52
+    0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB1, 0xB2, 0xB3, 0xB4, 0xB4, 0xB5, 0xB6,
+    0xB7, 0xB7, 0xB7, 0xB9, 0xB9, 0xBA, 0xBB, 0xBB, 0xBB, 0xBC, 0xBC, 0xBE,
+    0xBE, 0xBE, 0xBE, 0xBE, 0xC0, 0xC0, 0xBF,
+  },
+  { // 53
+    0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAC, 0xAD, 0xAF, 0xAF, 0xB0, 0xB0, 0xB2,
+    0xB2, 0xB3, 0xB3, 0xB4, 0xB5, 0xB5, 0xB7, 0xB7, 0xB7, 0xB7, 0xB8, 0xB9,
+    0xB9, 0xB9, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB,
+  },
+  { // 54
+    0xA3, 0xA4, 0xA5, 0xA7, 0xA7, 0xA8, 0xAA, 0xAA, 0xAA, 0xAB, 0xAD, 0xAD,
+    0xAF, 0xAF, 0xAF, 0xB0, 0xB1, 0xB2, 0xB2, 0xB2, 0xB4, 0xB4, 0xB4, 0xB4,
+    0xB5, 0xB6, 0xB7, 0xB7, 0xB7, 0xB7, 0xB8,
+  },
+  { // 55
+    0x9D, 0x9E, 0x9E, 0xA0, 0xA1, 0xA2, 0xA2, 0xA4, 0xA5, 0xA5, 0xA6, 0xA7,
+    0xA9, 0xA9, 0xA9, 0xAA, 0xAB, 0xAC, 0xAC, 0xAC, 0xAE, 0xAE, 0xAE, 0xAF,
+    0xB0, 0xB0, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2,
+  },
+  { // 56
+    0x98, 0x99, 0x9B, 0x9C, 0x9D, 0x9D, 0x9F, 0x9F, 0xA1, 0xA2, 0xA2, 0xA4,
+    0xA4, 0xA4, 0xA6, 0xA7, 0xA7, 0xA9, 0xA9, 0xA9, 0xAA, 0xAB, 0xAB, 0xAC,
+    0xAD, 0xAD, 0xAD, 0xAE, 0xAF, 0xAF, 0xAF,
+  },
+  { // 57
+    0x93, 0x95, 0x97, 0x97, 0x98, 0x9A, 0x9A, 0x9C, 0x9D, 0x9D, 0x9F, 0x9F,
+    0xA1, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA6, 0xA6, 0xA8, 0xA8, 0xA8,
+    0xA9, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAC,
+  },
+  { // 58
+    0x8F, 0x90, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B,
+    0x9C, 0x9D, 0x9D, 0x9F, 0x9F, 0xA1, 0xA1, 0xA1, 0xA2, 0xA3, 0xA4, 0xA4,
+    0xA4, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA8,
+  },
+  { // 59
+    0x89, 0x8B, 0x8C, 0x8E, 0x8F, 0x8F, 0x91, 0x93, 0x93, 0x94, 0x95, 0x96,
+    0x98, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9D, 0x9D, 0x9F, 0x9F, 0xA0,
+    0xA1, 0xA1, 0xA1, 0xA3, 0xA3, 0xA3, 0xA3,
+  },
+  { // 60
+    0x83, 0x85, 0x86, 0x87, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91,
+    0x92, 0x93, 0x94, 0x94, 0x96, 0x96, 0x98, 0x98, 0x98, 0x9A, 0x9A, 0x9B,
+    0x9B, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F,
+  },
+  { // 61
+    0x7D, 0x7F, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x89, 0x89, 0x8B, 0x8D,
+    0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x93, 0x94, 0x95, 0x96, 0x96,
+    0x97, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A,
+  },
+  { // 62
+    0x79, 0x7A, 0x7C, 0x7E, 0x7F, 0x7F, 0x82, 0x84, 0x85, 0x85, 0x86, 0x88,
+    0x8A, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x8F, 0x91, 0x91, 0x93, 0x93,
+    0x93, 0x94, 0x95, 0x95, 0x96, 0x97, 0x97,
+  },
+  { // 63
+    0x73, 0x76, 0x77, 0x79, 0x7A, 0x7B, 0x7C, 0x7F, 0x81, 0x81, 0x82, 0x84,
+    0x85, 0x86, 0x86, 0x88, 0x88, 0x8A, 0x8C, 0x8C, 0x8C, 0x8D, 0x8E, 0x8E,
+    0x8F, 0x90, 0x90, 0x91, 0x92, 0x92, 0x92,
+  },
+  { // 64
+    0x6E, 0x71, 0x73, 0x74, 0x75, 0x76, 0x78, 0x7A, 0x7B, 0x7C, 0x7D, 0x7F,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x87, 0x87, 0x88, 0x89, 0x8A, 0x8A,
+    0x8B, 0x8C, 0x8C, 0x8D, 0x8D, 0x8E, 0x8E,
+  },
+  { // 65
+    0x68, 0x6A, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x78, 0x79,
+    0x7A, 0x7C, 0x7D, 0x7E, 0x7F, 0x81, 0x81, 0x81, 0x83, 0x83, 0x85, 0x85,
+    0x85, 0x87, 0x87, 0x88, 0x89, 0x89, 0x89,
+  },
+  { // 66
+    0x62, 0x64, 0x66, 0x68, 0x6A, 0x6B, 0x6D, 0x6F, 0x70, 0x72, 0x73, 0x74,
+    0x75, 0x77, 0x78, 0x79, 0x7A, 0x7C, 0x7D, 0x7D, 0x7E, 0x7F, 0x80, 0x82,
+    0x82, 0x82, 0x83, 0x84, 0x84, 0x85, 0x85,
+  },
+  { // 67
+    0x5B, 0x60, 0x61, 0x62, 0x64, 0x67, 0x69, 0x6A, 0x6B, 0x6D, 0x6F, 0x71,
+    0x72, 0x73, 0x74, 0x74, 0x76, 0x77, 0x78, 0x7A, 0x7A, 0x7C, 0x7D, 0x7D,
+    0x7E, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x82,
+  },
+  { // 68
+    0x57, 0x5A, 0x5B, 0x5D, 0x5F, 0x60, 0x63, 0x65, 0x67, 0x69, 0x6A, 0x6C,
+    0x6E, 0x6E, 0x6F, 0x71, 0x72, 0x73, 0x74, 0x75, 0x77, 0x77, 0x79, 0x79,
+    0x79, 0x7B, 0x7B, 0x7C, 0x7D, 0x7D, 0x7D,
+  },
+  { // 69
+    0x51, 0x54, 0x55, 0x58, 0x5A, 0x5C, 0x5E, 0x60, 0x62, 0x63, 0x64, 0x66,
+    0x68, 0x6A, 0x6A, 0x6C, 0x6E, 0x6E, 0x6F, 0x70, 0x72, 0x72, 0x74, 0x75,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x79, 0x79,
+  },
+  { // 70
+    0x4A, 0x4D, 0x4F, 0x52, 0x54, 0x56, 0x58, 0x5A, 0x5C, 0x5D, 0x5E, 0x60,
+    0x62, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6B, 0x6C, 0x6E, 0x6F, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x74, 0x74,
+  },
+  { // 71
+    0x44, 0x47, 0x49, 0x4E, 0x4F, 0x51, 0x53, 0x55, 0x57, 0x58, 0x5A, 0x5C,
+    0x5D, 0x5F, 0x60, 0x62, 0x63, 0x65, 0x67, 0x66, 0x68, 0x69, 0x6B, 0x6B,
+    0x6C, 0x6D, 0x6F, 0x6F, 0x6F, 0x70, 0x71,
+  },
+  { // 72
+    0x3D, 0x41, 0x45, 0x47, 0x49, 0x4B, 0x4E, 0x51, 0x52, 0x53, 0x55, 0x57,
+    0x59, 0x5B, 0x5B, 0x5D, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x65, 0x65, 0x66,
+    0x67, 0x69, 0x69, 0x6B, 0x6A, 0x6B, 0x6C,
+  },
+  { // 73
+    0x38, 0x3C, 0x3E, 0x41, 0x44, 0x46, 0x48, 0x4B, 0x4D, 0x4F, 0x50, 0x52,
+    0x54, 0x56, 0x56, 0x58, 0x5A, 0x5C, 0x5D, 0x5D, 0x5F, 0x60, 0x61, 0x61,
+    0x63, 0x64, 0x65, 0x66, 0x66, 0x66, 0x68,
+  },
+  { // 74
+    0x31, 0x36, 0x37, 0x3B, 0x3F, 0x41, 0x43, 0x45, 0x46, 0x4A, 0x4C, 0x4E,
+    0x4F, 0x51, 0x53, 0x55, 0x57, 0x58, 0x58, 0x59, 0x5B, 0x5D, 0x5E, 0x5F,
+    0x5F, 0x60, 0x61, 0x62, 0x63, 0x63, 0x64,
+  },
+  { // 75
+    0x2A, 0x2F, 0x31, 0x34, 0x36, 0x39, 0x3C, 0x3F, 0x41, 0x42, 0x44, 0x46,
+    0x48, 0x4B, 0x4C, 0x4D, 0x4F, 0x51, 0x53, 0x53, 0x55, 0x57, 0x57, 0x57,
+    0x59, 0x5B, 0x5B, 0x5D, 0x5D, 0x5D, 0x5E,
+  },
+  { // 76
+    0x23, 0x27, 0x2C, 0x2F, 0x31, 0x34, 0x36, 0x39, 0x3B, 0x3D, 0x3F, 0x41,
+    0x43, 0x46, 0x47, 0x49, 0x4B, 0x4D, 0x4E, 0x4F, 0x50, 0x52, 0x54, 0x55,
+    0x55, 0x56, 0x58, 0x58, 0x5A, 0x5A, 0x5A,
+  },
+  { // 77
+    0x1D, 0x20, 0x24, 0x28, 0x2C, 0x2E, 0x31, 0x33, 0x36, 0x39, 0x3B, 0x3D,
+    0x3F, 0x42, 0x43, 0x45, 0x47, 0x48, 0x49, 0x4A, 0x4C, 0x4D, 0x4E, 0x50,
+    0x50, 0x51, 0x53, 0x54, 0x55, 0x55, 0x56,
+  },
+  { // 78
+    0x18, 0x1B, 0x1E, 0x20, 0x25, 0x27, 0x2B, 0x2E, 0x32, 0x32, 0x35, 0x38,
+    0x3A, 0x3B, 0x3E, 0x3F, 0x41, 0x43, 0x44, 0x46, 0x47, 0x48, 0x4A, 0x4B,
+    0x4C, 0x4C, 0x4E, 0x4F, 0x51, 0x51, 0x51,
+  },
+  { // 79
+    0x14, 0x16, 0x19, 0x1B, 0x1E, 0x21, 0x24, 0x27, 0x2B, 0x2D, 0x30, 0x33,
+    0x35, 0x36, 0x39, 0x3B, 0x3D, 0x3F, 0x41, 0x41, 0x43, 0x45, 0x47, 0x48,
+    0x48, 0x49, 0x4A, 0x4B, 0x4D, 0x4D, 0x4D,
+  },
+  { // 80
+    0x0F, 0x11, 0x14, 0x17, 0x18, 0x19, 0x1D, 0x21, 0x24, 0x26, 0x28, 0x2C,
+    0x2E, 0x30, 0x32, 0x34, 0x36, 0x38, 0x39, 0x3A, 0x3C, 0x3D, 0x3F, 0x41,
+    0x41, 0x43, 0x44, 0x46, 0x46, 0x46, 0x48,
+  },
+  { // 81
+    0x08, 0x0D, 0x0F, 0x11, 0x14, 0x16, 0x17, 0x19, 0x1D, 0x20, 0x22, 0x26,
+    0x29, 0x2A, 0x2D, 0x2F, 0x31, 0x33, 0x35, 0x36, 0x38, 0x3A, 0x3B, 0x3C,
+    0x3D, 0x3E, 0x40, 0x40, 0x42, 0x42, 0x43,
+  },
+  { // 82
+    0x02, 0x07, 0x0A, 0x0C, 0x0F, 0x11, 0x14, 0x15, 0x17, 0x1A, 0x1C, 0x20,
+    0x23, 0x25, 0x27, 0x2A, 0x2C, 0x2E, 0x2F, 0x32, 0x33, 0x35, 0x37, 0x38,
+    0x38, 0x3A, 0x3B, 0x3C, 0x3E, 0x3E, 0x3E,
+  },
+  { // 83
+    0x00, 0x02, 0x04, 0x07, 0x0A, 0x0C, 0x0F, 0x11, 0x13, 0x15, 0x17, 0x1A,
+    0x1D, 0x20, 0x21, 0x24, 0x27, 0x29, 0x2A, 0x2C, 0x2E, 0x30, 0x31, 0x33,
+    0x34, 0x35, 0x37, 0x38, 0x39, 0x39, 0x3A,
+  },
+  { // 84
+    0x00, 0x00, 0x01, 0x02, 0x04, 0x07, 0x0A, 0x0D, 0x0F, 0x11, 0x13, 0x16,
+    0x19, 0x1A, 0x1D, 0x20, 0x22, 0x24, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x2E,
+    0x2F, 0x31, 0x32, 0x34, 0x35, 0x36, 0x36,
+  },
+  { // 85
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x08, 0x0B, 0x0D, 0x0E, 0x10,
+    0x11, 0x13, 0x16, 0x18, 0x1C, 0x1F, 0x20, 0x21, 0x23, 0x25, 0x26, 0x28,
+    0x29, 0x2A, 0x2C, 0x2E, 0x2F, 0x30, 0x30,
+  },
+  { // 86
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x07, 0x09, 0x0B,
+    0x0E, 0x10, 0x0F, 0x11, 0x15, 0x18, 0x1B, 0x1C, 0x1D, 0x1F, 0x20, 0x23,
+    0x24, 0x26, 0x27, 0x28, 0x2A, 0x2A, 0x2B,
+  },
+  { // 87
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x07,
+    0x09, 0x0B, 0x0C, 0x0E, 0x10, 0x12, 0x13, 0x16, 0x18, 0x1A, 0x1B, 0x1D,
+    0x1F, 0x20, 0x23, 0x23, 0x24, 0x25, 0x27,
+  },
+  { // 88
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x03, 0x05, 0x08, 0x09, 0x0B, 0x0D, 0x0E, 0x11, 0x12, 0x15, 0x17, 0x19,
+    0x1A, 0x1B, 0x1D, 0x1F, 0x1F, 0x21, 0x22,
+  },
+  { // 89
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x04, 0x06, 0x08, 0x0B, 0x0A, 0x0C, 0x0F, 0x11, 0x13,
+    0x14, 0x16, 0x18, 0x1A, 0x1B, 0x1C, 0x1D,
+  },
+  { // 90
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x06, 0x06, 0x08, 0x09, 0x0A, 0x0C,
+    0x0D, 0x0F, 0x12, 0x13, 0x13, 0x15, 0x16,
+  },
+};
+
+#endif // SYMMETRICAL_EYELID
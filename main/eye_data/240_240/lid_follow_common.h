@@ -0,0 +1,1649 @@
+// 由 scripts/gen_eye_lid_spans.py 根据 upper_lower_common.h 生成，请勿手动修改
+#pragma once
+#include "common.h"
+
+#ifdef SYMMETRICAL_EYELID
+
+// 眼球在巩膜贴图的(x, y)处时上眼睑跟随的阈值，按[y][x / 3]索引
+const uint8_t lid_follow_default[136][46] = {
+  { // 0
+    0x72, 0x71, 0x6F, 0x6F, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B,
+    0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x66, 0x66, 0x66, 0x66, 0x65,
+    0x65, 0x65, 0x65, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62,
+    0x62, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  },
+  { // 1
+    0x6E, 0x6E, 0x6C, 0x6C, 0x6B, 0x6B, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68,
+    0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x63, 0x63, 0x63, 0x63, 0x62,
+    0x62, 0x62, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+  },
+  { // 2
+    0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65,
+    0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62, 0x60, 0x60, 0x60, 0x60, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+  },
+  { // 3
+    0x68, 0x68, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x63, 0x63, 0x63, 0x63,
+    0x62, 0x62, 0x62, 0x62, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5D,
+    0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+  },
+  { // 4
+    0x66, 0x65, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x60, 0x60, 0x60, 0x60,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x59, 0x57, 0x57,
+    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56,
+  },
+  { // 5
+    0x65, 0x63, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5D, 0x5D,
+    0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x59,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x57, 0x57, 0x57, 0x57, 0x57, 0x54, 0x54,
+    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x54, 0x54, 0x53, 0x53,
+  },
+  { // 6
+    0x62, 0x60, 0x5F, 0x5F, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x59, 0x59, 0x59, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x56,
+    0x56, 0x56, 0x56, 0x56, 0x56, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51,
+  },
+  { // 7
+    0x5F, 0x5D, 0x5C, 0x5C, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x57, 0x57,
+    0x57, 0x57, 0x56, 0x56, 0x56, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  },
+  { // 8
+    0x5C, 0x5C, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x57, 0x57, 0x56, 0x56,
+    0x56, 0x56, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x51,
+    0x51, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+    0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+  },
+  { // 9
+    0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53,
+    0x53, 0x53, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4E,
+    0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+    0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B,
+  },
+  { // 10
+    0x56, 0x54, 0x54, 0x54, 0x54, 0x54, 0x51, 0x51, 0x53, 0x53, 0x50, 0x50,
+    0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4B,
+    0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A,
+    0x4A, 0x4A, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  },
+  { // 11
+    0x54, 0x53, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E,
+    0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4A,
+    0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+    0x48, 0x48, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+  },
+  { // 12
+    0x51, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4B, 0x4B,
+    0x4B, 0x4B, 0x4A, 0x4A, 0x4A, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x47,
+    0x47, 0x47, 0x47, 0x47, 0x47, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  },
+  { // 13
+    0x4E, 0x4E, 0x4D, 0x4D, 0x4B, 0x4B, 0x4B, 0x4B, 0x4A, 0x4A, 0x4A, 0x4A,
+    0x4A, 0x4A, 0x48, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  },
+  { // 14
+    0x4B, 0x4B, 0x4A, 0x4A, 0x48, 0x48, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47,
+    0x47, 0x47, 0x45, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41,
+    0x41, 0x41, 0x41, 0x41, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  },
+  { // 15
+    0x48, 0x48, 0x48, 0x48, 0x45, 0x45, 0x47, 0x47, 0x44, 0x44, 0x45, 0x45,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41,
+    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x3C, 0x3C, 0x3E, 0x3E,
+  },
+  { // 16
+    0x45, 0x45, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42,
+    0x41, 0x41, 0x41, 0x41, 0x41, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B,
+  },
+  { // 17
+    0x44, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3B,
+    0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x39, 0x39, 0x39, 0x39,
+    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x38,
+  },
+  { // 18
+    0x41, 0x41, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x39,
+    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x36,
+  },
+  { // 19
+    0x3E, 0x3E, 0x3C, 0x3C, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+    0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36,
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  },
+  { // 20
+    0x3B, 0x3B, 0x39, 0x39, 0x3B, 0x3B, 0x38, 0x38, 0x39, 0x39, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x33, 0x33, 0x32, 0x32,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  },
+  { // 21
+    0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x36, 0x36, 0x36, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  },
+  { // 22
+    0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x33, 0x33, 0x33, 0x33, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  },
+  { // 23
+    0x35, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+    0x2F, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+  },
+  { // 24
+    0x30, 0x30, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2D, 0x2D, 0x2D, 0x2D,
+    0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+    0x2A, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  },
+  { // 25
+    0x2D, 0x2F, 0x2C, 0x2C, 0x2C, 0x2C, 0x2D, 0x2D, 0x2A, 0x2A, 0x2A, 0x2A,
+    0x2A, 0x2A, 0x2A, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x29, 0x29, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x26, 0x26,
+  },
+  { // 26
+    0x2C, 0x2C, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x24, 0x24, 0x24, 0x24,
+  },
+  { // 27
+    0x29, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x21, 0x21, 0x21, 0x21,
+  },
+  { // 28
+    0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+    0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x20, 0x20,
+  },
+  { // 29
+    0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+    0x21, 0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D,
+  },
+  { // 30
+    0x21, 0x20, 0x21, 0x21, 0x21, 0x21, 0x1E, 0x1E, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1B, 0x1B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1B, 0x1B,
+  },
+  { // 31
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+    0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+  },
+  { // 32
+    0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  },
+  { // 33
+    0x1A, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+    0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+  },
+  { // 34
+    0x17, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+  },
+  { // 35
+    0x14, 0x12, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x12, 0x12,
+    0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  },
+  { // 36
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+  },
+  { // 37
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  },
+  { // 38
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  },
+  { // 39
+    0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  },
+  { // 40
+    0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  },
+  { // 41
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  },
+  { // 42
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  { // 43
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  },
+  { // 44
+    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+  },
+  { // 45
+    0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+  },
+  { // 46
+    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF7, 0xF7, 0xF7,
+    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  },
+  { // 47
+    0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+  },
+  { // 48
+    0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+    0xF1, 0xF1, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+    0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+    0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  },
+  { // 49
+    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+    0xEE, 0xEE, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  },
+  { // 50
+    0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED,
+    0xEB, 0xEB, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+    0xED, 0xED, 0xED, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+  },
+  { // 51
+    0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xEA, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB,
+    0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB,
+    0xEB, 0xEB, 0xEB, 0xEB, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED,
+  },
+  { // 52
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xE7, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
+  },
+  { // 53
+    0xE4, 0xE4, 0xE4, 0xE4, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+    0xE5, 0xE5, 0xE5, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  },
+  { // 54
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+    0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE5, 0xE5,
+    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+  },
+  { // 55
+    0xDF, 0xDF, 0xDE, 0xDE, 0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+    0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE2, 0xE2, 0xE4, 0xE4,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+  },
+  { // 56
+    0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDE, 0xDE, 0xDE, 0xDE,
+    0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+    0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xE1, 0xE1, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1,
+  },
+  { // 57
+    0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xDB, 0xDB, 0xDB, 0xDB,
+    0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
+    0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDE, 0xDE, 0xDE, 0xDE,
+    0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE,
+  },
+  { // 58
+    0xD6, 0xD6, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9, 0xD9, 0xD9,
+    0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB,
+    0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
+    0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
+  },
+  { // 59
+    0xD3, 0xD3, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+    0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
+    0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
+  },
+  { // 60
+    0xD0, 0xD0, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD5, 0xD5,
+    0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+    0xD8, 0xD8, 0xD8, 0xD8, 0xD6, 0xD6, 0xD6, 0xD6, 0xD8, 0xD8,
+  },
+  { // 61
+    0xCF, 0xCF, 0xCF, 0xCF, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD2, 0xD2,
+    0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+    0xD3, 0xD3, 0xD3, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5,
+    0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6,
+  },
+  { // 62
+    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCD, 0xCD, 0xCD, 0xCD, 0xCF, 0xCF,
+    0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+    0xD0, 0xD0, 0xD0, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+    0xD2, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+  },
+  { // 63
+    0xC9, 0xC9, 0xCA, 0xCA, 0xCA, 0xCA, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+    0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+    0xCF, 0xCF, 0xCF, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+    0xD0, 0xD0, 0xD0, 0xD0, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+  },
+  { // 64
+    0xC6, 0xC6, 0xC7, 0xC7, 0xC7, 0xC7, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+    0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+    0xCC, 0xCC, 0xCC, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
+    0xCD, 0xCD, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+  },
+  { // 65
+    0xC3, 0xC3, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC7, 0xC7, 0xC6, 0xC6,
+    0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+    0xCA, 0xCA, 0xCA, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCA, 0xCA,
+    0xCC, 0xCC, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
+  },
+  { // 66
+    0xC1, 0xC1, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4,
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+    0xC7, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+    0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+  },
+  { // 67
+    0xBE, 0xBE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+    0xC4, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC7, 0xC7,
+    0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+  },
+  { // 68
+    0xBD, 0xBD, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC6, 0xC6,
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+  },
+  { // 69
+    0xBA, 0xBA, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD,
+    0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC4,
+  },
+  { // 70
+    0xB7, 0xB7, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8, 0xB8, 0xBA, 0xBA, 0xBA, 0xBA,
+    0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+    0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xC1, 0xC1, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC3,
+  },
+  { // 71
+    0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB7, 0xB7, 0xB7, 0xB7, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+    0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE,
+    0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xC0, 0xC0, 0xC0, 0xC0,
+  },
+  { // 72
+    0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB4, 0xB4, 0xB4, 0xB4, 0xB5, 0xB5,
+    0xB5, 0xB5, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB,
+    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD,
+  },
+  { // 73
+    0xAF, 0xAF, 0xB1, 0xB1, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB4, 0xB4,
+    0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+    0xB7, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+    0xBA, 0xBA, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  },
+  { // 74
+    0xAC, 0xAC, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB1, 0xB1,
+    0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+    0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+    0xB7, 0xB7, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+  },
+  { // 75
+    0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAE, 0xAE, 0xAF, 0xAF,
+    0xAF, 0xAF, 0xAF, 0xB1, 0xB1, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+    0xB2, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+    0xB5, 0xB5, 0xB4, 0xB4, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+  },
+  { // 76
+    0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAB, 0xAB, 0xAC, 0xAC,
+    0xAC, 0xAC, 0xAC, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+    0xAF, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+    0xB2, 0xB2, 0xB2, 0xB2, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+  },
+  { // 77
+    0xA3, 0xA3, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA8, 0xA8, 0xA8, 0xA8,
+    0xA9, 0xA9, 0xA9, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+    0xAC, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+    0xAF, 0xAF, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+  },
+  { // 78
+    0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6,
+    0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+    0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+    0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+  },
+  { // 79
+    0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3,
+    0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9,
+    0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+    0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+  },
+  { // 80
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0xA0, 0xA0, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA3, 0xA3, 0xA3, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA8,
+    0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8,
+    0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xA9, 0xA9, 0xAB, 0xAB,
+  },
+  { // 81
+    0x9A, 0x9A, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D, 0x9D, 0x9F, 0x9F, 0x9F, 0x9F,
+    0xA0, 0xA0, 0xA0, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+    0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9,
+  },
+  { // 82
+    0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9C, 0x9C, 0x9C, 0x9C,
+    0x9D, 0x9D, 0x9D, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6,
+  },
+  { // 83
+    0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A,
+    0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0,
+    0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3,
+    0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA5, 0xA5, 0xA5, 0xA5,
+  },
+  { // 84
+    0x91, 0x91, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97,
+    0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D,
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0,
+    0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA2, 0xA2, 0xA2, 0xA2,
+  },
+  { // 85
+    0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x93, 0x93, 0x94, 0x94,
+    0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99, 0x9A,
+    0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+  },
+  { // 86
+    0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x90, 0x90, 0x91, 0x91, 0x93, 0x93,
+    0x93, 0x93, 0x94, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9C, 0x9C, 0x9C, 0x9C,
+    0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+  },
+  { // 87
+    0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8D, 0x8D, 0x8E, 0x8E, 0x90, 0x90,
+    0x90, 0x90, 0x91, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
+  },
+  { // 88
+    0x87, 0x87, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8B, 0x8D, 0x8D, 0x8E, 0x8E,
+    0x8E, 0x8E, 0x90, 0x91, 0x91, 0x91, 0x91, 0x93, 0x93, 0x93, 0x93, 0x94,
+    0x94, 0x94, 0x94, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97,
+    0x97, 0x97, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  },
+  { // 89
+    0x84, 0x84, 0x85, 0x85, 0x87, 0x87, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8B,
+    0x8B, 0x8B, 0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x90, 0x90, 0x90, 0x90, 0x91,
+    0x91, 0x91, 0x91, 0x93, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+  },
+  { // 90
+    0x81, 0x81, 0x82, 0x82, 0x85, 0x85, 0x87, 0x87, 0x88, 0x88, 0x8A, 0x8A,
+    0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x90,
+    0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x90, 0x90, 0x93, 0x93, 0x93, 0x93,
+    0x91, 0x91, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x93, 0x94,
+  },
+  { // 91
+    0x7F, 0x7F, 0x81, 0x81, 0x82, 0x82, 0x84, 0x84, 0x85, 0x85, 0x87, 0x87,
+    0x87, 0x87, 0x88, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8D,
+    0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x90, 0x90, 0x90, 0x90,
+    0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x93,
+  },
+  { // 92
+    0x7C, 0x7C, 0x7E, 0x7E, 0x7F, 0x7F, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82,
+    0x84, 0x84, 0x85, 0x85, 0x85, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x8A,
+    0x8A, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+    0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x90, 0x90,
+  },
+  { // 93
+    0x79, 0x7B, 0x7C, 0x7C, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x81, 0x81,
+    0x82, 0x82, 0x84, 0x84, 0x84, 0x85, 0x85, 0x87, 0x87, 0x87, 0x87, 0x88,
+    0x88, 0x88, 0x88, 0x8A, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E,
+  },
+  { // 94
+    0x76, 0x78, 0x79, 0x79, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x7E, 0x7E,
+    0x7F, 0x7F, 0x81, 0x81, 0x81, 0x82, 0x82, 0x84, 0x84, 0x84, 0x84, 0x85,
+    0x85, 0x85, 0x85, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B,
+  },
+  { // 95
+    0x73, 0x75, 0x76, 0x76, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x7C, 0x7C,
+    0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x84,
+    0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x87, 0x87, 0x87, 0x87, 0x85, 0x85,
+    0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x8A, 0x8A, 0x8A, 0x8A,
+  },
+  { // 96
+    0x72, 0x72, 0x73, 0x73, 0x75, 0x75, 0x76, 0x76, 0x78, 0x78, 0x79, 0x79,
+    0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x81,
+    0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+    0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x87, 0x87, 0x87, 0x87,
+  },
+  { // 97
+    0x6F, 0x6F, 0x70, 0x70, 0x72, 0x72, 0x73, 0x73, 0x75, 0x75, 0x76, 0x76,
+    0x78, 0x78, 0x79, 0x79, 0x79, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 0x7C, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  },
+  { // 98
+    0x6D, 0x6D, 0x6F, 0x6F, 0x70, 0x70, 0x72, 0x72, 0x73, 0x73, 0x75, 0x75,
+    0x76, 0x76, 0x78, 0x78, 0x78, 0x79, 0x79, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C,
+    0x7C, 0x7C, 0x7C, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+  },
+  { // 99
+    0x6A, 0x6A, 0x6C, 0x6C, 0x6D, 0x6D, 0x6F, 0x6F, 0x70, 0x70, 0x72, 0x72,
+    0x73, 0x73, 0x73, 0x73, 0x75, 0x76, 0x76, 0x78, 0x78, 0x78, 0x78, 0x79,
+    0x79, 0x79, 0x79, 0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 0x7C, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x81,
+  },
+  { // 100
+    0x66, 0x67, 0x69, 0x6A, 0x6C, 0x6A, 0x6C, 0x6C, 0x6D, 0x6D, 0x6F, 0x6F,
+    0x70, 0x70, 0x70, 0x70, 0x72, 0x73, 0x73, 0x75, 0x75, 0x75, 0x75, 0x76,
+    0x76, 0x76, 0x76, 0x78, 0x78, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7B, 0x7B,
+    0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7E, 0x7F,
+  },
+  { // 101
+    0x63, 0x64, 0x66, 0x67, 0x69, 0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6D, 0x6D,
+    0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x75,
+    0x75, 0x75, 0x75, 0x76, 0x76, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79,
+    0x79, 0x79, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C, 0x7C,
+  },
+  { // 102
+    0x60, 0x61, 0x63, 0x64, 0x66, 0x66, 0x67, 0x67, 0x69, 0x69, 0x6A, 0x6A,
+    0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70, 0x72,
+    0x72, 0x72, 0x72, 0x73, 0x73, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76,
+    0x76, 0x76, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79,
+  },
+  { // 103
+    0x60, 0x60, 0x60, 0x61, 0x63, 0x64, 0x66, 0x66, 0x67, 0x67, 0x69, 0x69,
+    0x6A, 0x6A, 0x6A, 0x6A, 0x6C, 0x6D, 0x6D, 0x6F, 0x6F, 0x6F, 0x6F, 0x70,
+    0x70, 0x70, 0x70, 0x72, 0x72, 0x73, 0x73, 0x73, 0x75, 0x75, 0x75, 0x75,
+    0x75, 0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x78,
+  },
+  { // 104
+    0x5D, 0x5D, 0x5D, 0x5E, 0x60, 0x61, 0x63, 0x63, 0x64, 0x64, 0x66, 0x66,
+    0x67, 0x67, 0x67, 0x67, 0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x75, 0x75,
+  },
+  { // 105
+    0x5A, 0x5B, 0x5B, 0x5B, 0x5D, 0x5E, 0x60, 0x60, 0x61, 0x61, 0x63, 0x63,
+    0x64, 0x64, 0x66, 0x66, 0x67, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6C,
+    0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70,
+    0x6F, 0x6F, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73,
+  },
+  { // 106
+    0x55, 0x58, 0x5A, 0x5A, 0x5B, 0x5B, 0x5D, 0x5D, 0x5E, 0x5E, 0x60, 0x60,
+    0x61, 0x61, 0x63, 0x64, 0x64, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x69,
+    0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70,
+  },
+  { // 107
+    0x52, 0x54, 0x55, 0x57, 0x58, 0x58, 0x5A, 0x5A, 0x5B, 0x5B, 0x5D, 0x5D,
+    0x5E, 0x5E, 0x60, 0x61, 0x61, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x66,
+    0x66, 0x67, 0x67, 0x67, 0x67, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6A,
+    0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D,
+  },
+  { // 108
+    0x51, 0x52, 0x54, 0x55, 0x57, 0x57, 0x58, 0x58, 0x5A, 0x5A, 0x5B, 0x5B,
+    0x5D, 0x5D, 0x5E, 0x60, 0x60, 0x61, 0x61, 0x63, 0x63, 0x63, 0x63, 0x64,
+    0x64, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x69, 0x69, 0x69, 0x69,
+    0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6C, 0x6C, 0x6C, 0x6C,
+  },
+  { // 109
+    0x4F, 0x4F, 0x51, 0x52, 0x54, 0x54, 0x55, 0x55, 0x57, 0x57, 0x58, 0x58,
+    0x5A, 0x5A, 0x5B, 0x5D, 0x5D, 0x5E, 0x5E, 0x60, 0x60, 0x60, 0x60, 0x61,
+    0x61, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66,
+    0x67, 0x67, 0x67, 0x67, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6A,
+  },
+  { // 110
+    0x4C, 0x4E, 0x4F, 0x4F, 0x51, 0x52, 0x54, 0x54, 0x55, 0x55, 0x57, 0x57,
+    0x58, 0x58, 0x5A, 0x5B, 0x5B, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x60,
+    0x60, 0x61, 0x61, 0x61, 0x61, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64,
+    0x66, 0x66, 0x64, 0x64, 0x67, 0x67, 0x67, 0x67, 0x66, 0x69,
+  },
+  { // 111
+    0x49, 0x4B, 0x4C, 0x4C, 0x4E, 0x4F, 0x51, 0x51, 0x52, 0x52, 0x54, 0x54,
+    0x55, 0x55, 0x57, 0x58, 0x58, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5D,
+    0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x60, 0x61, 0x61, 0x61, 0x61, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66,
+  },
+  { // 112
+    0x46, 0x48, 0x49, 0x49, 0x4B, 0x4C, 0x4E, 0x4E, 0x4F, 0x4F, 0x51, 0x51,
+    0x52, 0x52, 0x54, 0x55, 0x55, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x5A,
+    0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x60, 0x60,
+    0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x63, 0x63,
+  },
+  { // 113
+    0x45, 0x46, 0x48, 0x48, 0x49, 0x49, 0x4B, 0x4C, 0x4E, 0x4E, 0x4F, 0x4F,
+    0x51, 0x51, 0x52, 0x54, 0x54, 0x55, 0x55, 0x57, 0x57, 0x57, 0x57, 0x58,
+    0x58, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61,
+  },
+  { // 114
+    0x42, 0x42, 0x43, 0x45, 0x46, 0x46, 0x48, 0x48, 0x4B, 0x4B, 0x4C, 0x4C,
+    0x4E, 0x4E, 0x4F, 0x51, 0x51, 0x52, 0x52, 0x54, 0x54, 0x54, 0x54, 0x55,
+    0x55, 0x57, 0x57, 0x58, 0x58, 0x58, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B,
+    0x5B, 0x5B, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E,
+  },
+  { // 115
+    0x3F, 0x3F, 0x40, 0x42, 0x43, 0x43, 0x45, 0x45, 0x48, 0x48, 0x49, 0x49,
+    0x4B, 0x4B, 0x4C, 0x4E, 0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x51, 0x51, 0x52,
+    0x52, 0x54, 0x54, 0x57, 0x57, 0x55, 0x58, 0x57, 0x57, 0x57, 0x58, 0x58,
+    0x58, 0x58, 0x5A, 0x5A, 0x5A, 0x5A, 0x5D, 0x5D, 0x5B, 0x5B,
+  },
+  { // 116
+    0x3C, 0x3D, 0x3F, 0x3F, 0x40, 0x42, 0x43, 0x43, 0x45, 0x46, 0x48, 0x48,
+    0x49, 0x49, 0x4B, 0x4C, 0x4C, 0x4E, 0x4E, 0x4F, 0x4F, 0x4F, 0x4F, 0x51,
+    0x51, 0x52, 0x52, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x57, 0x57,
+    0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x5A, 0x5A, 0x5A, 0x5A,
+  },
+  { // 117
+    0x39, 0x3A, 0x3C, 0x3C, 0x3D, 0x3F, 0x40, 0x40, 0x42, 0x43, 0x45, 0x45,
+    0x46, 0x46, 0x48, 0x49, 0x49, 0x4B, 0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x4E,
+    0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x54, 0x54,
+    0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x57,
+  },
+  { // 118
+    0x37, 0x39, 0x3A, 0x3A, 0x3C, 0x3D, 0x3F, 0x3F, 0x40, 0x42, 0x43, 0x43,
+    0x45, 0x45, 0x46, 0x48, 0x48, 0x49, 0x49, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C,
+    0x4C, 0x4E, 0x4E, 0x4F, 0x4F, 0x4F, 0x4F, 0x51, 0x52, 0x52, 0x52, 0x52,
+    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0x57,
+  },
+  { // 119
+    0x34, 0x36, 0x37, 0x37, 0x39, 0x3A, 0x3C, 0x3C, 0x3D, 0x3F, 0x40, 0x40,
+    0x42, 0x42, 0x43, 0x45, 0x45, 0x46, 0x46, 0x48, 0x48, 0x48, 0x48, 0x49,
+    0x49, 0x4B, 0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x4E, 0x4F, 0x4F, 0x4F, 0x4F,
+    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x54,
+  },
+  { // 120
+    0x33, 0x33, 0x34, 0x36, 0x37, 0x37, 0x39, 0x3A, 0x3C, 0x3C, 0x3D, 0x3F,
+    0x40, 0x40, 0x42, 0x43, 0x43, 0x45, 0x45, 0x46, 0x46, 0x46, 0x46, 0x48,
+    0x48, 0x49, 0x49, 0x4B, 0x4B, 0x49, 0x49, 0x4C, 0x4E, 0x4E, 0x4E, 0x4E,
+    0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x51, 0x51, 0x4F, 0x52,
+  },
+  { // 121
+    0x30, 0x30, 0x31, 0x33, 0x34, 0x34, 0x36, 0x37, 0x39, 0x39, 0x3A, 0x3C,
+    0x3D, 0x3F, 0x3F, 0x40, 0x40, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43, 0x45,
+    0x45, 0x46, 0x46, 0x48, 0x48, 0x48, 0x48, 0x49, 0x4B, 0x4B, 0x4B, 0x4B,
+    0x4C, 0x4C, 0x4C, 0x4C, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F,
+  },
+  { // 122
+    0x2B, 0x2D, 0x2E, 0x30, 0x31, 0x31, 0x33, 0x34, 0x36, 0x36, 0x37, 0x37,
+    0x39, 0x3A, 0x3C, 0x3D, 0x3D, 0x3F, 0x3F, 0x40, 0x40, 0x40, 0x40, 0x42,
+    0x42, 0x43, 0x43, 0x45, 0x45, 0x46, 0x46, 0x46, 0x48, 0x48, 0x48, 0x48,
+    0x49, 0x49, 0x49, 0x49, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x4C,
+  },
+  { // 123
+    0x2A, 0x2B, 0x2D, 0x2D, 0x2E, 0x30, 0x31, 0x31, 0x34, 0x34, 0x36, 0x36,
+    0x37, 0x39, 0x3A, 0x3C, 0x3C, 0x3D, 0x3D, 0x3F, 0x3F, 0x3F, 0x3F, 0x40,
+    0x40, 0x42, 0x42, 0x43, 0x43, 0x45, 0x45, 0x45, 0x46, 0x46, 0x46, 0x46,
+    0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x4B, 0x4B,
+  },
+  { // 124
+    0x27, 0x28, 0x2A, 0x2A, 0x2B, 0x2D, 0x2E, 0x2E, 0x31, 0x31, 0x33, 0x33,
+    0x34, 0x36, 0x37, 0x39, 0x39, 0x3A, 0x3A, 0x3C, 0x3C, 0x3D, 0x3D, 0x3D,
+    0x3D, 0x3F, 0x3F, 0x40, 0x40, 0x42, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43,
+    0x45, 0x45, 0x45, 0x45, 0x46, 0x46, 0x46, 0x46, 0x48, 0x48,
+  },
+  { // 125
+    0x25, 0x25, 0x27, 0x27, 0x28, 0x2B, 0x2D, 0x2B, 0x30, 0x30, 0x31, 0x31,
+    0x33, 0x33, 0x34, 0x36, 0x37, 0x39, 0x39, 0x3A, 0x3A, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3D, 0x3D, 0x3F, 0x3F, 0x40, 0x40, 0x40, 0x42, 0x42, 0x42, 0x42,
+    0x43, 0x43, 0x43, 0x43, 0x45, 0x45, 0x45, 0x45, 0x46, 0x46,
+  },
+  { // 126
+    0x22, 0x22, 0x24, 0x25, 0x27, 0x28, 0x2A, 0x2A, 0x2D, 0x2D, 0x2E, 0x2E,
+    0x30, 0x30, 0x31, 0x33, 0x34, 0x36, 0x36, 0x37, 0x37, 0x39, 0x39, 0x39,
+    0x39, 0x3A, 0x3A, 0x3C, 0x3C, 0x3D, 0x3D, 0x3D, 0x3F, 0x3F, 0x40, 0x40,
+    0x40, 0x40, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43,
+  },
+  { // 127
+    0x1F, 0x1F, 0x21, 0x22, 0x24, 0x25, 0x27, 0x27, 0x2A, 0x2A, 0x2B, 0x2B,
+    0x2D, 0x2D, 0x2E, 0x30, 0x31, 0x33, 0x33, 0x34, 0x34, 0x36, 0x36, 0x36,
+    0x36, 0x37, 0x37, 0x39, 0x39, 0x3A, 0x3A, 0x3A, 0x3C, 0x3C, 0x3D, 0x3D,
+    0x3D, 0x3D, 0x3F, 0x3F, 0x3F, 0x3F, 0x40, 0x40, 0x40, 0x40,
+  },
+  { // 128
+    0x1C, 0x1E, 0x1F, 0x21, 0x22, 0x24, 0x25, 0x25, 0x28, 0x28, 0x2A, 0x2A,
+    0x2B, 0x2B, 0x2D, 0x2E, 0x30, 0x31, 0x31, 0x33, 0x33, 0x34, 0x34, 0x34,
+    0x34, 0x36, 0x36, 0x37, 0x37, 0x39, 0x39, 0x39, 0x3A, 0x3A, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3D, 0x3D, 0x3D, 0x3D, 0x3F, 0x3F, 0x3F, 0x3F,
+  },
+  { // 129
+    0x19, 0x1B, 0x1C, 0x1E, 0x1F, 0x1F, 0x21, 0x22, 0x24, 0x25, 0x27, 0x27,
+    0x28, 0x28, 0x2A, 0x2A, 0x2B, 0x2D, 0x2E, 0x30, 0x30, 0x31, 0x31, 0x31,
+    0x31, 0x33, 0x33, 0x34, 0x34, 0x36, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39,
+    0x39, 0x39, 0x3A, 0x3A, 0x3A, 0x3A, 0x3C, 0x3C, 0x3C, 0x3D,
+  },
+  { // 130
+    0x18, 0x19, 0x1B, 0x1B, 0x1C, 0x1C, 0x1E, 0x21, 0x21, 0x22, 0x24, 0x24,
+    0x25, 0x25, 0x27, 0x27, 0x28, 0x2A, 0x2D, 0x2E, 0x2D, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x30, 0x30, 0x31, 0x31, 0x33, 0x36, 0x36, 0x34, 0x34, 0x36, 0x36,
+    0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3C,
+  },
+  { // 131
+    0x15, 0x16, 0x18, 0x18, 0x19, 0x1B, 0x1C, 0x1E, 0x1F, 0x21, 0x22, 0x22,
+    0x24, 0x24, 0x25, 0x25, 0x27, 0x28, 0x2A, 0x2B, 0x2B, 0x2D, 0x2D, 0x2D,
+    0x2D, 0x2E, 0x2E, 0x30, 0x30, 0x31, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34,
+    0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39,
+  },
+  { // 132
+    0x12, 0x13, 0x15, 0x15, 0x16, 0x18, 0x19, 0x1B, 0x1C, 0x1E, 0x1F, 0x1F,
+    0x21, 0x21, 0x22, 0x22, 0x24, 0x25, 0x27, 0x28, 0x28, 0x2A, 0x2A, 0x2A,
+    0x2A, 0x2B, 0x2B, 0x2D, 0x2D, 0x2E, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31,
+    0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x36,
+  },
+  { // 133
+    0x0F, 0x10, 0x12, 0x13, 0x15, 0x16, 0x18, 0x18, 0x1B, 0x1C, 0x1E, 0x1E,
+    0x1F, 0x1F, 0x21, 0x22, 0x22, 0x22, 0x24, 0x25, 0x27, 0x28, 0x28, 0x2A,
+    0x2A, 0x2A, 0x2A, 0x2B, 0x2B, 0x2D, 0x2E, 0x2E, 0x2E, 0x2E, 0x30, 0x30,
+    0x31, 0x31, 0x31, 0x31, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34,
+  },
+  { // 134
+    0x0C, 0x0D, 0x0F, 0x10, 0x12, 0x13, 0x15, 0x15, 0x18, 0x19, 0x1B, 0x1B,
+    0x1C, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x21, 0x22, 0x24, 0x25, 0x25, 0x27,
+    0x27, 0x27, 0x27, 0x28, 0x28, 0x2A, 0x2B, 0x2B, 0x2B, 0x2B, 0x2D, 0x2D,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31,
+  },
+  { // 135
+    0x09, 0x0A, 0x0C, 0x0F, 0x10, 0x12, 0x13, 0x12, 0x16, 0x16, 0x18, 0x19,
+    0x1B, 0x1B, 0x1C, 0x1E, 0x1E, 0x1C, 0x1E, 0x1F, 0x22, 0x24, 0x24, 0x25,
+    0x25, 0x25, 0x25, 0x27, 0x27, 0x28, 0x2A, 0x2A, 0x2A, 0x2A, 0x2B, 0x2B,
+    0x2D, 0x2D, 0x2B, 0x2B, 0x2E, 0x2E, 0x2D, 0x2D, 0x30, 0x30,
+  },
+};
+
+#else
+
+// 眼球在巩膜贴图的(x, y)处时上眼睑跟随的阈值，按[y][x / 3]索引
+const uint8_t lid_follow_default[136][46] = {
+  { // 0
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D,
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  { // 1
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7C, 0x7C, 0x7C,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B,
+    0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B,
+  },
+  { // 2
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D,
+    0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79,
+    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+  },
+  { // 3
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7C, 0x7C,
+    0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79,
+    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+  },
+  { // 4
+    0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 0x7B,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76,
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75,
+  },
+  { // 5
+    0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7B, 0x7B, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x76,
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75,
+    0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  },
+  { // 6
+    0x7C, 0x7C, 0x7B, 0x7B, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78,
+    0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75,
+    0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x71, 0x71, 0x71,
+  },
+  { // 7
+    0x7A, 0x7A, 0x79, 0x79, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76,
+    0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x73,
+    0x73, 0x71, 0x71, 0x72, 0x72, 0x71, 0x71, 0x71, 0x71, 0x71, 0x6F, 0x6F,
+    0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E,
+  },
+  { // 8
+    0x79, 0x78, 0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
+    0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x71,
+    0x71, 0x70, 0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C,
+  },
+  { // 9
+    0x77, 0x76, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73,
+    0x72, 0x72, 0x72, 0x72, 0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6F, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A,
+    0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x69, 0x69,
+  },
+  { // 10
+    0x75, 0x74, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x71, 0x71,
+    0x6F, 0x6F, 0x6F, 0x6F, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B,
+    0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x69, 0x69, 0x67, 0x67,
+    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66,
+  },
+  { // 11
+    0x74, 0x73, 0x71, 0x71, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6F, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x69, 0x69, 0x69,
+    0x69, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66,
+    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64,
+  },
+  { // 12
+    0x71, 0x70, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6A, 0x6A,
+    0x6A, 0x6A, 0x69, 0x69, 0x68, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66,
+    0x66, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61,
+  },
+  { // 13
+    0x6F, 0x6E, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69,
+    0x68, 0x68, 0x68, 0x68, 0x67, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x61, 0x61, 0x61, 0x61, 0x61,
+    0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  },
+  { // 14
+    0x6C, 0x6B, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66,
+    0x65, 0x65, 0x65, 0x65, 0x64, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x60,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+  },
+  { // 15
+    0x69, 0x69, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63,
+    0x62, 0x62, 0x62, 0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5D,
+    0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B,
+  },
+  { // 16
+    0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60,
+    0x5F, 0x5F, 0x5F, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B,
+    0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x59, 0x59,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58,
+  },
+  { // 17
+    0x62, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D,
+    0x5D, 0x5D, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x58,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x57, 0x56, 0x56, 0x56, 0x56,
+    0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  },
+  { // 18
+    0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B,
+    0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x56,
+    0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54,
+    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  },
+  { // 19
+    0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58,
+    0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51,
+    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+  },
+  { // 20
+    0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+    0x54, 0x54, 0x55, 0x55, 0x52, 0x53, 0x53, 0x52, 0x52, 0x51, 0x51, 0x52,
+    0x52, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x50, 0x50,
+    0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+  },
+  { // 21
+    0x58, 0x57, 0x56, 0x56, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x52, 0x52, 0x52, 0x52, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4F,
+    0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4D,
+    0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C,
+  },
+  { // 22
+    0x54, 0x54, 0x53, 0x53, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+    0x4F, 0x4F, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4C,
+    0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4A, 0x4A,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  },
+  { // 23
+    0x51, 0x51, 0x51, 0x51, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4D,
+    0x4D, 0x4D, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A,
+    0x4A, 0x4A, 0x4A, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47,
+  },
+  { // 24
+    0x4D, 0x4D, 0x4D, 0x4D, 0x4C, 0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4A, 0x4A,
+    0x49, 0x49, 0x48, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+    0x47, 0x47, 0x47, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  },
+  { // 25
+    0x4B, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x48, 0x48, 0x49, 0x49, 0x47, 0x47,
+    0x47, 0x47, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44,
+    0x44, 0x45, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x42, 0x42, 0x42, 0x42,
+  },
+  { // 26
+    0x49, 0x48, 0x47, 0x47, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x45, 0x45,
+    0x44, 0x44, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x42,
+    0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  },
+  { // 27
+    0x46, 0x45, 0x44, 0x44, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x42, 0x42,
+    0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D,
+    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+  },
+  { // 28
+    0x43, 0x43, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+    0x3D, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3B, 0x3B,
+    0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+  },
+  { // 29
+    0x40, 0x40, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+    0x3A, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  },
+  { // 30
+    0x3D, 0x3D, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3A, 0x3A, 0x3B, 0x3B,
+    0x39, 0x39, 0x38, 0x38, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38,
+    0x38, 0x37, 0x37, 0x37, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37,
+    0x37, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+  },
+  { // 31
+    0x39, 0x39, 0x39, 0x39, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x34, 0x34, 0x34, 0x33, 0x33, 0x34, 0x34,
+    0x34, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  },
+  { // 32
+    0x36, 0x36, 0x35, 0x35, 0x35, 0x35, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x33, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  },
+  { // 33
+    0x34, 0x34, 0x33, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x32, 0x31, 0x31,
+    0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2F, 0x2F, 0x2F,
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2E, 0x2E,
+  },
+  { // 34
+    0x32, 0x31, 0x30, 0x30, 0x30, 0x30, 0x2F, 0x2F, 0x2F, 0x2F, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2B, 0x2B,
+  },
+  { // 35
+    0x2F, 0x2E, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2A, 0x2A, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x29, 0x29, 0x29,
+    0x29, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+    0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x29, 0x29,
+  },
+  { // 36
+    0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+  },
+  { // 37
+    0x28, 0x28, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+  },
+  { // 38
+    0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  },
+  { // 39
+    0x21, 0x21, 0x21, 0x21, 0x20, 0x20, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F,
+  },
+  { // 40
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+  },
+  { // 41
+    0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B,
+    0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+  },
+  { // 42
+    0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x19, 0x19, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18,
+  },
+  { // 43
+    0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  },
+  { // 44
+    0x14, 0x14, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x14, 0x14, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  },
+  { // 45
+    0x12, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x0F, 0x0F, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11,
+  },
+  { // 46
+    0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E,
+  },
+  { // 47
+    0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+  },
+  { // 48
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  },
+  { // 49
+    0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  },
+  { // 50
+    0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05,
+  },
+  { // 51
+    0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
+    0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+  },
+  { // 52
+    0xFC, 0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xFB,
+    0xFB, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+    0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF,
+  },
+  { // 53
+    0xF9, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF9, 0xF9, 0xF9, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xFB,
+    0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+  },
+  { // 54
+    0xF4, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xF4, 0xF4, 0xF4, 0xF5, 0xF5,
+    0xF5, 0xF5, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6,
+    0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+  },
+  { // 55
+    0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF1, 0xF1, 0xF1, 0xF1, 0xF3, 0xF3,
+    0xF3, 0xF3, 0xF3, 0xF4, 0xF4, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+    0xF3, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF6, 0xF6, 0xF6, 0xF6,
+    0xF7, 0xF7, 0xF5, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6,
+  },
+  { // 56
+    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+    0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3,
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+  },
+  { // 57
+    0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC,
+    0xED, 0xED, 0xED, 0xED, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+    0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  },
+  { // 58
+    0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xEA, 0xEA, 0xE9, 0xE9, 0xE9, 0xE9,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC,
+    0xEC, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xEE, 0xEE, 0xEE, 0xEE,
+    0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0,
+  },
+  { // 59
+    0xE5, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE7, 0xE7, 0xE6, 0xE6, 0xE6, 0xE6,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
+    0xE9, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEB, 0xEB, 0xEB, 0xEB,
+    0xEB, 0xEB, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xED,
+  },
+  { // 60
+    0xE2, 0xE2, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE4, 0xE4,
+    0xE4, 0xE4, 0xE4, 0xE5, 0xE5, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+    0xE6, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE9, 0xE9, 0xE8, 0xE8,
+    0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xEA,
+  },
+  { // 61
+    0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+    0xE3, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE6, 0xE6, 0xE6, 0xE6,
+    0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+  },
+  { // 62
+    0xDB, 0xDC, 0xDB, 0xDB, 0xDC, 0xDC, 0xDC, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD,
+    0xDD, 0xDD, 0xDE, 0xDF, 0xDF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE2, 0xE2, 0xE3, 0xE3,
+    0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  },
+  { // 63
+    0xD9, 0xDA, 0xD9, 0xD9, 0xDA, 0xDA, 0xDA, 0xDA, 0xDB, 0xDB, 0xDB, 0xDB,
+    0xDB, 0xDB, 0xDC, 0xDD, 0xDD, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDF,
+    0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+  },
+  { // 64
+    0xD6, 0xD6, 0xD5, 0xD6, 0xD6, 0xD7, 0xD7, 0xD7, 0xD7, 0xD8, 0xD9, 0xD9,
+    0xD9, 0xD9, 0xDA, 0xDA, 0xDA, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDC,
+    0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE,
+    0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xE0, 0xE0,
+  },
+  { // 65
+    0xD3, 0xD3, 0xD2, 0xD3, 0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD5, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xDA,
+    0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDB, 0xDA, 0xDB, 0xDB, 0xDB, 0xDC, 0xDC,
+    0xDC, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDE,
+  },
+  { // 66
+    0xCF, 0xCF, 0xD0, 0xD0, 0xD0, 0xD0, 0xD1, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2,
+    0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD7,
+    0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9,
+    0xD9, 0xD9, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDB,
+  },
+  { // 67
+    0xCC, 0xCC, 0xCD, 0xCD, 0xCD, 0xCD, 0xCE, 0xCE, 0xCE, 0xCE, 0xCF, 0xCF,
+    0xD0, 0xD0, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD4,
+    0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD8,
+  },
+  { // 68
+    0xC9, 0xCA, 0xCB, 0xCB, 0xCB, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCD, 0xCD,
+    0xCD, 0xCD, 0xCE, 0xCE, 0xCE, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD1,
+    0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD4, 0xD4,
+    0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6,
+  },
+  { // 69
+    0xC5, 0xC6, 0xC6, 0xC6, 0xC7, 0xC7, 0xC8, 0xC8, 0xC9, 0xC9, 0xC9, 0xC9,
+    0xC9, 0xC9, 0xCA, 0xCA, 0xCA, 0xCC, 0xCC, 0xCB, 0xCB, 0xCC, 0xCC, 0xCC,
+    0xCC, 0xCE, 0xCE, 0xCE, 0xCE, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xD1, 0xD1,
+    0xD0, 0xD0, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD3, 0xD2,
+  },
+  { // 70
+    0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC3, 0xC4, 0xC4, 0xC5, 0xC5, 0xC5, 0xC5,
+    0xC6, 0xC6, 0xC7, 0xC7, 0xC7, 0xC8, 0xC8, 0xC8, 0xC8, 0xC9, 0xC9, 0xC9,
+    0xC9, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCC, 0xCC, 0xCD, 0xCD,
+    0xCD, 0xCD, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCF, 0xCF,
+  },
+  { // 71
+    0xBE, 0xBE, 0xBF, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2,
+    0xC4, 0xC4, 0xC4, 0xC5, 0xC5, 0xC5, 0xC5, 0xC7, 0xC7, 0xC7, 0xC7, 0xC8,
+    0xC8, 0xC8, 0xC8, 0xC9, 0xC9, 0xC9, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCD,
+  },
+  { // 72
+    0xBB, 0xBB, 0xBC, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xC1, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC5,
+    0xC5, 0xC5, 0xC5, 0xC6, 0xC6, 0xC6, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+    0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xCA,
+  },
+  { // 73
+    0xB8, 0xB9, 0xB9, 0xB9, 0xBB, 0xBB, 0xBC, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD,
+    0xBE, 0xBE, 0xBE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC2,
+    0xC2, 0xC3, 0xC3, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC6, 0xC6,
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC7, 0xC7, 0xC8, 0xC8,
+  },
+  { // 74
+    0xB5, 0xB6, 0xB6, 0xB6, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xBA, 0xBA, 0xBA,
+    0xBB, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBF,
+    0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC4, 0xC4, 0xC5, 0xC5,
+  },
+  { // 75
+    0xB2, 0xB2, 0xB4, 0xB4, 0xB5, 0xB5, 0xB6, 0xB6, 0xB6, 0xB7, 0xB8, 0xB8,
+    0xB9, 0xB9, 0xB9, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xBC, 0xBC, 0xBC, 0xBD,
+    0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBF, 0xBF, 0xBF, 0xC0, 0xC0, 0xC1, 0xC1,
+    0xC0, 0xC0, 0xC2, 0xC2, 0xC2, 0xC2, 0xC3, 0xC3, 0xC3, 0xC3,
+  },
+  { // 76
+    0xAF, 0xAF, 0xB0, 0xB0, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB5, 0xB5,
+    0xB5, 0xB6, 0xB6, 0xB8, 0xB8, 0xB8, 0xB8, 0xB9, 0xB9, 0xBA, 0xBA, 0xBB,
+    0xBB, 0xBB, 0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE,
+    0xBE, 0xBE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1,
+  },
+  { // 77
+    0xAA, 0xAB, 0xAB, 0xAB, 0xAD, 0xAD, 0xAE, 0xAE, 0xAF, 0xAF, 0xB0, 0xB0,
+    0xB1, 0xB1, 0xB2, 0xB3, 0xB3, 0xB4, 0xB4, 0xB4, 0xB4, 0xB6, 0xB6, 0xB6,
+    0xB6, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xBB, 0xBB,
+    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD,
+  },
+  { // 78
+    0xA7, 0xA8, 0xA8, 0xA8, 0xAA, 0xAA, 0xAB, 0xAB, 0xAD, 0xAD, 0xAD, 0xAD,
+    0xAE, 0xAE, 0xB0, 0xB0, 0xB0, 0xB2, 0xB2, 0xB2, 0xB2, 0xB3, 0xB3, 0xB4,
+    0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB8, 0xB8,
+    0xB9, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBB, 0xBC,
+  },
+  { // 79
+    0xA4, 0xA4, 0xA5, 0xA5, 0xA7, 0xA7, 0xA8, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAB, 0xAB, 0xAD, 0xAD, 0xAD, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0, 0xB0, 0xB1,
+    0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB5, 0xB5,
+    0xB6, 0xB6, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB8, 0xB9,
+  },
+  { // 80
+    0xA0, 0xA1, 0xA1, 0xA2, 0xA4, 0xA4, 0xA5, 0xA5, 0xA7, 0xA7, 0xA7, 0xA7,
+    0xA8, 0xA8, 0xA9, 0xAA, 0xAA, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAE,
+    0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB2, 0xB2,
+    0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB4, 0xB4, 0xB5, 0xB6,
+  },
+  { // 81
+    0x9D, 0x9E, 0x9E, 0x9F, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA4, 0xA4,
+    0xA5, 0xA5, 0xA6, 0xA7, 0xA7, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB,
+    0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xB0, 0xB0,
+    0xB0, 0xB0, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB3,
+  },
+  { // 82
+    0x9A, 0x9B, 0x9B, 0x9C, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA1, 0xA1,
+    0xA2, 0xA2, 0xA3, 0xA4, 0xA4, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8,
+    0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAD, 0xAD,
+    0xAD, 0xAD, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0,
+  },
+  { // 83
+    0x97, 0x98, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9D, 0x9E, 0x9E, 0x9E,
+    0xA0, 0xA0, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6,
+    0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB,
+    0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAE, 0xAE,
+  },
+  { // 84
+    0x93, 0x94, 0x96, 0x97, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9B, 0x9B,
+    0x9C, 0x9D, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3,
+    0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7,
+    0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xAB, 0xAB,
+  },
+  { // 85
+    0x90, 0x90, 0x92, 0x92, 0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x98, 0x98,
+    0x98, 0x99, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9F, 0x9F, 0x9F,
+    0x9F, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4,
+    0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA6, 0xA6, 0xA8, 0xA8,
+  },
+  { // 86
+    0x8D, 0x8D, 0x8D, 0x8E, 0x8F, 0x90, 0x90, 0x91, 0x93, 0x93, 0x94, 0x95,
+    0x95, 0x95, 0x97, 0x97, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9C, 0x9C,
+    0x9C, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5,
+  },
+  { // 87
+    0x89, 0x8A, 0x8A, 0x8B, 0x8C, 0x8D, 0x8D, 0x8E, 0x90, 0x90, 0x91, 0x92,
+    0x92, 0x92, 0x94, 0x94, 0x95, 0x96, 0x96, 0x97, 0x97, 0x98, 0x99, 0x99,
+    0x99, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F,
+    0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2,
+  },
+  { // 88
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x8F, 0x8F, 0x91, 0x92, 0x93, 0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x97,
+    0x97, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C,
+    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xA0, 0xA0, 0xA0, 0xA0,
+  },
+  { // 89
+    0x82, 0x83, 0x84, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8A, 0x8B, 0x8C,
+    0x8C, 0x8C, 0x8E, 0x8F, 0x90, 0x90, 0x90, 0x92, 0x92, 0x93, 0x93, 0x94,
+    0x94, 0x95, 0x95, 0x96, 0x96, 0x97, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99,
+    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D,
+  },
+  { // 90
+    0x7E, 0x7F, 0x80, 0x81, 0x83, 0x83, 0x84, 0x84, 0x86, 0x87, 0x88, 0x88,
+    0x89, 0x89, 0x8B, 0x8C, 0x8D, 0x8D, 0x8D, 0x8F, 0x8F, 0x8F, 0x90, 0x91,
+    0x91, 0x92, 0x92, 0x93, 0x93, 0x94, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97,
+    0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A,
+  },
+  { // 91
+    0x7A, 0x7B, 0x7D, 0x7D, 0x7F, 0x80, 0x7F, 0x80, 0x83, 0x83, 0x85, 0x85,
+    0x85, 0x86, 0x88, 0x88, 0x8A, 0x8A, 0x8A, 0x8C, 0x8C, 0x8C, 0x8D, 0x8E,
+    0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x91, 0x93, 0x93, 0x94, 0x94,
+    0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97,
+  },
+  { // 92
+    0x76, 0x77, 0x79, 0x79, 0x7B, 0x7C, 0x7C, 0x7C, 0x7E, 0x7F, 0x81, 0x81,
+    0x82, 0x83, 0x83, 0x84, 0x85, 0x87, 0x87, 0x87, 0x88, 0x89, 0x89, 0x8A,
+    0x8A, 0x8C, 0x8C, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x90, 0x90, 0x90, 0x90,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x94, 0x94, 0x94, 0x94,
+  },
+  { // 93
+    0x74, 0x74, 0x76, 0x76, 0x78, 0x78, 0x79, 0x79, 0x7B, 0x7C, 0x7E, 0x7E,
+    0x7F, 0x80, 0x80, 0x82, 0x82, 0x84, 0x84, 0x84, 0x85, 0x86, 0x86, 0x87,
+    0x87, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8C, 0x8C, 0x8D, 0x8D, 0x8E, 0x8E,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x91, 0x92,
+  },
+  { // 94
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x76, 0x78, 0x78, 0x7A, 0x7B,
+    0x7B, 0x7C, 0x7D, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x83, 0x83, 0x84,
+    0x84, 0x86, 0x86, 0x87, 0x87, 0x88, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8B,
+    0x8C, 0x8C, 0x8C, 0x8C, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8F,
+  },
+  { // 95
+    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x73, 0x75, 0x75, 0x77, 0x78,
+    0x78, 0x79, 0x7B, 0x7C, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x81, 0x82,
+    0x82, 0x84, 0x84, 0x84, 0x84, 0x86, 0x86, 0x86, 0x88, 0x88, 0x88, 0x88,
+    0x8A, 0x8A, 0x8A, 0x8A, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C,
+  },
+  { // 96
+    0x6A, 0x6A, 0x6C, 0x6C, 0x6E, 0x6F, 0x6F, 0x70, 0x72, 0x72, 0x74, 0x74,
+    0x76, 0x76, 0x78, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7E, 0x7F,
+    0x7F, 0x81, 0x81, 0x81, 0x81, 0x83, 0x83, 0x83, 0x85, 0x85, 0x85, 0x85,
+    0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89,
+  },
+  { // 97
+    0x65, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6F, 0x6F, 0x71, 0x71,
+    0x73, 0x73, 0x75, 0x75, 0x75, 0x77, 0x77, 0x79, 0x79, 0x7A, 0x7A, 0x7C,
+    0x7C, 0x7E, 0x7E, 0x7E, 0x7E, 0x80, 0x80, 0x80, 0x82, 0x82, 0x82, 0x82,
+    0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86,
+  },
+  { // 98
+    0x60, 0x63, 0x64, 0x64, 0x66, 0x67, 0x69, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E,
+    0x70, 0x70, 0x72, 0x72, 0x72, 0x74, 0x74, 0x76, 0x76, 0x77, 0x77, 0x79,
+    0x79, 0x7B, 0x7B, 0x7B, 0x7B, 0x7D, 0x7D, 0x7D, 0x7F, 0x7F, 0x80, 0x80,
+    0x81, 0x81, 0x81, 0x81, 0x83, 0x83, 0x83, 0x83, 0x84, 0x85,
+  },
+  { // 99
+    0x5D, 0x5E, 0x60, 0x60, 0x62, 0x63, 0x65, 0x66, 0x68, 0x69, 0x6A, 0x6B,
+    0x6D, 0x6D, 0x6F, 0x6F, 0x6F, 0x71, 0x71, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x76, 0x78, 0x78, 0x7A, 0x7A, 0x7A, 0x7C, 0x7C, 0x7D, 0x7D,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81,
+  },
+  { // 100
+    0x59, 0x5A, 0x5B, 0x5C, 0x5E, 0x5F, 0x60, 0x61, 0x64, 0x64, 0x66, 0x66,
+    0x68, 0x69, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x73, 0x73, 0x75, 0x75, 0x77, 0x77, 0x77, 0x79, 0x79, 0x79, 0x79,
+    0x7B, 0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7E,
+  },
+  { // 101
+    0x54, 0x55, 0x57, 0x58, 0x5A, 0x5B, 0x5D, 0x5E, 0x5F, 0x60, 0x62, 0x62,
+    0x64, 0x64, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6D, 0x6F,
+    0x6F, 0x70, 0x70, 0x72, 0x72, 0x73, 0x74, 0x74, 0x75, 0x76, 0x76, 0x76,
+    0x78, 0x78, 0x78, 0x78, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B,
+  },
+  { // 102
+    0x50, 0x52, 0x54, 0x55, 0x57, 0x58, 0x5A, 0x5B, 0x5C, 0x5D, 0x5F, 0x5F,
+    0x61, 0x61, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6A, 0x6C,
+    0x6C, 0x6D, 0x6D, 0x6F, 0x6F, 0x70, 0x70, 0x71, 0x72, 0x73, 0x73, 0x73,
+    0x75, 0x75, 0x75, 0x75, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78,
+  },
+  { // 103
+    0x4E, 0x4F, 0x51, 0x52, 0x54, 0x55, 0x57, 0x58, 0x59, 0x5A, 0x5C, 0x5C,
+    0x5E, 0x5E, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x6B, 0x6B, 0x6D, 0x6D, 0x6D, 0x6E, 0x6F, 0x71, 0x71, 0x71, 0x71,
+    0x73, 0x73, 0x73, 0x73, 0x75, 0x75, 0x75, 0x75, 0x76, 0x77,
+  },
+  { // 104
+    0x49, 0x4B, 0x4D, 0x4F, 0x51, 0x52, 0x54, 0x55, 0x56, 0x57, 0x59, 0x59,
+    0x5B, 0x5B, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x68, 0x6A, 0x6A, 0x6A, 0x6B, 0x6C, 0x6E, 0x6E, 0x6E, 0x6E,
+    0x70, 0x70, 0x70, 0x70, 0x72, 0x72, 0x72, 0x72, 0x73, 0x74,
+  },
+  { // 105
+    0x45, 0x47, 0x49, 0x4B, 0x4D, 0x4F, 0x50, 0x51, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x66, 0x66, 0x68, 0x69, 0x69, 0x6A, 0x6B, 0x6B, 0x6C,
+    0x6D, 0x6D, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x71, 0x71,
+  },
+  { // 106
+    0x40, 0x42, 0x44, 0x46, 0x48, 0x4A, 0x4C, 0x4D, 0x4E, 0x50, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x58, 0x58, 0x5A, 0x5B, 0x5C, 0x5B, 0x5D, 0x5D, 0x5F,
+    0x60, 0x62, 0x63, 0x62, 0x63, 0x64, 0x66, 0x65, 0x66, 0x66, 0x67, 0x68,
+    0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D,
+  },
+  { // 107
+    0x3C, 0x3F, 0x41, 0x43, 0x45, 0x46, 0x48, 0x49, 0x4A, 0x4C, 0x4E, 0x4E,
+    0x50, 0x50, 0x52, 0x53, 0x54, 0x56, 0x56, 0x58, 0x58, 0x59, 0x5A, 0x5C,
+    0x5C, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x62, 0x62, 0x62, 0x62, 0x64, 0x64,
+    0x66, 0x66, 0x66, 0x66, 0x68, 0x68, 0x68, 0x68, 0x69, 0x6A,
+  },
+  { // 108
+    0x38, 0x3A, 0x3C, 0x3E, 0x41, 0x42, 0x43, 0x45, 0x46, 0x48, 0x4A, 0x4B,
+    0x4D, 0x4D, 0x4F, 0x50, 0x51, 0x53, 0x53, 0x55, 0x56, 0x57, 0x58, 0x5A,
+    0x5A, 0x5B, 0x5B, 0x5D, 0x5D, 0x5E, 0x60, 0x60, 0x60, 0x61, 0x62, 0x62,
+    0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x67, 0x68,
+  },
+  { // 109
+    0x34, 0x36, 0x38, 0x3A, 0x3C, 0x3E, 0x40, 0x41, 0x43, 0x44, 0x46, 0x47,
+    0x48, 0x4A, 0x4C, 0x4D, 0x4E, 0x4E, 0x50, 0x51, 0x53, 0x54, 0x55, 0x57,
+    0x57, 0x58, 0x58, 0x59, 0x59, 0x5B, 0x5C, 0x5D, 0x5D, 0x5E, 0x5F, 0x5F,
+    0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64, 0x65,
+  },
+  { // 110
+    0x31, 0x33, 0x35, 0x37, 0x39, 0x3B, 0x3D, 0x3D, 0x40, 0x41, 0x43, 0x43,
+    0x45, 0x47, 0x49, 0x49, 0x4B, 0x4B, 0x4D, 0x4E, 0x50, 0x51, 0x51, 0x53,
+    0x54, 0x55, 0x55, 0x56, 0x56, 0x58, 0x59, 0x5A, 0x5A, 0x5B, 0x5C, 0x5C,
+    0x5D, 0x5E, 0x5E, 0x5E, 0x60, 0x60, 0x60, 0x60, 0x61, 0x62,
+  },
+  { // 111
+    0x2C, 0x2E, 0x30, 0x32, 0x34, 0x36, 0x38, 0x39, 0x3C, 0x3E, 0x3F, 0x40,
+    0x42, 0x42, 0x44, 0x45, 0x46, 0x48, 0x4A, 0x4B, 0x4C, 0x4D, 0x4D, 0x4F,
+    0x50, 0x52, 0x52, 0x53, 0x53, 0x55, 0x56, 0x57, 0x57, 0x57, 0x59, 0x59,
+    0x5A, 0x5B, 0x5B, 0x5B, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5F,
+  },
+  { // 112
+    0x27, 0x29, 0x2C, 0x2E, 0x30, 0x32, 0x34, 0x36, 0x37, 0x39, 0x3B, 0x3B,
+    0x3D, 0x3F, 0x41, 0x41, 0x43, 0x45, 0x46, 0x48, 0x48, 0x4A, 0x4B, 0x4C,
+    0x4D, 0x4E, 0x4F, 0x50, 0x50, 0x52, 0x53, 0x54, 0x54, 0x54, 0x56, 0x56,
+    0x57, 0x58, 0x58, 0x58, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5C,
+  },
+  { // 113
+    0x21, 0x23, 0x27, 0x29, 0x2C, 0x2E, 0x30, 0x32, 0x33, 0x35, 0x37, 0x38,
+    0x3A, 0x3C, 0x3E, 0x3F, 0x40, 0x42, 0x43, 0x45, 0x45, 0x47, 0x48, 0x4A,
+    0x4A, 0x4B, 0x4C, 0x4D, 0x4D, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x53, 0x53,
+    0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x5A,
+  },
+  { // 114
+    0x1E, 0x20, 0x22, 0x24, 0x28, 0x2A, 0x2D, 0x2E, 0x2F, 0x31, 0x33, 0x35,
+    0x36, 0x37, 0x39, 0x3B, 0x3B, 0x3D, 0x3F, 0x40, 0x42, 0x44, 0x43, 0x45,
+    0x46, 0x47, 0x47, 0x49, 0x49, 0x4A, 0x4C, 0x4C, 0x4E, 0x4E, 0x4F, 0x4F,
+    0x51, 0x50, 0x52, 0x52, 0x52, 0x52, 0x55, 0x55, 0x55, 0x57,
+  },
+  { // 115
+    0x1B, 0x1C, 0x1D, 0x1F, 0x23, 0x25, 0x28, 0x29, 0x2B, 0x2D, 0x2F, 0x31,
+    0x32, 0x33, 0x35, 0x37, 0x38, 0x3A, 0x3A, 0x3C, 0x3E, 0x3F, 0x40, 0x42,
+    0x42, 0x44, 0x44, 0x46, 0x46, 0x47, 0x48, 0x48, 0x4A, 0x4A, 0x4B, 0x4C,
+    0x4C, 0x4C, 0x4E, 0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x51, 0x53,
+  },
+  { // 116
+    0x18, 0x19, 0x1B, 0x1C, 0x1E, 0x21, 0x23, 0x25, 0x26, 0x28, 0x2C, 0x2D,
+    0x2F, 0x2F, 0x31, 0x34, 0x35, 0x36, 0x37, 0x39, 0x3A, 0x3B, 0x3C, 0x3E,
+    0x3F, 0x41, 0x41, 0x43, 0x43, 0x44, 0x46, 0x46, 0x48, 0x48, 0x4A, 0x4A,
+    0x4A, 0x4A, 0x4C, 0x4C, 0x4D, 0x4D, 0x4E, 0x4E, 0x4F, 0x50,
+  },
+  { // 117
+    0x15, 0x16, 0x18, 0x19, 0x1A, 0x1C, 0x1E, 0x20, 0x22, 0x25, 0x28, 0x29,
+    0x2B, 0x2C, 0x2E, 0x30, 0x32, 0x33, 0x34, 0x36, 0x36, 0x38, 0x39, 0x3B,
+    0x3C, 0x3E, 0x3E, 0x40, 0x40, 0x41, 0x43, 0x43, 0x45, 0x45, 0x47, 0x47,
+    0x47, 0x47, 0x49, 0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4C, 0x4D,
+  },
+  { // 118
+    0x11, 0x12, 0x14, 0x15, 0x17, 0x18, 0x1A, 0x1B, 0x1E, 0x20, 0x22, 0x24,
+    0x26, 0x28, 0x2A, 0x2C, 0x2D, 0x2F, 0x30, 0x31, 0x33, 0x35, 0x36, 0x37,
+    0x39, 0x3A, 0x3B, 0x3B, 0x3C, 0x3D, 0x3F, 0x3F, 0x40, 0x41, 0x42, 0x43,
+    0x44, 0x44, 0x46, 0x46, 0x47, 0x47, 0x48, 0x48, 0x49, 0x4A,
+  },
+  { // 119
+    0x0E, 0x0F, 0x11, 0x12, 0x14, 0x16, 0x17, 0x18, 0x1B, 0x1C, 0x1D, 0x21,
+    0x23, 0x24, 0x26, 0x28, 0x2A, 0x2C, 0x2D, 0x2E, 0x2F, 0x32, 0x33, 0x34,
+    0x36, 0x37, 0x38, 0x38, 0x39, 0x3A, 0x3C, 0x3C, 0x3D, 0x3E, 0x3F, 0x40,
+    0x41, 0x41, 0x43, 0x43, 0x44, 0x44, 0x45, 0x45, 0x46, 0x47,
+  },
+  { // 120
+    0x0A, 0x0C, 0x0E, 0x0F, 0x11, 0x13, 0x14, 0x16, 0x17, 0x18, 0x1A, 0x1C,
+    0x1E, 0x20, 0x22, 0x24, 0x26, 0x28, 0x29, 0x2B, 0x2B, 0x2D, 0x2F, 0x30,
+    0x31, 0x33, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3C, 0x3D,
+    0x3E, 0x3E, 0x40, 0x40, 0x41, 0x41, 0x42, 0x42, 0x43, 0x43,
+  },
+  { // 121
+    0x06, 0x08, 0x0A, 0x0B, 0x0E, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x1A, 0x1B, 0x1D, 0x1F, 0x21, 0x23, 0x25, 0x26, 0x27, 0x29, 0x2B, 0x2D,
+    0x2D, 0x2F, 0x30, 0x32, 0x33, 0x33, 0x35, 0x36, 0x37, 0x37, 0x39, 0x39,
+    0x3B, 0x3B, 0x3D, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x3F, 0x40,
+  },
+  { // 122
+    0x02, 0x04, 0x06, 0x08, 0x0B, 0x0D, 0x0E, 0x10, 0x11, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x18, 0x1B, 0x1D, 0x1F, 0x20, 0x22, 0x23, 0x24, 0x26, 0x28,
+    0x29, 0x2B, 0x2C, 0x2D, 0x2F, 0x2F, 0x31, 0x31, 0x33, 0x33, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x38, 0x3A, 0x3A, 0x3A, 0x3A, 0x3C, 0x3C,
+  },
+  { // 123
+    0x00, 0x01, 0x02, 0x04, 0x07, 0x09, 0x0A, 0x0C, 0x0D, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x17, 0x19, 0x1B, 0x1D, 0x1F, 0x20, 0x21, 0x23, 0x26,
+    0x26, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2E, 0x2E, 0x30, 0x30, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x35, 0x37, 0x37, 0x39, 0x39, 0x39, 0x3B,
+  },
+  { // 124
+    0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x07, 0x09, 0x0A, 0x0C, 0x0E, 0x0F,
+    0x10, 0x11, 0x13, 0x14, 0x16, 0x18, 0x19, 0x1B, 0x1C, 0x1E, 0x20, 0x22,
+    0x23, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2B, 0x2B, 0x2D, 0x2D, 0x2E, 0x2F,
+    0x30, 0x31, 0x32, 0x32, 0x34, 0x34, 0x36, 0x36, 0x36, 0x38,
+  },
+  { // 125
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x0B, 0x0C,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x15, 0x16, 0x18, 0x19, 0x1B, 0x1D, 0x1E,
+    0x20, 0x22, 0x23, 0x24, 0x25, 0x26, 0x28, 0x28, 0x2A, 0x2A, 0x2B, 0x2C,
+    0x2D, 0x2E, 0x2F, 0x2F, 0x31, 0x31, 0x33, 0x33, 0x33, 0x35,
+  },
+  { // 126
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x05, 0x07, 0x09,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x15, 0x17, 0x18, 0x1B,
+    0x1D, 0x1F, 0x1F, 0x21, 0x21, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+    0x2A, 0x2A, 0x2C, 0x2C, 0x2E, 0x2E, 0x30, 0x30, 0x30, 0x32,
+  },
+  { // 127
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x05,
+    0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x13, 0x16,
+    0x18, 0x1A, 0x1B, 0x1C, 0x1E, 0x1E, 0x1F, 0x20, 0x22, 0x23, 0x25, 0x25,
+    0x27, 0x27, 0x29, 0x29, 0x2A, 0x2A, 0x2B, 0x2B, 0x2D, 0x2D,
+  },
+  { // 128
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x06, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0D, 0x0E, 0x10, 0x13,
+    0x14, 0x15, 0x17, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1F, 0x20, 0x22, 0x22,
+    0x24, 0x24, 0x26, 0x26, 0x27, 0x27, 0x28, 0x28, 0x2A, 0x2A,
+  },
+  { // 129
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x03, 0x04, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F,
+    0x10, 0x11, 0x13, 0x14, 0x16, 0x16, 0x18, 0x19, 0x1A, 0x1C, 0x1E, 0x1E,
+    0x20, 0x20, 0x21, 0x22, 0x22, 0x22, 0x24, 0x24, 0x26, 0x26,
+  },
+  { // 130
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0C,
+    0x0D, 0x0E, 0x0E, 0x10, 0x11, 0x13, 0x15, 0x15, 0x17, 0x17, 0x19, 0x1A,
+    0x1C, 0x1C, 0x1D, 0x1D, 0x1F, 0x1F, 0x21, 0x21, 0x22, 0x23,
+  },
+  { // 131
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x04, 0x06, 0x08, 0x08,
+    0x0A, 0x0C, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x16, 0x16,
+    0x18, 0x18, 0x1A, 0x1A, 0x1C, 0x1C, 0x1E, 0x1E, 0x1E, 0x1F,
+  },
+  { // 132
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x05,
+    0x07, 0x09, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x17, 0x17, 0x19, 0x19, 0x1A, 0x1B, 0x1B, 0x1C,
+  },
+  { // 133
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0D, 0x0E,
+    0x10, 0x10, 0x13, 0x14, 0x14, 0x14, 0x16, 0x16, 0x18, 0x19,
+  },
+  { // 134
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x08, 0x09, 0x0B,
+    0x0D, 0x0D, 0x0F, 0x0F, 0x11, 0x11, 0x12, 0x13, 0x15, 0x15,
+  },
+  { // 135
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08,
+    0x09, 0x09, 0x0B, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x10, 0x11,
+  },
+};
+
+#endif // SYMMETRICAL_EYELID
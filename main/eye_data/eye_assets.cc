@@ -0,0 +1,145 @@
+#include "sdkconfig.h"
+#include "eye_assets.h"
+
+#if CONFIG_EYE_ASSETS_160
+extern const EyeAssets kEyeAssets160;
+#endif
+#if CONFIG_EYE_ASSETS_240
+extern const EyeAssets kEyeAssets240;
+#endif
+#if CONFIG_EYE_ASSETS_160 || CONFIG_EYE_ASSET_PACK
+extern const EyeAssets kEyeLayout160;
+#endif
+#if CONFIG_EYE_ASSETS_240 || CONFIG_EYE_ASSET_PACK
+extern const EyeAssets kEyeLayout240;
+#endif
+#if CONFIG_EYE_ASSET_PACK
+extern const EyeComposeFn kEyeComposePalette160;
+extern const EyeComposeFn kEyeComposePalette240;
+#endif
+
+namespace {
+
+bool SameEyeLayout(const EyeAssets& a, const EyeAssets& b) {
+    return a.screen_width == b.screen_width && a.screen_height == b.screen_height &&
+        a.sclera_width == b.sclera_width && a.sclera_height == b.sclera_height &&
+        a.iris_width == b.iris_width && a.iris_height == b.iris_height &&
+        a.iris_map_width == b.iris_map_width && a.iris_map_height == b.iris_map_height;
+}
+
+} // namespace
+
+const EyeAssets* FindEyeAssets(int screen_size) {
+#if CONFIG_EYE_ASSETS_160
+    if (screen_size == kEyeAssets160.screen_width) {
+        return &kEyeAssets160;
+    }
+#endif
+#if CONFIG_EYE_ASSETS_240
+    if (screen_size == kEyeAssets240.screen_width) {
+        return &kEyeAssets240;
+    }
+#endif
+    return nullptr;
+}
+
+EyeComposeFn FindEyeCompose(const EyeAssets& layout) {
+#if CONFIG_EYE_ASSETS_160 || CONFIG_EYE_ASSET_PACK
+    if (SameEyeLayout(layout, kEyeLayout160)) {
+#if CONFIG_EYE_ASSET_PACK
+        if (layout.palette) {
+            return kEyeComposePalette160;
+        }
+#endif
+        return kEyeLayout160.compose;
+    }
+#endif
+#if CONFIG_EYE_ASSETS_240 || CONFIG_EYE_ASSET_PACK
+    if (SameEyeLayout(layout, kEyeLayout240)) {
+#if CONFIG_EYE_ASSET_PACK
+        if (layout.palette) {
+            return kEyeComposePalette240;
+        }
+#endif
+        return kEyeLayout240.compose;
+    }
+#endif
+    return nullptr;
+}
+
+void BuildEyeLidSpans(const EyeAssets& assets, uint8_t* upper_span, uint8_t* lower_span) {
+    const int width = assets.screen_width, height = assets.screen_height;
+    for (int x = 0; x < width; x++) {
+        // 阈值T变大时第一个>T的行只会往下移，所以每列从上一个阈值的结果继续推进
+        const uint8_t* upper = assets.upper + x;
+        int y = 0;
+        for (int t = 0; t < 256; t++) {
+            while (y < height && upper[y * width] <= t) {
+                y++;
+            }
+            upper_span[t * width + x] = y;
+        }
+        // 下眼睑同理，从列底往上
+        const uint8_t* lower = assets.lower + x;
+        y = height;
+        for (int t = 0; t < 256; t++) {
+            while (y > 0 && lower[(y - 1) * width] <= t) {
+                y--;
+            }
+            lower_span[t * width + x] = y;
+        }
+    }
+}
+
+void BuildEyeLidFollow(const EyeAssets& assets, uint8_t* out) {
+    const int width = assets.screen_width, height = assets.screen_height;
+    const int rows = EyeLidFollowRows(assets), columns = EyeLidFollowColumns(assets);
+    for (int y = 0; y < rows; y++) {
+        // 在瞳孔稍上方取样，左右对称的两点按 a + b / 2 合成，取样点超出阈值图上沿时眼睑完全张开。
+        // 结果按8位截断，与原先逐帧取样的结果逐项相同（各表情的注视点是按这个效果调的）
+        int sampleY = assets.sclera_height / 2 - (y + assets.iris_height / 6);
+        if (sampleY >= height) sampleY = height - 1;
+        for (int c = 0; c < columns; c++) {
+            int sampleX = assets.sclera_width / 2 - c;
+            if (sampleX < 0) sampleX = 0;
+            if (sampleX >= width) sampleX = width - 1;
+            uint8_t n = 0;
+            if (sampleY >= 0) {
+                const uint8_t* row = assets.upper + sampleY * width;
+                n = row[sampleX] + row[width - 1 - sampleX] / 2;
+            }
+            out[y * columns + c] = n;
+        }
+    }
+}
+
+void BuildEyePolarLut(const EyeAssets& assets, uint16_t* out) {
+    const int count = assets.iris_width * assets.iris_height;
+    for (int i = 0; i < count; i++) {
+        uint16_t p = assets.polar[i];
+        uint16_t column = (assets.iris_map_width * (uint32_t)(p >> 7)) >> 9;
+        out[i] = ((p & 0x7F) << EYE_POLAR_COLUMN_BITS) | column;
+    }
+}
+
+void BuildEyeIrisRows(const EyeAssets& assets, uint32_t iScale, int32_t* out) {
+    for (uint32_t r = 0; r < EYE_IRIS_RADIUS_COUNT; r++) {
+        uint32_t d = (iScale * r) / 240;
+        out[r] = d < assets.iris_map_height ? (int32_t)(d * assets.iris_map_width) : -1;
+    }
+}
+
+void BuildEyeTintedPalette(const uint16_t* palette, uint16_t tint, uint8_t strength, uint16_t* out) {
+    const int tr = tint >> 11, tg = (tint >> 5) & 0x3F, tb = tint & 0x1F;
+    for (int i = 0; i < EYE_PALETTE_SIZE; i++) {
+        uint16_t p = (palette[i] >> 8) | (palette[i] << 8);
+        int r = p >> 11, g = (p >> 5) & 0x3F, b = p & 0x1F;
+        // 亮度按6位绿色的尺度计算，0~63
+        int luma = (r * 2 * 77 + g * 150 + b * 2 * 29) >> 8;
+        r += ((tr * luma / 63 - r) * strength) >> 8;
+        g += ((tg * luma / 63 - g) * strength) >> 8;
+        b += ((tb * luma / 63 - b) * strength) >> 8;
+        p = (r << 11) | (g << 5) | b;
+        out[i] = (p >> 8) | (p << 8);
+    }
+}
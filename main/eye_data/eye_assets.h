@@ -0,0 +1,148 @@
+#ifndef EYE_ASSETS_H
+#define EYE_ASSETS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 一帧中一只眼睛的渲染参数，由Application::frame()计算
+struct EyeRenderParams {
+    uint32_t iScale;    // 虹膜缩放
+    uint32_t scleraX;   // 屏幕左上角在巩膜贴图中的位置
+    uint32_t scleraY;
+    uint32_t uT;        // 上眼睑阈值
+    uint32_t lT;        // 下眼睑阈值
+};
+
+// 巩膜贴图编号，各分辨率的数据按相同编号排列
+enum EyeSclera : uint8_t {
+    kEyeScleraDefault,
+    kEyeScleraWhite,
+    kEyeScleraZhuozhu,
+    kEyeScleraCuteGirl,
+    kEyeScleraOceanGirl,
+    kEyeScleraLufei,
+    kEyeScleraCount
+};
+
+// 虹膜贴图编号
+enum EyeIris : uint8_t {
+    kEyeIrisDefault,
+    kEyeIrisBlood,
+    kEyeIrisCospa,
+    kEyeIrisSpikes,
+    kEyeIrisRibbon,
+    kEyeIrisBlackStar,
+    kEyeIrisStraw,
+    kEyeIrisCount
+};
+
+// 压缩巩膜的行缓存，按巩膜行号直接映射到rows个槽。rows不小于屏幕高度时，
+// 同一帧内不同批次用到的巩膜行不会落在同一个槽，两个核可以同时读写
+struct EyeRowCache {
+    const void* texture;        // 缓存内容所属的巩膜贴图，切换贴图时由Application清空
+    uint16_t rows;
+    int16_t* tag;               // 每个槽缓存的巩膜行号，-1为空
+    uint8_t* valid;             // 每个槽已解码的段的位掩码
+    uint16_t* pixels;           // rows * sclera_width
+};
+
+// 合成时使用的贴图和查找表，由Application为每只眼睛准备
+struct EyeFrameTables {
+    const uint16_t* sclera;
+    const uint16_t* iris;
+    const uint16_t* polar_lut;  // 极坐标查找表：高7位为半径，低9位为虹膜贴图的列
+    const int32_t* iris_rows;   // 半径 -> 虹膜贴图行偏移，-1表示超出虹膜贴图、显示巩膜
+    EyeRowCache* sclera_cache;  // 巩膜压缩时使用
+    const void* const* sclera_rows; // 巩膜未压缩时每行像素的起始地址，行复制到RAM后指向副本；为空时按sclera计算
+    const uint16_t* sclera_lut; // 调色板贴图使用的调色板，可能是着色后的副本
+    const uint16_t* iris_lut;
+};
+
+#define EYE_POLAR_COLUMN_BITS 9
+// 调色板贴图：开头是EYE_PALETTE_SIZE项已交换字节序的RGB565调色板，之后每像素1字节索引
+#define EYE_PALETTE_SIZE 256
+#define EYE_IRIS_RADIUS_COUNT 128
+
+struct EyeAssets;
+
+// 合成一批扫描行：从屏幕第screenY行开始共lines行，写入buf
+typedef void (*EyeComposeFn)(const EyeAssets& assets, const EyeFrameTables& tables,
+    const EyeRenderParams& params, uint16_t screenY, uint8_t lines, uint16_t* buf);
+
+// 一种分辨率的全部魔眼数据，compose是按该分辨率尺寸在编译期特化的合成函数
+struct EyeAssets {
+    uint16_t screen_width;
+    uint16_t screen_height;
+    uint16_t sclera_width;
+    uint16_t sclera_height;
+    uint16_t iris_width;
+    uint16_t iris_height;
+    uint16_t iris_map_width;
+    uint16_t iris_map_height;
+    const uint8_t* upper;       // 上/下眼睑阈值图
+    const uint8_t* lower;
+    const uint16_t* polar;      // 虹膜极坐标图
+    const uint8_t* upper_span;  // 眼睑区间表，[256][screen_width]
+    const uint8_t* lower_span;
+    const uint8_t* lid_follow;  // 上眼睑跟随表，[EyeLidFollowRows][EyeLidFollowColumns]
+    const uint16_t* sclera[kEyeScleraCount];
+    const uint16_t* iris[kEyeIrisCount];
+    EyeComposeFn compose;
+    bool packed_sclera;         // sclera[]为eye_codec.h格式的压缩贴图，合成时逐行解码
+    bool palette;               // sclera[]和iris[]为调色板贴图
+};
+
+// 未压缩贴图的像素字节数和整张贴图的字节数
+static inline int EyeTexelSize(const EyeAssets& assets) {
+    return assets.palette ? 1 : 2;
+}
+
+static inline size_t EyeTextureSize(const EyeAssets& assets, int width, int height) {
+    return (assets.palette ? EYE_PALETTE_SIZE * sizeof(uint16_t) : 0) + (size_t)width * height * EyeTexelSize(assets);
+}
+
+// 未压缩贴图第y行像素的起始地址
+static inline const void* EyeTextureRow(const EyeAssets& assets, const uint16_t* texture, int width, int y) {
+    const uint8_t* pixels = (const uint8_t*)texture + (assets.palette ? EYE_PALETTE_SIZE * sizeof(uint16_t) : 0);
+    return pixels + (size_t)y * width * EyeTexelSize(assets);
+}
+
+// 上眼睑跟随表按眼球位置（巩膜贴图中的像素）索引：每行对应一个scleraY，每列对应EYE_LID_FOLLOW_STEP个scleraX
+#define EYE_LID_FOLLOW_STEP 3
+
+static inline int EyeLidFollowColumns(const EyeAssets& assets) {
+    return (assets.sclera_width - assets.screen_width) / EYE_LID_FOLLOW_STEP + 1;
+}
+
+static inline int EyeLidFollowRows(const EyeAssets& assets) {
+    return assets.sclera_height - assets.screen_height + 1;
+}
+
+// 眼球在(scleraX, scleraY)时上眼睑要跟随到的阈值
+static inline uint8_t EyeLidFollow(const EyeAssets& assets, int scleraX, int scleraY) {
+    return assets.lid_follow[scleraY * EyeLidFollowColumns(assets) + scleraX / EYE_LID_FOLLOW_STEP];
+}
+
+// 按屏幕尺寸查找编译进固件的魔眼数据，没有对应分辨率时返回nullptr
+const EyeAssets* FindEyeAssets(int screen_size);
+
+// 按layout的全部尺寸和贴图格式查找编译期特化的合成函数，用于运行时加载的魔眼数据，没有对应特化时返回nullptr
+EyeComposeFn FindEyeCompose(const EyeAssets& layout);
+
+// 由眼睑阈值图生成眼睑区间表，结果与scripts/gen_eye_lid_spans.py一致，两张表都是[256][screen_width]
+void BuildEyeLidSpans(const EyeAssets& assets, uint8_t* upper_span, uint8_t* lower_span);
+
+// 由上眼睑阈值图生成上眼睑跟随表，结果与scripts/gen_eye_lid_spans.py一致，out为EyeLidFollowRows * EyeLidFollowColumns项
+void BuildEyeLidFollow(const EyeAssets& assets, uint8_t* out);
+
+// 把极坐标图中的极角换算成虹膜贴图的列，结果写入out（iris_width * iris_height项）
+void BuildEyePolarLut(const EyeAssets& assets, uint16_t* out);
+
+// 按虹膜缩放生成半径表，out为EYE_IRIS_RADIUS_COUNT项
+void BuildEyeIrisRows(const EyeAssets& assets, uint32_t iScale, int32_t* out);
+
+// 生成着色后的调色板：每种颜色按亮度换成tint（RGB565）的同亮度颜色，再按strength/256与原色混合。
+// palette和out都是已交换字节序的EYE_PALETTE_SIZE项，strength为0时原样复制
+void BuildEyeTintedPalette(const uint16_t* palette, uint16_t tint, uint8_t strength, uint16_t* out);
+
+#endif // EYE_ASSETS_H
@@ -0,0 +1,104 @@
+#include "sdkconfig.h"
+
+#if CONFIG_EYE_ASSETS_240 || CONFIG_EYE_ASSET_PACK
+#include "eye_assets.h"
+#include "eye_kernel.h"
+
+#include "240_240/common.h"
+
+namespace {
+
+// 240x240的尺寸，来自240_240/common.h
+struct EyeGeometry240 {
+    static constexpr int kScreenWidth = SCREEN_WIDTH;
+    static constexpr int kScreenHeight = SCREEN_HEIGHT;
+    static constexpr int kScleraWidth = SCLERA_WIDTH;
+    static constexpr int kScleraHeight = SCLERA_HEIGHT;
+    static constexpr int kIrisWidth = IRIS_WIDTH;
+    static constexpr int kIrisHeight = IRIS_HEIGHT;
+    static constexpr int kIrisMapWidth = IRIS_MAP_WIDTH;
+    static constexpr int kIrisMapHeight = IRIS_MAP_HEIGHT;
+};
+
+} // namespace
+
+// 只有尺寸和合成函数，资源包按尺寸匹配编译期特化的合成函数时使用，不引用贴图数据
+extern const EyeAssets kEyeLayout240 = {
+    .screen_width = SCREEN_WIDTH,
+    .screen_height = SCREEN_HEIGHT,
+    .sclera_width = SCLERA_WIDTH,
+    .sclera_height = SCLERA_HEIGHT,
+    .iris_width = IRIS_WIDTH,
+    .iris_height = IRIS_HEIGHT,
+    .iris_map_width = IRIS_MAP_WIDTH,
+    .iris_map_height = IRIS_MAP_HEIGHT,
+    .upper = nullptr,
+    .lower = nullptr,
+    .polar = nullptr,
+    .upper_span = nullptr,
+    .lower_span = nullptr,
+    .lid_follow = nullptr,
+    .sclera = {},
+    .iris = {},
+    .compose = ComposeEyeBatch<EyeGeometry240>,
+    .packed_sclera = false,
+    .palette = false,
+};
+
+#if CONFIG_EYE_ASSET_PACK
+// 调色板资源包使用的合成函数
+extern const EyeComposeFn kEyeComposePalette240 = ComposeEyeBatch<EyeGeometry240, EyeTexelPalette>;
+#endif
+
+#if CONFIG_EYE_ASSETS_240
+#include "240_240/blood.h"
+#include "240_240/cospa.h"
+#include "240_240/default.h"
+#include "240_240/sclera_common.h"
+#include "240_240/spikes.h"
+#include "240_240/ribbon.h"
+#include "240_240/black_star.h"
+#include "240_240/straw.h"
+#include "240_240/upper_lower_common.h"
+#include "240_240/lid_spans_common.h"
+#include "240_240/lid_follow_common.h"
+
+extern const EyeAssets kEyeAssets240 = {
+    .screen_width = SCREEN_WIDTH,
+    .screen_height = SCREEN_HEIGHT,
+    .sclera_width = SCLERA_WIDTH,
+    .sclera_height = SCLERA_HEIGHT,
+    .iris_width = IRIS_WIDTH,
+    .iris_height = IRIS_HEIGHT,
+    .iris_map_width = IRIS_MAP_WIDTH,
+    .iris_map_height = IRIS_MAP_HEIGHT,
+    .upper = upper_default,
+    .lower = lower_default,
+    .polar = polar_default,
+    .upper_span = &upper_span_default[0][0],
+    .lower_span = &lower_span_default[0][0],
+    .lid_follow = &lid_follow_default[0][0],
+    .sclera = {
+        sclera_default,  // kEyeScleraDefault
+        sclera_style_white,  // kEyeScleraWhite
+        sclera_style_zhuozhu,  // kEyeScleraZhuozhu
+        sclera_style_cute_girl,  // kEyeScleraCuteGirl
+        sclera_style_ocean_girl,  // kEyeScleraOceanGirl
+        sclera_style_lufei,  // kEyeScleraLufei
+    },
+    .iris = {
+        iris_default,  // kEyeIrisDefault
+        iris_style_blood,  // kEyeIrisBlood
+        iris_style_cospa1,  // kEyeIrisCospa
+        iris_style_spikes,  // kEyeIrisSpikes
+        iris_style_ribbon,  // kEyeIrisRibbon
+        iris_style_black_star,  // kEyeIrisBlackStar
+        iris_style_straw,  // kEyeIrisStraw
+    },
+    .compose = ComposeEyeBatch<EyeGeometry240>,
+    .packed_sclera = false,
+    .palette = false,
+};
+
+#endif // CONFIG_EYE_ASSETS_240
+#endif // CONFIG_EYE_ASSETS_240 || CONFIG_EYE_ASSET_PACK
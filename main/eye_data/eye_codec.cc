@@ -0,0 +1,48 @@
+#include "eye_codec.h"
+
+bool EyeCodecValidate(const uint8_t* texture, size_t size, int width, int height) {
+    const size_t table = (height + 1) * sizeof(uint32_t);
+    if (((uintptr_t)texture & 3) != 0 || size < table) {
+        return false;
+    }
+    const uint32_t* rows = (const uint32_t*)texture;
+    const int segments = EyeCodecSegments(width);
+    if (rows[height] > size) {
+        return false;
+    }
+    for (int y = 0; y < height; y++) {
+        const uint32_t length = rows[y + 1] - rows[y];
+        if (rows[y] < table || rows[y + 1] < rows[y] || (rows[y] & 1) != 0 ||
+            length < segments * sizeof(uint16_t)) {
+            return false;
+        }
+        const uint16_t* offsets = (const uint16_t*)(texture + rows[y]);
+        for (int s = 0; s < segments; s++) {
+            if (offsets[s] < segments * sizeof(uint16_t) || offsets[s] >= length) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void EyeCodecDecode(const uint8_t* texture, int width, int height, uint16_t* out) {
+    for (int y = 0; y < height; y++) {
+        EyeCodecDecodeRow(texture, width, y, EyeCodecSegmentMask(0, width), out + y * width);
+    }
+}
+
+void EyeCodecDecode8(const uint8_t* texture, int width, int height, uint8_t* out) {
+    uint16_t row[EYE_CODEC_SEGMENT];
+    for (int y = 0; y < height; y++) {
+        const uint8_t* line = texture + ((const uint32_t*)texture)[y];
+        const uint16_t* segments = (const uint16_t*)line;
+        for (int x = 0, s = 0; x < width; x += EYE_CODEC_SEGMENT, s++) {
+            int count = width - x < EYE_CODEC_SEGMENT ? width - x : EYE_CODEC_SEGMENT;
+            EyeCodecDecodeSegment(line + segments[s], row, count);
+            for (int i = 0; i < count; i++) {
+                out[y * width + x + i] = (uint8_t)row[i];
+            }
+        }
+    }
+}
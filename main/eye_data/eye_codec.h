@@ -0,0 +1,101 @@
+#ifndef EYE_CODEC_H
+#define EYE_CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+    魔眼贴图压缩格式，编码器见 scripts/gen_eye_pack.py。
+    贴图按行存储，每行再按EYE_CODEC_SEGMENT个像素分段，每段独立解码，
+    所以合成时只需从可见列所在的段开始解码，不必从行首解起。
+        uint32_t row[height + 1]        每行数据相对贴图开头的偏移，最后一项为贴图总字节数
+        每行: uint16_t segment[n]       每段数据相对行首的偏移，n = (width + 63) / 64，之后是各段的编码数据
+    每段从“前一个像素 = 0”开始，按操作码逐个生成RGB565像素：
+        00nnnnnn                重复前一个像素 n + 1 次
+        010ggggg drdb           dg = g - 16，dr = dg + (dr - 8)，db = dg + (db - 8)
+        01100000 lo hi          原始像素
+        1rrgggbb                dr = r - 2，dg = g - 4，db = b - 2
+    各通道的差值按通道位宽回绕。
+    */
+#define EYE_CODEC_SEGMENT 64
+
+static inline int EyeCodecSegments(int width) {
+    return (width + EYE_CODEC_SEGMENT - 1) / EYE_CODEC_SEGMENT;
+}
+
+// 按RGB565的三个通道分别做回绕加法：先去掉每个通道的最高位相加，避免进位跨通道，再异或补回最高位
+static inline uint16_t EyeCodecAdd565(uint16_t p, uint16_t d) {
+    return ((p & 0x7BEF) + (d & 0x7BEF)) ^ ((p ^ d) & 0x8410);
+}
+
+static constexpr uint16_t EyeCodecDelta565(int dr, int dg, int db) {
+    return ((dr & 0x1F) << 11) | ((dg & 0x3F) << 5) | (db & 0x1F);
+}
+
+// 1rrgggbb操作码对应的差值，按低7位索引
+struct EyeCodecDiffTable {
+    uint16_t delta[128];
+    constexpr EyeCodecDiffTable() : delta() {
+        for (int i = 0; i < 128; i++) {
+            delta[i] = EyeCodecDelta565(((i >> 5) & 0x03) - 2, ((i >> 2) & 0x07) - 4, (i & 0x03) - 2);
+        }
+    }
+};
+static constexpr EyeCodecDiffTable kEyeCodecDiff;
+
+// 解码一段的count个像素
+static inline void EyeCodecDecodeSegment(const uint8_t* src, uint16_t* out, int count) {
+    uint16_t* end = out + count;
+    uint16_t prev = 0;
+    while (out < end) {
+        uint8_t op = *src++;
+        if (op >= 0x80) {
+            prev = EyeCodecAdd565(prev, kEyeCodecDiff.delta[op & 0x7F]);
+        } else if (op < 0x40) {
+            int n = op + 1;
+            if (n > end - out) n = end - out;
+            while (n--) *out++ = prev;
+            continue;
+        } else if (op < 0x60) {
+            int dg = (op & 0x1F) - 16;
+            uint8_t rb = *src++;
+            prev = EyeCodecAdd565(prev, EyeCodecDelta565(dg + (rb >> 4) - 8, dg, dg + (rb & 0x0F) - 8));
+        } else {
+            prev = src[0] | (src[1] << 8);
+            src += 2;
+        }
+        *out++ = prev;
+    }
+}
+
+// 返回覆盖[begin, end)列的段的位掩码，begin < end
+static inline uint32_t EyeCodecSegmentMask(int begin, int end) {
+    return ((2u << ((end - 1) / EYE_CODEC_SEGMENT)) - 1) & ~((1u << (begin / EYE_CODEC_SEGMENT)) - 1);
+}
+
+// 解码第row行中mask标出的各段，像素写到out中对应的列（out按整行宽度索引）
+static inline void EyeCodecDecodeRow(const uint8_t* texture, int width, int row, uint32_t mask, uint16_t* out) {
+    const uint8_t* line = texture + ((const uint32_t*)texture)[row];
+    const uint16_t* segments = (const uint16_t*)line;
+    for (int s = 0; mask != 0; s++, mask >>= 1) {
+        if (mask & 1) {
+            int x = s * EYE_CODEC_SEGMENT;
+            int count = width - x < EYE_CODEC_SEGMENT ? width - x : EYE_CODEC_SEGMENT;
+            EyeCodecDecodeSegment(line + segments[s], out + x, count);
+        }
+    }
+}
+
+// 检查行/段偏移表都落在size字节内，加载资源包时调用一次
+bool EyeCodecValidate(const uint8_t* texture, size_t size, int width, int height);
+
+// 返回压缩贴图的字节数
+static inline size_t EyeCodecSize(const uint8_t* texture, int height) {
+    return ((const uint32_t*)texture)[height];
+}
+
+// 整张贴图解码
+void EyeCodecDecode(const uint8_t* texture, int width, int height, uint16_t* out);
+void EyeCodecDecode8(const uint8_t* texture, int width, int height, uint8_t* out);
+
+#endif // EYE_CODEC_H
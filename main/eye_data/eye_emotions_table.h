@@ -0,0 +1,64 @@
+// 由 scripts/gen_eye_emotions.py 生成，请勿手动修改
+#pragma once
+
+#include <stdint.h>
+
+alignas(4) static const uint8_t kEyeEmotionTable[912] = {
+    0x45, 0x59, 0x45, 0x4D, 0x01, 0x00, 0x15, 0x20, 0xB3, 0xBC, 0x1C, 0x81, 0x25, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0x12, 0x14, 0x0D, 0x02, 0x05, 0x0A, 0x04, 0x0B, 0x0E,
+    0xFF, 0x08, 0x13, 0x0F, 0x10, 0xFF, 0x0C, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0x03, 0x11, 0x09, 0x00,
+    0x6E, 0x65, 0x75, 0x74, 0x72, 0x61, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0x03, 0x68, 0x61, 0x70, 0x70, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x6C, 0x61, 0x75, 0x67, 0x68, 0x69, 0x6E, 0x67,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x03, 0x66, 0x75, 0x6E, 0x6E,
+    0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03,
+    0x73, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0x03, 0x61, 0x6E, 0x67, 0x72, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x01, 0xFF, 0x00, 0xF8, 0x70, 0x03, 0x63, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0xFF, 0x1F, 0x04, 0x60, 0x03, 0x6C, 0x6F, 0x76, 0x69,
+    0x6E, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x03, 0x01, 0xB2, 0xF8, 0x40, 0x03,
+    0x65, 0x6D, 0x62, 0x61, 0x72, 0x72, 0x61, 0x73, 0x73, 0x65, 0x64, 0x00, 0x0D, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0x03, 0x73, 0x75, 0x72, 0x70, 0x72, 0x69, 0x73, 0x65, 0x64, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x73, 0x68, 0x6F, 0x63, 0x6B, 0x65, 0x64, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x74, 0x68, 0x69, 0x6E,
+    0x6B, 0x69, 0x6E, 0x67, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x03,
+    0x77, 0x69, 0x6E, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0x02, 0x63, 0x6F, 0x6F, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x72, 0x65, 0x6C, 0x61, 0x78, 0x65, 0x64, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x64, 0x65, 0x6C, 0x69,
+    0x63, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03,
+    0x6B, 0x69, 0x73, 0x73, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0x03, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x00, 0x00, 0x00,
+    0x19, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x79, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x03, 0x73, 0x69, 0x6C, 0x6C,
+    0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x03,
+    0x63, 0x6F, 0x6E, 0x66, 0x75, 0x73, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x04, 0x01,
+    0x00, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xF9, 0x01, 0x25, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0xC8, 0x00, 0x08, 0x02, 0xED, 0x03, 0x00, 0x00, 0x3C, 0x00, 0x01, 0x00, 0x96, 0x00, 0xF4, 0x01,
+    0xF7, 0x03, 0x00, 0x00, 0x96, 0xDC, 0x01, 0x00, 0xB4, 0x00, 0xF4, 0x01, 0xD9, 0x03, 0x00, 0x00,
+    0xAA, 0xE6, 0x01, 0x00, 0xB4, 0x00, 0xF4, 0x01, 0xF7, 0x03, 0x00, 0x00, 0x96, 0xDC, 0x01, 0x00,
+    0xC8, 0x00, 0x08, 0x02, 0x19, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x00, 0x90, 0x01, 0x09, 0x01,
+    0x4F, 0x01, 0x7C, 0x01, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00, 0xBC, 0x02, 0xFE, 0x01, 0x54, 0x01,
+    0x8C, 0x00, 0x00, 0x00, 0x2C, 0x01, 0x02, 0x02, 0x64, 0x00, 0x68, 0x01, 0x6E, 0x00, 0x01, 0x01,
+    0x58, 0x02, 0x02, 0x02, 0x64, 0x00, 0x68, 0x01, 0x6E, 0x00, 0x01, 0x00, 0xFA, 0x00, 0xFE, 0x01,
+    0x1C, 0x02, 0x80, 0x02, 0x00, 0x00, 0x01, 0x00, 0xBC, 0x02, 0xFE, 0x01, 0x1C, 0x02, 0x30, 0x02,
+    0x00, 0x00, 0x01, 0x00, 0xBC, 0x02, 0xFE, 0x01, 0x1C, 0x02, 0x94, 0x02, 0x00, 0x00, 0x01, 0x00,
+    0xC8, 0x00, 0xE8, 0x03, 0xFE, 0x01, 0x00, 0x00, 0x46, 0x00, 0x01, 0x00, 0x5A, 0x00, 0x96, 0x00,
+    0xBD, 0x01, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x03, 0x67, 0x02, 0x2C, 0x01,
+    0x00, 0x00, 0x02, 0x00, 0x90, 0x01, 0xD9, 0x03, 0x67, 0x02, 0x4A, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x2C, 0x01, 0x41, 0x00, 0x9E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x84, 0x03, 0x78, 0x00,
+    0xF8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x84, 0x03, 0x41, 0x00, 0x80, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x96, 0x00, 0xFE, 0x01, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x2C, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0x00, 0x00, 0x5A, 0x00, 0x01, 0x00, 0xF4, 0x01, 0xFE, 0x01,
+    0xEA, 0x01, 0x00, 0x00, 0x78, 0x00, 0x01, 0x00, 0x2C, 0x01, 0xFE, 0x01, 0xEA, 0x01, 0x58, 0x02,
+    0x64, 0x00, 0x01, 0x00, 0xC8, 0x00, 0xF7, 0x03, 0xFE, 0x01, 0x00, 0x00, 0x50, 0x00, 0x01, 0x01,
+    0xFA, 0x00, 0x7A, 0x03, 0x8A, 0x02, 0x00, 0x00, 0x6E, 0x00, 0x01, 0x00, 0x58, 0x02, 0x17, 0x02,
+    0x5D, 0x02, 0x00, 0x00, 0x96, 0x00, 0x01, 0x00, 0xDC, 0x05, 0x17, 0x02, 0x80, 0x02, 0x00, 0x00,
+    0xC8, 0x78, 0x01, 0x00, 0x90, 0x01, 0x17, 0x02, 0x5D, 0x02, 0x00, 0x00, 0x96, 0x00, 0x01, 0x00,
+    0xB0, 0x04, 0x17, 0x02, 0x5D, 0x02, 0x00, 0x00, 0x96, 0x00, 0x02, 0x00, 0x96, 0x00, 0x03, 0x02,
+    0xEE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFA, 0x00, 0x2C, 0x01, 0xEE, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0xDA, 0x02, 0xEE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x01, 0xFC, 0x03, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x58, 0x02, 0xFC, 0x03,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x58, 0x02, 0x00, 0x02, 0xFC, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x58, 0x02, 0xFC, 0x03, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+};
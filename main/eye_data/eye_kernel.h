@@ -0,0 +1,145 @@
+#ifndef EYE_KERNEL_H
+#define EYE_KERNEL_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "eye_assets.h"
+#include "eye_codec.h"
+#include "rgb565_ops.h"
+
+// RGB565贴图：像素按小端存储，写入行缓冲前交换字节序
+struct EyeTexel565 {
+    typedef uint16_t Pixel;
+    static constexpr bool kPalette = false;
+    static const Pixel* Pixels(const uint16_t* texture) { return texture; }
+    static uint16_t Fetch(const Pixel* row, int x, const uint16_t*) {
+        uint16_t p = row[x];
+        return (p >> 8) | (p << 8);
+    }
+    static void Copy(uint16_t* dst, const Pixel* src, int count, const uint16_t*) { Rgb565Swap(dst, src, count); }
+};
+
+// 调色板贴图：1字节索引查已交换字节序的调色板，查表结果直接写入行缓冲
+struct EyeTexelPalette {
+    typedef uint8_t Pixel;
+    static constexpr bool kPalette = true;
+    static const Pixel* Pixels(const uint16_t* texture) { return (const Pixel*)(texture + EYE_PALETTE_SIZE); }
+    static uint16_t Fetch(const Pixel* row, int x, const uint16_t* lut) { return lut[row[x]]; }
+    static void Copy(uint16_t* dst, const Pixel* src, int count, const uint16_t* lut) { Rgb565Gather(dst, lut, src, count); }
+};
+
+// 一行中[x0, x1)的巩膜段：按眼睑遮挡拆成连续的可见段和遮挡段，可见段从贴图行整段复制，遮挡段整段清零
+template <typename T>
+static inline void ComposeEyeScleraSpan(uint16_t* row, const typename T::Pixel* src, int x0, int x1,
+    uint16_t y, const uint8_t* top, const uint8_t* bottom, const uint16_t* lut) {
+    int x = x0;
+    while (x < x1) {
+        const int start = x;
+        if (y < top[x] || y >= bottom[x]) {
+            while (x < x1 && (y < top[x] || y >= bottom[x])) x++;
+            Rgb565Fill(row + start, 0, x - start);
+        } else {
+            while (x < x1 && y >= top[x] && y < bottom[x]) x++;
+            T::Copy(row + start, src + start, x - start, lut);
+        }
+    }
+}
+
+/*
+    按分辨率在编译期特化的魔眼合成函数。G提供该分辨率的尺寸常量：
+        kScreenWidth, kScreenHeight, kScleraWidth, kScleraHeight,
+        kIrisWidth, kIrisHeight, kIrisMapWidth, kIrisMapHeight
+    所有行跨度都是编译期常量；极角到虹膜贴图列的换算在选定数据时烘焙进polar_lut，
+    半径 d = iScale * r / 240 由iris_rows给出（只在iScale变化时重建），虹膜像素只剩查表；
+    每行按虹膜矩形拆成三段，巩膜段不再逐像素判断是否落在虹膜内，
+    其中未被眼睑遮挡的连续部分整段复制（rgb565_ops.h，ESP32-S3上用PIE向量指令）。
+    巩膜贴图压缩时，每行只把可见列所在、行缓存中还没有的段解码进缓存，再按未压缩的方式读取；
+    眼睛停留在原处时（眨眼、瞳孔缩放）几乎全部命中缓存。
+    T为贴图格式（EyeTexel565或EyeTexelPalette），调色板贴图不支持压缩。
+    */
+template <typename G, typename T = EyeTexel565>
+void ComposeEyeBatch(const EyeAssets& assets, const EyeFrameTables& tables,
+    const EyeRenderParams& params, uint16_t screenY, uint8_t lines, uint16_t* buf) {
+    static_assert(G::kScreenHeight <= 255, "lid span tables store rows as uint8_t");
+    static_assert(G::kIrisMapWidth <= (1 << EYE_POLAR_COLUMN_BITS), "iris map column must fit the polar lut");
+    static_assert(G::kScleraWidth <= 8 * EYE_CODEC_SEGMENT, "row cache tracks decoded segments in a uint8_t");
+
+    typedef typename T::Pixel Pixel;
+    const Pixel* sclera = T::Pixels(tables.sclera);
+    const Pixel* iris = T::Pixels(tables.iris);
+    const uint16_t* scleraLut = tables.sclera_lut;
+    const uint16_t* irisLut = tables.iris_lut;
+    const uint16_t* polar = tables.polar_lut;
+    const int32_t* irisRow = tables.iris_rows;
+    const uint8_t* top = assets.upper_span + (params.uT > 255 ? 255 : params.uT) * G::kScreenWidth;
+    const uint8_t* bottom = assets.lower_span + (params.lT > 255 ? 255 : params.lT) * G::kScreenWidth;
+
+    uint32_t scleraY = params.scleraY + screenY;
+    int16_t irisY = scleraY - (G::kScleraHeight - G::kIrisHeight) / 2;
+
+    for (uint8_t line = 0; line < lines; line++, scleraY++, irisY++) {
+        const uint16_t y = screenY + line;
+        uint16_t* row = buf + line * G::kScreenWidth;
+        const Pixel* scleraRow = tables.sclera_rows ? (const Pixel*)tables.sclera_rows[scleraY] : sclera + scleraY * G::kScleraWidth;
+
+        // 找出本行可见的列范围，两侧被眼睑遮挡的部分整段清零
+        int x0 = 0, x1 = G::kScreenWidth;
+        while (x0 < x1 && (y < top[x0] || y >= bottom[x0])) x0++;
+        while (x1 > x0 && (y < top[x1 - 1] || y >= bottom[x1 - 1])) x1--;
+        Rgb565Fill(row, 0, x0);
+        Rgb565Fill(row + x1, 0, G::kScreenWidth - x1);
+
+        // 本行按虹膜矩形分成 巩膜|虹膜|巩膜 三段，段内不再逐像素判断虹膜边界
+        uint32_t scleraX = params.scleraX;
+        if constexpr (!T::kPalette) {
+            if (assets.packed_sclera) {
+                EyeRowCache& cache = *tables.sclera_cache;
+                const uint16_t slot = scleraY % cache.rows;
+                if (cache.tag[slot] != (int16_t)scleraY) {
+                    cache.tag[slot] = scleraY;
+                    cache.valid[slot] = 0;
+                }
+                uint16_t* cached = cache.pixels + slot * G::kScleraWidth;
+                if (x0 < x1) {
+                    const uint8_t missing = EyeCodecSegmentMask(scleraX + x0, scleraX + x1) & ~cache.valid[slot];
+                    if (missing) {
+                        EyeCodecDecodeRow((const uint8_t*)tables.sclera, G::kScleraWidth, scleraY, missing, cached);
+                        cache.valid[slot] |= missing;
+                    }
+                }
+                scleraRow = cached;
+            }
+        }
+        const int irisLeft = (G::kScleraWidth - G::kIrisWidth) / 2 - (int)scleraX;  // 虹膜左边界对应的屏幕列
+        int ix0 = x0, ix1 = x0;
+        const uint16_t* polarRow = nullptr;     // 按屏幕列索引的极坐标行
+        if (irisY >= 0 && irisY < G::kIrisHeight) {
+            ix0 = irisLeft < x0 ? x0 : (irisLeft > x1 ? x1 : irisLeft);
+            ix1 = irisLeft + G::kIrisWidth;
+            ix1 = ix1 < ix0 ? ix0 : (ix1 > x1 ? x1 : ix1);
+            polarRow = polar + irisY * G::kIrisWidth - irisLeft;
+        }
+
+        ComposeEyeScleraSpan<T>(row, scleraRow + scleraX, x0, ix0, y, top, bottom, scleraLut);
+        for (int screenX = ix0; screenX < ix1; screenX++) {
+            uint16_t p;
+            // 可见范围内仍可能有被遮挡的列（眼角附近）
+            if (y < top[screenX] || y >= bottom[screenX]) {
+                p = 0;  // 被眼睑遮挡
+            } else {
+                uint16_t v = polarRow[screenX];    // 半径/虹膜贴图列
+                int32_t offset = irisRow[v >> EYE_POLAR_COLUMN_BITS];
+                if (offset >= 0) {
+                    p = T::Fetch(iris, offset + (v & ((1 << EYE_POLAR_COLUMN_BITS) - 1)), irisLut);
+                } else {
+                    p = T::Fetch(scleraRow, scleraX + screenX, scleraLut);
+                }
+            }
+            row[screenX] = p;
+        }
+        ComposeEyeScleraSpan<T>(row, scleraRow + scleraX, ix1, x1, y, top, bottom, scleraLut);
+    }
+}
+
+#endif // EYE_KERNEL_H
@@ -0,0 +1,80 @@
+#ifndef EYE_MAILBOX_H
+#define EYE_MAILBOX_H
+
+#include <atomic>
+#include <stdint.h>
+
+// EyeCommand::changed，标出本次发布的字段
+#define EYE_COMMAND_GAZE    (1 << 0)    // x, y
+#define EYE_COMMAND_BLINK   (1 << 1)
+#define EYE_COMMAND_TRACK   (1 << 2)
+#define EYE_COMMAND_SCLERA  (1 << 3)
+
+// 其他任务对魔眼的一次参数修改，只有changed标出的字段有效
+struct EyeCommand {
+    uint16_t x;         // 注视点，0~1023
+    uint16_t y;
+    bool blink;         // 自动眨眼
+    bool track;         // 眼睑跟随眼球
+    uint8_t sclera;     // EyeSclera，不超过7
+    uint8_t changed;
+};
+
+/*
+    魔眼参数邮箱：协议、触摸等任务随时发布，魔眼任务在每帧开始时一次取走。
+    全部字段打包在一个32位原子字里：
+        bit 0~9 x | bit 10~19 y | bit 20 blink | bit 21 track | bit 22~24 sclera | bit 28~31 changed
+    发布者用CAS把自己的字段合并进去，多个发布者互不阻塞，也不会出现一次发布只生效一半
+    （例如X来自一个表情、Y来自另一个）；同一字段以最后一次发布为准。
+    取走时fetch_and同时读出快照并清除changed，取走之后的发布留到下一帧。
+    ESP32-S3上32位原子操作是无锁的，64位不是，所以字段必须放得进32位。
+    */
+class EyeMailbox {
+public:
+    void Publish(const EyeCommand& command) {
+        const uint32_t mask = FieldMask(command.changed);
+        const uint32_t value = Pack(command) & mask;
+        const uint32_t changed = (uint32_t)(command.changed & 0x0F) << kChangedShift;
+        uint32_t word = word_.load(std::memory_order_relaxed);
+        while (!word_.compare_exchange_weak(word, (word & ~mask) | value | changed,
+            std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    // 取出上次取走之后发布的字段，没有发布时changed为0
+    EyeCommand Take() {
+        return Unpack(word_.fetch_and(~(0x0Fu << kChangedShift), std::memory_order_acquire));
+    }
+
+private:
+    static constexpr int kChangedShift = 28;
+
+    static uint32_t FieldMask(uint8_t changed) {
+        uint32_t mask = 0;
+        if (changed & EYE_COMMAND_GAZE) mask |= 0xFFFFF;
+        if (changed & EYE_COMMAND_BLINK) mask |= 1u << 20;
+        if (changed & EYE_COMMAND_TRACK) mask |= 1u << 21;
+        if (changed & EYE_COMMAND_SCLERA) mask |= 0x07u << 22;
+        return mask;
+    }
+
+    static uint32_t Pack(const EyeCommand& command) {
+        return (command.x & 0x3FF) | (command.y & 0x3FF) << 10 | (uint32_t)command.blink << 20 |
+            (uint32_t)command.track << 21 | (uint32_t)(command.sclera & 0x07) << 22;
+    }
+
+    static EyeCommand Unpack(uint32_t word) {
+        EyeCommand command;
+        command.x = word & 0x3FF;
+        command.y = (word >> 10) & 0x3FF;
+        command.blink = (word >> 20) & 1;
+        command.track = (word >> 21) & 1;
+        command.sclera = (word >> 22) & 0x07;
+        command.changed = word >> kChangedShift;
+        return command;
+    }
+
+    std::atomic<uint32_t> word_{0};
+};
+
+#endif // EYE_MAILBOX_H
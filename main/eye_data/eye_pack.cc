@@ -0,0 +1,131 @@
+#include "eye_pack.h"
+
+namespace {
+
+bool BlobInRange(const EyePackHeader& header, uint32_t offset, size_t bytes) {
+    return offset % 4 == 0 && offset <= header.size && bytes <= header.size - offset;
+}
+
+// 原始数据块只检查大小，压缩数据块检查行/段偏移表；texture为巩膜/虹膜贴图，调色板资源包中按调色板贴图计算大小
+bool BlobValid(const EyePack& pack, uint32_t offset, int width, int height, size_t pixel_size, bool texture = false) {
+    const EyePackHeader& header = *pack.header;
+    if (texture && (header.flags & EYE_PACK_FLAG_PALETTE)) {
+        return BlobInRange(header, offset, EYE_PALETTE_SIZE * sizeof(uint16_t) + width * height);
+    }
+    if (!(header.flags & EYE_PACK_FLAG_COMPRESSED)) {
+        return BlobInRange(header, offset, width * height * pixel_size);
+    }
+    return BlobInRange(header, offset, 0) &&
+        EyeCodecValidate(pack.base + offset, header.size - offset, width, height);
+}
+
+} // namespace
+
+bool EyePackOpen(const void* data, size_t size, EyePack* pack) {
+    if (data == nullptr || size < sizeof(EyePackHeader)) {
+        return false;
+    }
+    const EyePackHeader* header = (const EyePackHeader*)data;
+    if (header->magic != EYE_PACK_MAGIC || header->version != EYE_PACK_VERSION ||
+        (header->flags & ~(EYE_PACK_FLAG_COMPRESSED | EYE_PACK_FLAG_PALETTE)) != 0 ||
+        header->flags == (EYE_PACK_FLAG_COMPRESSED | EYE_PACK_FLAG_PALETTE) ||
+        header->style_count == 0 || header->size > size ||
+        sizeof(EyePackHeader) + header->style_count * sizeof(EyePackStyle) > header->size) {
+        return false;
+    }
+
+    const EyePackStyle* styles = (const EyePackStyle*)(header + 1);
+    const EyePack view = { (const uint8_t*)data, header, styles };
+    for (int i = 0; i < header->style_count; i++) {
+        const EyePackStyle& style = styles[i];
+        if (!BlobValid(view, style.sclera, header->sclera_width, header->sclera_height, sizeof(uint16_t), true) ||
+            !BlobValid(view, style.iris, header->iris_map_width, header->iris_map_height, sizeof(uint16_t), true) ||
+            !BlobValid(view, style.polar, header->iris_width, header->iris_height, sizeof(uint16_t)) ||
+            !BlobValid(view, style.upper, header->screen_width, header->screen_height, sizeof(uint8_t)) ||
+            !BlobValid(view, style.lower, header->screen_width, header->screen_height, sizeof(uint8_t)) ||
+            style.sclera_id >= kEyeScleraCount || style.iris_id >= kEyeIrisCount) {
+            return false;
+        }
+        // 眼睑区间表和极坐标查找表按第一种样式生成，所有样式必须共用这三张图
+        if (style.polar != styles[0].polar || style.upper != styles[0].upper || style.lower != styles[0].lower) {
+            return false;
+        }
+    }
+
+    *pack = view;
+    return true;
+}
+
+void EyePackFillAssets(const EyePack& pack, EyeAssets* assets) {
+    const EyePackHeader& header = *pack.header;
+    assets->screen_width = header.screen_width;
+    assets->screen_height = header.screen_height;
+    assets->sclera_width = header.sclera_width;
+    assets->sclera_height = header.sclera_height;
+    assets->iris_width = header.iris_width;
+    assets->iris_height = header.iris_height;
+    assets->iris_map_width = header.iris_map_width;
+    assets->iris_map_height = header.iris_map_height;
+    assets->upper = pack.base + pack.styles[0].upper;
+    assets->lower = pack.base + pack.styles[0].lower;
+    assets->polar = (const uint16_t*)(pack.base + pack.styles[0].polar);
+    assets->packed_sclera = EyePackCompressed(pack);
+    assets->palette = EyePackPalette(pack);
+
+    // 资源包中没有的编号先用第一种样式的贴图顶上
+    for (int i = 0; i < kEyeScleraCount; i++) {
+        assets->sclera[i] = EyePackSclera(pack, 0);
+    }
+    for (int i = 0; i < kEyeIrisCount; i++) {
+        assets->iris[i] = EyePackIris(pack, 0);
+    }
+    for (int i = 0; i < pack.header->style_count; i++) {
+        assets->sclera[pack.styles[i].sclera_id] = EyePackSclera(pack, i);
+        assets->iris[pack.styles[i].iris_id] = EyePackIris(pack, i);
+    }
+}
+
+EyePackLoadResult EyePackLoadAssets(const EyePack& pack, EyePackAllocFn alloc, EyePackFreeFn release,
+    EyeAssets* assets, EyePackTables* tables) {
+    EyeAssets loaded = {};
+    EyePackFillAssets(pack, &loaded);
+    loaded.compose = FindEyeCompose(loaded);
+    if (loaded.compose == nullptr) {
+        return kEyePackLoadNoCompose;
+    }
+
+    const size_t screen = loaded.screen_width * loaded.screen_height;
+    uint8_t* decoded = nullptr;
+    if (EyePackCompressed(pack)) {
+        decoded = (uint8_t*)alloc(2 * screen + loaded.iris_width * loaded.iris_height * sizeof(uint16_t));
+        if (decoded == nullptr) {
+            return kEyePackLoadNoMemory;
+        }
+        EyeCodecDecode8(loaded.upper, loaded.screen_width, loaded.screen_height, decoded);
+        EyeCodecDecode8(loaded.lower, loaded.screen_width, loaded.screen_height, decoded + screen);
+        EyeCodecDecode((const uint8_t*)loaded.polar, loaded.iris_width, loaded.iris_height, (uint16_t*)(decoded + 2 * screen));
+        loaded.upper = decoded;
+        loaded.lower = decoded + screen;
+        loaded.polar = (const uint16_t*)(decoded + 2 * screen);
+        for (int i = 0; i < kEyeIrisCount; i++) {
+            loaded.iris[i] = nullptr;
+        }
+    }
+
+    const size_t spanSize = 256 * loaded.screen_width;
+    uint8_t* lids = (uint8_t*)alloc(2 * spanSize + EyeLidFollowRows(loaded) * EyeLidFollowColumns(loaded));
+    if (lids == nullptr) {
+        release(decoded);
+        return kEyePackLoadNoMemory;
+    }
+    BuildEyeLidSpans(loaded, lids, lids + spanSize);
+    BuildEyeLidFollow(loaded, lids + 2 * spanSize);
+    loaded.upper_span = lids;
+    loaded.lower_span = lids + spanSize;
+    loaded.lid_follow = lids + 2 * spanSize;
+
+    *assets = loaded;
+    tables->decoded = decoded;
+    tables->lids = lids;
+    return kEyePackLoadOk;
+}
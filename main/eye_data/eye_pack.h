@@ -0,0 +1,111 @@
+#ifndef EYE_PACK_H
+#define EYE_PACK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "eye_assets.h"
+#include "eye_codec.h"
+
+/*
+    魔眼资源包：由 scripts/gen_eye_pack.py 生成，烧录在 eye_assets 分区中，运行时直接mmap使用。
+    布局（小端）：EyePackHeader，紧接style_count条EyePackStyle，之后是按4字节对齐的数据块；
+    所有偏移量从资源包开头算起，相同的数据块只存一次。
+    flags带EYE_PACK_FLAG_COMPRESSED时所有数据块都是eye_codec.h格式的压缩贴图；
+    带EYE_PACK_FLAG_PALETTE时巩膜和虹膜是调色板贴图（见eye_assets.h的EYE_PALETTE_SIZE），其余数据块按原数组存储；
+    两个标志都没有时全部按原数组存储。
+    */
+#define EYE_PACK_MAGIC      0x50455945  // "EYEP"
+#define EYE_PACK_VERSION    3
+#define EYE_PACK_FLAG_COMPRESSED    (1 << 0)
+#define EYE_PACK_FLAG_PALETTE       (1 << 1)
+#define EYE_PACK_NAME_LEN   16
+
+struct EyePackHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t style_count;
+    uint32_t size;          // 整个资源包的字节数
+    uint16_t screen_width;
+    uint16_t screen_height;
+    uint16_t sclera_width;
+    uint16_t sclera_height;
+    uint16_t iris_width;
+    uint16_t iris_height;
+    uint16_t iris_map_width;
+    uint16_t iris_map_height;
+    uint16_t flags;
+    uint16_t reserved;
+};
+
+// 每种样式一条，第i条对应Application::eye_style(i + 1)
+struct EyePackStyle {
+    char name[EYE_PACK_NAME_LEN];
+    uint32_t sclera;
+    uint32_t iris;
+    uint32_t polar;
+    uint32_t upper;
+    uint32_t lower;
+    uint8_t sclera_id;      // 对应的EyeSclera编号，用于按编号单独切换巩膜
+    uint8_t iris_id;        // 对应的EyeIris编号
+    uint16_t reserved;
+};
+
+static_assert(sizeof(EyePackHeader) == 32, "EyePackHeader layout must match scripts/gen_eye_pack.py");
+static_assert(sizeof(EyePackStyle) == 40, "EyePackStyle layout must match scripts/gen_eye_pack.py");
+
+// 已校验的资源包视图，指针都指向mmap出来的只读数据
+struct EyePack {
+    const uint8_t* base;
+    const EyePackHeader* header;
+    const EyePackStyle* styles;
+};
+
+// 校验资源包并填写pack，格式、版本或任一数据块越界时返回false
+bool EyePackOpen(const void* data, size_t size, EyePack* pack);
+
+// 用资源包填写assets：尺寸、眼睑阈值图、极坐标图和按编号排列的贴图指针。
+// 眼睑区间表和合成函数不在资源包中，由调用者补上；压缩的资源包中除巩膜外的数据块需由调用者解码后替换
+void EyePackFillAssets(const EyePack& pack, EyeAssets* assets);
+
+// 加载资源包时在RAM中生成的数据，都由EyePackLoadAssets分配
+struct EyePackTables {
+    uint8_t* decoded;   // 压缩资源包解码后的上/下眼睑阈值图和极坐标图，未压缩时为nullptr
+    uint8_t* lids;      // 眼睑区间表和上眼睑跟随表
+};
+
+enum EyePackLoadResult {
+    kEyePackLoadOk,
+    kEyePackLoadNoCompose,  // 没有与资源包尺寸、贴图格式对应的合成函数
+    kEyePackLoadNoMemory,
+};
+
+typedef void* (*EyePackAllocFn)(size_t size);
+typedef void (*EyePackFreeFn)(void* ptr);
+
+/*
+    由已校验的资源包生成可直接合成的assets：EyePackFillAssets之后补上合成函数，
+    压缩的资源包把眼睑阈值图和极坐标图整张解码（巩膜在合成时逐行解码，虹膜由调用者在切换样式时解码，iris[]置空），
+    再由阈值图生成眼睑区间表和上眼睑跟随表。内存用alloc分配，记录在tables中；
+    失败时已经分配的内存都已用release释放，assets和tables不变
+    */
+EyePackLoadResult EyePackLoadAssets(const EyePack& pack, EyePackAllocFn alloc, EyePackFreeFn release,
+    EyeAssets* assets, EyePackTables* tables);
+
+static inline bool EyePackCompressed(const EyePack& pack) {
+    return (pack.header->flags & EYE_PACK_FLAG_COMPRESSED) != 0;
+}
+
+static inline bool EyePackPalette(const EyePack& pack) {
+    return (pack.header->flags & EYE_PACK_FLAG_PALETTE) != 0;
+}
+
+static inline const uint16_t* EyePackSclera(const EyePack& pack, int style) {
+    return (const uint16_t*)(pack.base + pack.styles[style].sclera);
+}
+
+static inline const uint16_t* EyePackIris(const EyePack& pack, int style) {
+    return (const uint16_t*)(pack.base + pack.styles[style].iris);
+}
+
+#endif // EYE_PACK_H
@@ -0,0 +1,83 @@
+#include "eye_render.h"
+
+void BuildEyeLidRowRanges(const EyeAssets& assets, EyeLidRowRanges* ranges) {
+    for (int y = 0; y < assets.screen_height; y++) {
+        uint8_t uMin = 255, uMax = 0, lMin = 255, lMax = 0;
+        for (int x = 0; x < assets.screen_width; x++) {
+            uint8_t u = assets.upper[y * assets.screen_width + x];
+            uint8_t l = assets.lower[y * assets.screen_width + x];
+            if (u < uMin) uMin = u;
+            if (u > uMax) uMax = u;
+            if (l < lMin) lMin = l;
+            if (l > lMax) lMax = l;
+        }
+        ranges->upper_min[y] = uMin;
+        ranges->upper_max[y] = uMax;
+        ranges->lower_min[y] = lMin;
+        ranges->lower_max[y] = lMax;
+    }
+}
+
+uint32_t ComputeEyeDamage(const EyeAssets& assets, const EyeLidRowRanges& ranges, int batch_lines,
+    const EyeRenderParams& cur, const EyeRenderParams& prev, bool full) {
+    if (full || cur.scleraX != prev.scleraX || cur.scleraY != prev.scleraY) {
+        return EyeAllBatches(assets, batch_lines);
+    }
+
+    uint32_t damage = 0;
+    if (cur.iScale != prev.iScale) {
+        int top = (assets.sclera_height - assets.iris_height) / 2 - (int)cur.scleraY;
+        int bottom = top + assets.iris_height;
+        if (top < 0) top = 0;
+        if (bottom > assets.screen_height) bottom = assets.screen_height;
+        for (int b = top / batch_lines; b * batch_lines < bottom; b++) {
+            damage |= 1UL << b;
+        }
+    }
+    if (cur.uT != prev.uT || cur.lT != prev.lT) {
+        uint32_t uLo = cur.uT < prev.uT ? cur.uT : prev.uT, uHi = cur.uT < prev.uT ? prev.uT : cur.uT;
+        uint32_t lLo = cur.lT < prev.lT ? cur.lT : prev.lT, lHi = cur.lT < prev.lT ? prev.lT : cur.lT;
+        for (int y = 0; y < assets.screen_height; y++) {
+            if ((uLo != uHi && ranges.upper_min[y] <= uHi && ranges.upper_max[y] > uLo) ||
+                (lLo != lHi && ranges.lower_min[y] <= lHi && ranges.lower_max[y] > lLo)) {
+                damage |= 1UL << (y / batch_lines);
+            }
+        }
+    }
+    return damage;
+}
+
+void EyeComposeFaded(const EyeAssets& assets, const EyeFrameTables& tables, const EyeRenderParams& params,
+    uint16_t screenY, uint8_t lines, uint16_t* buf, const EyeFade* fade) {
+    assets.compose(assets, tables, params, screenY, lines, buf);
+    if (fade != nullptr && fade->weight < EYE_FADE_ONE) {
+        assets.compose(assets, *fade->from, params, screenY, lines, fade->scratch);
+        Rgb565Blend(buf, fade->scratch, lines * assets.screen_width, fade->weight);
+    }
+}
+
+void EyeRenderBatches(const EyeAssets& assets, const EyeFrameTables& tables, const EyeRenderParams& params,
+    uint8_t eye, uint32_t damage, int batch_lines, EyePanelSink& sink, const EyeFade* fade) {
+    for (uint16_t screenY = 0; screenY < assets.screen_height; screenY += batch_lines) {
+        if (!(damage & (1UL << (screenY / batch_lines)))) {
+            continue;
+        }
+        // 处理到屏幕底部时可能不足batch_lines行
+        uint8_t lines = (assets.screen_height - screenY) < batch_lines ? (assets.screen_height - screenY) : batch_lines;
+        uint16_t* buf = sink.AcquireBatch(eye, screenY, lines);
+        if (buf == nullptr) {
+            continue;
+        }
+        EyeComposeFaded(assets, tables, params, screenY, lines, buf, fade);
+        sink.SubmitBatch(eye, screenY, lines, buf);
+    }
+}
+
+uint16_t* EyeFrameRecorder::AcquireBatch(uint8_t eye, uint16_t screenY, uint8_t /*lines*/) {
+    return frames_[eye] + screenY * assets_.screen_width;
+}
+
+void EyeFrameRecorder::SubmitBatch(uint8_t /*eye*/, uint16_t /*screenY*/, uint8_t lines, uint16_t* /*buf*/) {
+    batches_++;
+    lines_ += lines;
+}
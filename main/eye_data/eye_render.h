@@ -0,0 +1,95 @@
+#ifndef EYE_RENDER_H
+#define EYE_RENDER_H
+
+#include <stdint.h>
+
+#include "eye_assets.h"
+#include "rgb565_ops.h"
+
+/*
+    与平台无关的一帧渲染：重绘区域计算和按批次合成，不依赖ESP-IDF，可以在主机上编译（见 eye_data/host）。
+    屏幕按batch_lines行分成若干批，damage的第b位对应从b * batch_lines行开始的一批，最多32批。
+    */
+#define EYE_MAX_DAMAGE_BATCHES 32
+
+// 眼睑阈值图每一行的最小/最大值，用于判断阈值变化会影响哪些行
+struct EyeLidRowRanges {
+    uint8_t upper_min[256];
+    uint8_t upper_max[256];
+    uint8_t lower_min[256];
+    uint8_t lower_max[256];
+};
+
+// 选定魔眼数据后执行一次
+void BuildEyeLidRowRanges(const EyeAssets& assets, EyeLidRowRanges* ranges);
+
+static inline int EyeBatchCount(const EyeAssets& assets, int batch_lines) {
+    return (assets.screen_height + batch_lines - 1) / batch_lines;
+}
+
+static inline uint32_t EyeAllBatches(const EyeAssets& assets, int batch_lines) {
+    int count = EyeBatchCount(assets, batch_lines);
+    return count >= EYE_MAX_DAMAGE_BATCHES ? 0xFFFFFFFFUL : ((1UL << count) - 1);
+}
+
+/*
+    从prev变到cur时需要重绘的批次：
+    眼球位置变化时巩膜贴图整体平移，整屏重绘（贴图变化由调用者按full处理）；
+    只有瞳孔缩放变化时，只有虹膜矩形覆盖的行会变化；
+    眼睑阈值从a变到b时，只有阈值图的值落在(a, b]之间的像素会改变遮挡状态，
+    用每行的最小/最大值判断该行是否可能包含这样的像素。
+    */
+uint32_t ComputeEyeDamage(const EyeAssets& assets, const EyeLidRowRanges& ranges, int batch_lines,
+    const EyeRenderParams& cur, const EyeRenderParams& prev, bool full);
+
+// 合成结果的去处：固件中是LCD的DMA行缓冲环，主机上可以用EyeFrameRecorder记录整帧
+class EyePanelSink {
+public:
+    virtual ~EyePanelSink() = default;
+    // 返回可以写入lines行的缓冲区，可以阻塞到该缓冲区上一次的传输结束；
+    // 等待超时、缓冲区仍被DMA占用时返回nullptr，这一批不合成也不提交，由sink负责安排重绘
+    virtual uint16_t* AcquireBatch(uint8_t eye, uint16_t screenY, uint8_t lines) = 0;
+    // 提交AcquireBatch返回的缓冲区，提交后就可以开始合成下一批
+    virtual void SubmitBatch(uint8_t eye, uint16_t screenY, uint8_t lines, uint16_t* buf) = 0;
+};
+
+/*
+    样式切换时的淡入：每批另外用旧样式的贴图合成一份画面，再逐像素按weight混合。
+    两份画面的眼睑、虹膜位置完全相同，只有贴图不同；旧样式的巩膜不能是压缩贴图（行缓存属于新样式）。
+    */
+#define EYE_FADE_ONE RGB565_BLEND_ONE     // 混合权重的满值
+
+struct EyeFade {
+    const EyeFrameTables* from; // 旧样式的贴图和查找表
+    uint16_t* scratch;          // 旧样式一批的合成结果，至少batch_lines * screen_width项
+    int weight;                 // 新样式所占的比例，0~EYE_FADE_ONE
+};
+
+// 合成一批，fade不为空且权重不满时同时合成旧样式并混合
+void EyeComposeFaded(const EyeAssets& assets, const EyeFrameTables& tables, const EyeRenderParams& params,
+    uint16_t screenY, uint8_t lines, uint16_t* buf, const EyeFade* fade);
+
+// 按damage依次合成一只眼睛的各批并交给sink
+void EyeRenderBatches(const EyeAssets& assets, const EyeFrameTables& tables, const EyeRenderParams& params,
+    uint8_t eye, uint32_t damage, int batch_lines, EyePanelSink& sink, const EyeFade* fade = nullptr);
+
+/*
+    直接在每只眼睛的整帧缓冲中合成，像素与发给屏幕的完全相同（已交换字节序的RGB565）。
+    用于在主机上比较渲染结果和测量合成速度；frames[eye]为screen_width * screen_height项，由调用者提供
+    */
+class EyeFrameRecorder : public EyePanelSink {
+public:
+    EyeFrameRecorder(const EyeAssets& assets, uint16_t* const* frames) : assets_(assets), frames_(frames) {}
+    uint16_t* AcquireBatch(uint8_t eye, uint16_t screenY, uint8_t lines) override;
+    void SubmitBatch(uint8_t eye, uint16_t screenY, uint8_t lines, uint16_t* buf) override;
+    uint32_t batches() const { return batches_; }
+    uint32_t lines() const { return lines_; }
+
+private:
+    const EyeAssets& assets_;
+    uint16_t* const* frames_;
+    uint32_t batches_ = 0;      // 累计提交的批次和行数
+    uint32_t lines_ = 0;
+};
+
+#endif // EYE_RENDER_H
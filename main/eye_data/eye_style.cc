@@ -0,0 +1,66 @@
+#include "eye_style.h"
+#include "eye_render.h"
+
+#include <string.h>
+
+const EyeBuiltinStyle kEyeBuiltinStyles[] = {
+    { "default",    kEyeScleraDefault,   kEyeIrisDefault },
+    { "blood",      kEyeScleraWhite,     kEyeIrisBlood },
+    { "cospa",      kEyeScleraCuteGirl,  kEyeIrisCospa },
+    { "spikes",     kEyeScleraWhite,     kEyeIrisSpikes },
+    { "ribbon",     kEyeScleraOceanGirl, kEyeIrisRibbon },
+    { "black_star", kEyeScleraZhuozhu,   kEyeIrisBlackStar },
+    { "straw",      kEyeScleraLufei,     kEyeIrisStraw },
+};
+
+const int kEyeBuiltinStyleCount = sizeof(kEyeBuiltinStyles) / sizeof(kEyeBuiltinStyles[0]);
+
+const char* const kEyeScleraNames[kEyeScleraCount] = {
+    "default", "white", "zhuozhu", "cute_girl", "ocean_girl", "lufei",
+};
+
+int FindEyeBuiltinStyle(const char* name) {
+    for (int i = 0; i < kEyeBuiltinStyleCount; i++) {
+        if (strcmp(kEyeBuiltinStyles[i].name, name) == 0) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+void EyeStyleManager::RequestSclera(uint8_t sclera, uint8_t fade_frames) {
+    uint32_t request = request_.load(std::memory_order_relaxed);
+    uint32_t updated;
+    do {
+        updated = (uint32_t)(sclera + 1) << 16 | (uint32_t)fade_frames << 8 | (request & 0xFF);
+    } while (!request_.compare_exchange_weak(request, updated, std::memory_order_release, std::memory_order_relaxed));
+}
+
+bool EyeStyleManager::Take(uint8_t* style, uint8_t* fade_frames, uint8_t* sclera) {
+    uint32_t request = request_.exchange(0, std::memory_order_acquire);
+    if ((request & 0xFF00FF) == 0) {
+        return false;
+    }
+    *style = request & 0xFF;
+    *fade_frames = (request >> 8) & 0xFF;
+    *sclera = (request >> 16) & 0xFF ? ((request >> 16) & 0xFF) - 1 : EYE_SCLERA_OF_STYLE;
+    return true;
+}
+
+bool EyeStyleManager::Commit(Staged* staged) {
+    if (!has_staged_) {
+        return false;
+    }
+    *staged = staged_;
+    has_staged_ = false;
+    return true;
+}
+
+// 淡入的frames帧都是混合画面，权重依次为 1/(frames+1) ... frames/(frames+1)，之后一帧是完整的新样式
+int EyeStyleManager::NextFadeWeight() {
+    if (fade_frame_ >= fade_frames_) {
+        return EYE_FADE_ONE;
+    }
+    fade_frame_++;
+    return fade_frame_ * EYE_FADE_ONE / (fade_frames_ + 1);
+}
@@ -0,0 +1,84 @@
+#ifndef EYE_STYLE_H
+#define EYE_STYLE_H
+
+#include <atomic>
+#include <stdint.h>
+
+#include "eye_assets.h"
+
+/*
+    魔眼样式切换。
+    触摸、MCP、IoT等任务只把请求写进一个原子字，由魔眼任务在帧开始时取走：
+    取走的这一帧先解析出新样式的巩膜和虹膜并预取（资源包中压缩的虹膜在此时解码），
+    下一帧开始时两张贴图同时换上，合成过程中不会出现半帧旧样式，也不会出现巩膜和虹膜分属两个样式。
+    换上后可以在若干帧内从旧样式淡入新样式，混合见eye_render.h的EyeFade。
+    触摸等只换巩膜的请求同样经过这里，作为当前样式上的巩膜覆盖预取、换上，并记录在当前状态中。
+    */
+#define EYE_STYLE_NO_FADE   0
+#define EYE_SCLERA_OF_STYLE 0xFF    // 没有巩膜覆盖，使用样式自己的巩膜
+
+// 编译进固件的样式，第i条对应样式编号i + 1，名字和scripts/gen_eye_pack.py中的一致
+struct EyeBuiltinStyle {
+    const char* name;
+    EyeSclera sclera;
+    EyeIris iris;
+};
+
+extern const EyeBuiltinStyle kEyeBuiltinStyles[];
+extern const int kEyeBuiltinStyleCount;
+
+// 按名字查找编译进固件的样式，返回样式编号（从1开始），没有时返回0
+int FindEyeBuiltinStyle(const char* name);
+
+// 巩膜贴图的名字，按EyeSclera排列
+extern const char* const kEyeScleraNames[kEyeScleraCount];
+
+class EyeStyleManager {
+public:
+    // 已预取、等待在下一帧开始时换上的样式
+    struct Staged {
+        uint8_t style;
+        uint8_t fade_frames;
+        const uint16_t* sclera;
+        const uint16_t* iris;
+        uint8_t sclera_override;    // EyeSclera，EYE_SCLERA_OF_STYLE表示样式自己的巩膜
+    };
+
+    // 任何任务都可以调用：请求切换到样式style（从1开始），fade_frames为淡入的帧数，EYE_STYLE_NO_FADE为直接切换。
+    // 还没有被取走的请求被新的请求覆盖，新样式使用自己的巩膜
+    void Request(uint8_t style, uint8_t fade_frames) {
+        request_.store((uint32_t)fade_frames << 8 | style, std::memory_order_release);
+    }
+    // 只换巩膜：在还没被取走的样式请求上（没有时在当前样式上）覆盖巩膜
+    void RequestSclera(uint8_t sclera, uint8_t fade_frames);
+
+    // 以下只在魔眼任务中调用
+    // 取走请求，没有请求时返回false；style为0表示保持当前样式，sclera为EYE_SCLERA_OF_STYLE表示不覆盖巩膜
+    bool Take(uint8_t* style, uint8_t* fade_frames, uint8_t* sclera);
+    // 记下预取好的样式，下一次Commit时换上；之前还没换上的会被替换
+    void Stage(const Staged& staged) {
+        staged_ = staged;
+        has_staged_ = true;
+    }
+    // 帧开始时取出上一帧预取好的样式，没有时返回false
+    bool Commit(Staged* staged);
+
+    // 样式已换上，之后frames帧从旧样式淡入；淡入过程中再次切换时从当前的新样式重新开始
+    void BeginFade(uint8_t frames) {
+        fade_frames_ = frames;
+        fade_frame_ = 0;
+    }
+    // 每帧调用一次，返回本帧新样式所占的比例（0~EYE_FADE_ONE），不在淡入过程中时为EYE_FADE_ONE
+    int NextFadeWeight();
+
+private:
+    // 低8位为样式编号（0为当前样式），8~15位为淡入帧数，16~23位为巩膜编号加1（0为不覆盖）；
+    // 样式编号和巩膜都为0时表示没有请求
+    std::atomic<uint32_t> request_{0};
+    Staged staged_ = {};
+    bool has_staged_ = false;
+    uint8_t fade_frames_ = 0;
+    uint8_t fade_frame_ = 0;
+};
+
+#endif // EYE_STYLE_H
@@ -0,0 +1,153 @@
+#include "eye_timeline.h"
+
+#include <string.h>
+
+#include "eye_emotions_table.h"
+
+namespace {
+
+EyePose KeyframePose(const EyeKeyframe& key) {
+    return { key.x, key.y, key.iris, key.upper, key.lower };
+}
+
+int Lerp(int a, int b, int w) {
+    return a + (b - a) * w / 256;
+}
+
+} // namespace
+
+const uint8_t* EyeEmotionBuiltinTable(size_t* size) {
+    *size = sizeof(kEyeEmotionTable);
+    return kEyeEmotionTable;
+}
+
+bool EyeEmotionTableOpen(const void* data, size_t size, EyeEmotionTable* table) {
+    if (data == nullptr || ((uintptr_t)data & 3) != 0 || size < sizeof(EyeEmotionHeader)) {
+        return false;
+    }
+    const EyeEmotionHeader* header = (const EyeEmotionHeader*)data;
+    const size_t slots = (header->slot_count + 3) & ~3;
+    if (header->magic != EYE_EMOTION_MAGIC || header->version != EYE_EMOTION_VERSION ||
+        header->emotion_count == 0 || header->emotion_count == 0xFF || header->slot_count == 0 ||
+        (header->slot_count & (header->slot_count - 1)) != 0 ||
+        sizeof(EyeEmotionHeader) + slots + header->emotion_count * sizeof(EyeEmotion) +
+        header->keyframe_count * sizeof(EyeKeyframe) > size) {
+        return false;
+    }
+
+    const uint8_t* base = (const uint8_t*)data;
+    const EyeEmotionTable view = {
+        header,
+        base + sizeof(EyeEmotionHeader),
+        (const EyeEmotion*)(base + sizeof(EyeEmotionHeader) + slots),
+        (const EyeKeyframe*)(base + sizeof(EyeEmotionHeader) + slots + header->emotion_count * sizeof(EyeEmotion)),
+    };
+    for (int i = 0; i < header->slot_count; i++) {
+        if (view.slots[i] != 0xFF && view.slots[i] >= header->emotion_count) {
+            return false;
+        }
+    }
+    for (int i = 0; i < header->emotion_count; i++) {
+        const EyeEmotion& emotion = view.emotions[i];
+        if (emotion.count == 0 || emotion.first + emotion.count > header->keyframe_count ||
+            (emotion.loop != EYE_EMOTION_NO_LOOP && emotion.loop >= emotion.count)) {
+            return false;
+        }
+    }
+    for (int i = 0; i < header->keyframe_count; i++) {
+        if (view.keyframes[i].curve > EYE_CURVE_STEP) {
+            return false;
+        }
+    }
+
+    *table = view;
+    return true;
+}
+
+int FindEyeEmotion(const EyeEmotionTable& table, const char* name) {
+    const uint8_t index = table.slots[EyeEmotionHash(name, table.header->seed) & (table.header->slot_count - 1)];
+    if (index == 0xFF || strnlen(name, EYE_EMOTION_NAME_LEN + 1) > EYE_EMOTION_NAME_LEN ||
+        strncmp(name, table.emotions[index].name, EYE_EMOTION_NAME_LEN) != 0) {
+        return -1;
+    }
+    return index;
+}
+
+void EyeTimelineInit(EyeTimeline* timeline, const EyeEmotionTable* table, const uint8_t* ease) {
+    memset(timeline, 0, sizeof(*timeline));
+    timeline->table = table;
+    timeline->ease = ease;
+    timeline->pose.x = 512;
+    timeline->pose.y = 512;
+}
+
+void EyeTimelineStart(EyeTimeline* timeline, int emotion, uint64_t now_us) {
+    timeline->emotion = &timeline->table->emotions[emotion];
+    timeline->index = 0;
+    timeline->done = false;
+    timeline->segment_start_us = now_us;
+    timeline->from = timeline->pose;
+    timeline->events = timeline->table->keyframes[timeline->emotion->first].events;
+}
+
+uint8_t EyeTimelineAdvance(EyeTimeline* timeline, uint64_t now_us, uint16_t auto_iris) {
+    if (timeline->emotion == nullptr) {
+        return 0;
+    }
+    const EyeEmotion& emotion = *timeline->emotion;
+    const EyeKeyframe* keys = timeline->table->keyframes + emotion.first;
+    uint8_t events = timeline->events;
+    timeline->events = 0;
+
+    // 跳过已经播完的段；一次最多走一圈，零时长的循环不会卡住
+    for (int step = 0; !timeline->done && step <= emotion.count; step++) {
+        const EyeKeyframe& key = keys[timeline->index];
+        const uint64_t end = timeline->segment_start_us + key.duration_ms * 1000ULL;
+        if (now_us < end) {
+            break;
+        }
+        timeline->from = KeyframePose(key);
+        timeline->segment_start_us = end;
+        if (timeline->index + 1 < emotion.count) {
+            timeline->index++;
+        } else if (emotion.loop != EYE_EMOTION_NO_LOOP) {
+            timeline->index = emotion.loop;
+        } else {
+            timeline->done = true;
+            break;
+        }
+        events |= keys[timeline->index].events;
+        if (step == emotion.count) {
+            timeline->segment_start_us = now_us;
+        }
+    }
+
+    const EyeKeyframe& key = keys[timeline->index];
+    if (timeline->done) {
+        timeline->pose = KeyframePose(key);
+        return events;
+    }
+
+    // 段内权重0~256
+    const uint32_t duration = key.duration_ms * 1000;
+    const uint32_t elapsed = now_us - timeline->segment_start_us;
+    int w = 256;
+    if (key.curve == EYE_CURVE_LINEAR) {
+        w = elapsed * 256ULL / duration;
+    } else if (key.curve == EYE_CURVE_EASE) {
+        w = timeline->ease[elapsed * 255ULL / duration] + 1;
+    }
+
+    const EyePose& from = timeline->from;
+    EyePose& pose = timeline->pose;
+    pose.x = Lerp(from.x, key.x, w);
+    pose.y = Lerp(from.y, key.y, w);
+    pose.upper = Lerp(from.upper, key.upper, w);
+    pose.lower = Lerp(from.lower, key.lower, w);
+    if (from.iris == 0 && key.iris == 0) {
+        pose.iris = 0;
+    } else {
+        pose.iris = Lerp(from.iris ? from.iris : auto_iris, key.iris ? key.iris : auto_iris, w);
+    }
+    return events;
+}
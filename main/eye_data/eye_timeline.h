@@ -0,0 +1,129 @@
+#ifndef EYE_TIMELINE_H
+#define EYE_TIMELINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+    表情驱动的魔眼关键帧动画。
+    每个表情是一小段关键帧：注视点、虹膜缩放、上/下眼睑阈值下限，以及进入该段时触发的眨眼事件；
+    关键帧之间按曲线插值，缓动曲线复用Application中的ease[]表。
+    表情数据由 scripts/gen_eye_emotions.py 生成为紧凑的二进制表（小端，按4字节对齐）：
+        EyeEmotionHeader
+        uint8_t slot[slot_count]        完美哈希槽，值为表情编号，0xFF为空；之后补齐到4字节
+        EyeEmotion[emotion_count]
+        EyeKeyframe[keyframe_count]
+    表情名按EyeEmotionHash(name, seed) & (slot_count - 1)直接落到唯一的槽，查找只需一次哈希和一次比较。
+    */
+#define EYE_EMOTION_MAGIC       0x4D455945  // "EYEM"
+#define EYE_EMOTION_VERSION     1
+#define EYE_EMOTION_NAME_LEN    12
+#define EYE_EMOTION_NO_LOOP     0xFF
+
+// EyeEmotion::flags，表情开始时应用
+#define EYE_EMOTION_BLINK       (1 << 0)    // 自动眨眼
+#define EYE_EMOTION_TRACK       (1 << 1)    // 眼睑跟随眼球
+
+// EyeKeyframe::curve
+#define EYE_CURVE_LINEAR        0
+#define EYE_CURVE_EASE          1           // ease[]缓入缓出
+#define EYE_CURVE_STEP          2           // 段开始时直接跳到目标值
+
+// EyeKeyframe::events，进入该段时触发一次
+#define EYE_EVENT_BLINK         (1 << 0)    // 所有眼睛眨眼
+#define EYE_EVENT_WINK          (1 << 1)    // 最后一只眼睛单独眨眼
+
+struct EyeEmotionHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t emotion_count;
+    uint8_t slot_count;     // 2的幂
+    uint32_t seed;
+    uint16_t keyframe_count;
+    uint16_t reserved;
+};
+
+struct EyeEmotion {
+    char name[EYE_EMOTION_NAME_LEN];    // 不足时补0，正好12个字符时没有结尾的0
+    uint16_t first;         // 第一个关键帧的编号
+    uint8_t count;          // 关键帧数
+    uint8_t loop;           // 播完后从第loop个关键帧（相对first）继续循环，EYE_EMOTION_NO_LOOP为停在最后一帧
+    uint16_t tint;          // 调色板着色，RGB565
+    uint8_t tint_strength;  // 0为不着色
+    uint8_t flags;
+};
+
+struct EyeKeyframe {
+    uint16_t duration_ms;   // 从上一关键帧过渡到本关键帧的时长
+    uint16_t x;             // 注视点，0~1023
+    uint16_t y;
+    uint16_t iris;          // 虹膜缩放，0为沿用自动的瞳孔变化
+    uint8_t upper;          // 上/下眼睑阈值下限，越大眼睛越闭合，0为不干预
+    uint8_t lower;
+    uint8_t curve;
+    uint8_t events;
+};
+
+static_assert(sizeof(EyeEmotionHeader) == 16, "EyeEmotionHeader layout must match scripts/gen_eye_emotions.py");
+static_assert(sizeof(EyeEmotion) == 20, "EyeEmotion layout must match scripts/gen_eye_emotions.py");
+static_assert(sizeof(EyeKeyframe) == 12, "EyeKeyframe layout must match scripts/gen_eye_emotions.py");
+
+// 已校验的表情表视图
+struct EyeEmotionTable {
+    const EyeEmotionHeader* header;
+    const uint8_t* slots;
+    const EyeEmotion* emotions;
+    const EyeKeyframe* keyframes;
+};
+
+// 一帧的动画姿态
+struct EyePose {
+    uint16_t x;
+    uint16_t y;
+    uint16_t iris;          // 0为不干预
+    uint8_t upper;
+    uint8_t lower;
+};
+
+// 播放状态，全部是定长字段：切换表情只重置这些字段，不申请内存
+struct EyeTimeline {
+    const EyeEmotionTable* table;
+    const uint8_t* ease;    // 256项缓动曲线
+    const EyeEmotion* emotion;  // nullptr为未播放
+    uint16_t index;         // 正在过渡到的关键帧（相对first）
+    bool done;              // 不循环的表情已停在最后一帧
+    uint8_t events;         // 第一段的事件，在开始后的第一次推进时返回
+    uint64_t segment_start_us;
+    EyePose from;           // 当前段的起点
+    EyePose pose;           // 最近一次求出的姿态
+};
+
+// FNV-1a，初值为seed；最后把高位折叠进低位，否则取低位的槽号只受seed低位影响
+static inline uint32_t EyeEmotionHash(const char* name, uint32_t seed) {
+    uint32_t h = seed;
+    while (*name) {
+        h ^= (uint8_t)*name++;
+        h *= 16777619u;
+    }
+    return h ^ (h >> 16);
+}
+
+// 编译进固件的表情表
+const uint8_t* EyeEmotionBuiltinTable(size_t* size);
+
+// 校验表情表并填写table：格式、版本、槽或关键帧越界时返回false
+bool EyeEmotionTableOpen(const void* data, size_t size, EyeEmotionTable* table);
+
+// 按名字查找表情编号，没有时返回-1
+int FindEyeEmotion(const EyeEmotionTable& table, const char* name);
+
+void EyeTimelineInit(EyeTimeline* timeline, const EyeEmotionTable* table, const uint8_t* ease);
+
+// 从当前姿态timeline->pose开始播放第emotion个表情，第一段从当前姿态过渡，切换当帧生效
+void EyeTimelineStart(EyeTimeline* timeline, int emotion, uint64_t now_us);
+
+// 推进到now_us并更新timeline->pose，返回这期间进入的各段的事件。
+// 关键帧虹膜为0的一端按auto_iris（当前自动的瞳孔缩放）插值，过渡结束后pose.iris回到0
+uint8_t EyeTimelineAdvance(EyeTimeline* timeline, uint64_t now_us, uint16_t auto_iris);
+
+#endif // EYE_TIMELINE_H
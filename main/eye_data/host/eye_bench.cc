@@ -0,0 +1,261 @@
+// 魔眼合成的主机基准：每种编译进来的分辨率、每个样式按固件的批次整帧合成，
+// 眼球位置、虹膜缩放和眼睑每帧都在变化（整屏重绘），报告每像素纳秒数和单核每秒帧数（一只眼睛）。
+//   eye_bench [styles] [--frames N]    每个样式的合成速度
+//   eye_bench lids [--frames N]        逐像素比较眼睑阈值图与眼睑区间表
+//   eye_bench geometry [--frames N]    原始合成按运行时尺寸与按分辨率编译期特化，及固件的合成函数
+//   eye_bench polar [--frames N]       虹膜逐像素乘除换算与极坐标查找表，及查找表的重建开销
+//   eye_bench codec <compressed.bin>   压缩贴图的解码速度：整张解码，以及眼球移动时每帧逐行解码可见段
+#include "eye_host_scene.h"
+#include "eye_pack.h"
+#include "eye_reference.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+// 第f帧的渲染参数：眼球在巩膜贴图中来回扫过，虹膜缩放和眨眼按不同周期变化
+static EyeRenderParams SweepParams(const EyeHostScene& scene, int f) {
+    auto tri = [](int f, int period, uint32_t range) {
+        int t = f % (2 * period);
+        return (uint32_t)((t < period ? t : 2 * period - t) * range / period);
+    };
+    uint32_t lid = tri(f, 37, EYE_HOST_LID_CLOSED);
+    return {
+        EYE_HOST_IRIS_MIN + tri(f, 29, EYE_HOST_IRIS_MAX - EYE_HOST_IRIS_MIN),
+        tri(f, 23, scene.max_sclera_x()),
+        tri(f, 19, scene.max_sclera_y()),
+        lid,
+        lid,
+    };
+}
+
+static uint64_t checksum = 0;
+
+// 合成frames帧，返回总纳秒数；compose为空时用固件的合成函数
+template <typename F>
+static double TimeFrames(EyeHostScene& scene, EyeComposeFn compose, int frames, F params) {
+    auto render = [&](int f) {
+        if (compose) {
+            scene.RenderWith(compose, params(f));
+        } else {
+            scene.Render(params(f));
+        }
+    };
+    render(0);  // 预热缓存
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) {
+        render(f);
+        checksum += scene.frame()[f % scene.pixels()];
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void BenchStyles(EyeHostScene& scene, int frames) {
+    printf("  %-12s %10s %10s\n", "style", "ns/pixel", "frames/s");
+    for (int s = 0; s < kEyeBuiltinStyleCount; s++) {
+        scene.SetStyle(s);
+        double ns = TimeFrames(scene, nullptr, frames, [&](int f) { return SweepParams(scene, f); });
+        printf("  %-12s %10.2f %10.0f\n", kEyeBuiltinStyles[s].name,
+            ns / ((double)frames * scene.pixels()), frames * 1e9 / ns);
+    }
+}
+
+// 眼睑区间表：参考实现只替换眼睑判断（极坐标同样查表），两者的差别就是区间表的收益
+static void BenchLids(EyeHostScene& scene, int frames) {
+    const uint32_t mid_iris = (EYE_HOST_IRIS_MIN + EYE_HOST_IRIS_MAX) / 2;
+    const uint32_t cx = scene.max_sclera_x() / 2, cy = scene.max_sclera_y() / 2;
+    const struct {
+        const char* name;
+        uint32_t uT, lT;
+    } kLids[] = {
+        { "open", 0, 0 },
+        { "follow", 90, 160 },
+        { "half", 127, 127 },
+        { "closed", EYE_HOST_LID_CLOSED, EYE_HOST_LID_CLOSED },
+    };
+    EyeComposeFn per_pixel = FindEyeReference(scene.assets(), kEyeReferencePolarLut);
+    scene.SetStyle(0);
+    printf("  %-8s %18s %18s %8s\n", "lids", "per-pixel ns/px", "span table ns/px", "speedup");
+    for (auto& lids : kLids) {
+        auto params = [&](int) { return EyeRenderParams{ mid_iris, cx, cy, lids.uT, lids.lT }; };
+        double before = TimeFrames(scene, per_pixel, frames, params);
+        double after = TimeFrames(scene, nullptr, frames, params);
+        double pixels = (double)frames * scene.pixels();
+        printf("  %-8s %18.2f %18.2f %7.2fx\n", lids.name, before / pixels, after / pixels, before / after);
+    }
+    double before = TimeFrames(scene, per_pixel, frames, [&](int f) { return SweepParams(scene, f); });
+    double after = TimeFrames(scene, nullptr, frames, [&](int f) { return SweepParams(scene, f); });
+    double pixels = (double)frames * scene.pixels();
+    printf("  %-8s %18.2f %18.2f %7.2fx\n", "sweep", before / pixels, after / pixels, before / after);
+}
+
+// 按分辨率特化：同一个逐像素循环分别用运行时尺寸和编译期常量尺寸编译，再与固件的合成函数比较
+static void BenchGeometry(EyeHostScene& scene, int frames) {
+    const struct {
+        const char* name;
+        EyeComposeFn compose;
+    } kVariants[] = {
+        { "original, runtime size", FindEyeReference(scene.assets(), kEyeReferenceRuntime) },
+        { "original, compile-time size", FindEyeReference(scene.assets(), kEyeReferenceOriginal) },
+        { "firmware kernel", nullptr },
+    };
+    scene.SetStyle(0);
+    printf("  %-28s %10s %10s %8s\n", "variant", "ns/pixel", "frames/s", "speedup");
+    double baseline = 0;
+    for (auto& variant : kVariants) {
+        double ns = TimeFrames(scene, variant.compose, frames, [&](int f) { return SweepParams(scene, f); });
+        if (baseline == 0) {
+            baseline = ns;
+        }
+        printf("  %-28s %10.2f %10.0f %7.2fx\n", variant.name,
+            ns / ((double)frames * scene.pixels()), frames * 1e9 / ns, baseline / ns);
+    }
+}
+
+// 极坐标查找表：参考实现只替换虹膜像素的换算，眼睑仍逐像素判断。
+// 眼球居中、眼睑全开时虹膜占屏幕比例最大；每帧改变iScale时半径表每帧重建，是查找表最不利的情况
+static void BenchPolar(EyeHostScene& scene, int frames) {
+    const uint32_t mid_iris = (EYE_HOST_IRIS_MIN + EYE_HOST_IRIS_MAX) / 2;
+    const uint32_t cx = scene.max_sclera_x() / 2, cy = scene.max_sclera_y() / 2;
+    EyeComposeFn original = FindEyeReference(scene.assets(), kEyeReferenceOriginal);
+    EyeComposeFn lut = FindEyeReference(scene.assets(), kEyeReferencePolarLut);
+    scene.SetStyle(0);
+    const struct {
+        const char* name;
+        std::function<EyeRenderParams(int)> params;
+    } kCases[] = {
+        { "center, fixed iScale", [&](int) { return EyeRenderParams{ mid_iris, cx, cy, 0, 0 }; } },
+        { "center, iScale per frame", [&](int f) {
+            return EyeRenderParams{ EYE_HOST_IRIS_MIN + (uint32_t)f % (EYE_HOST_IRIS_MAX - EYE_HOST_IRIS_MIN), cx, cy, 0, 0 };
+        } },
+        { "sweep", [&](int f) { return SweepParams(scene, f); } },
+    };
+    printf("  %-26s %14s %14s %8s\n", "case", "mul/div us/fr", "lut us/fr", "speedup");
+    for (auto& c : kCases) {
+        double before = TimeFrames(scene, original, frames, c.params);
+        double after = TimeFrames(scene, lut, frames, c.params);
+        printf("  %-26s %14.2f %14.2f %7.2fx\n", c.name, before / frames / 1000, after / frames / 1000, before / after);
+    }
+
+    // 查找表本身的开销：极坐标表在选定数据时生成一次，半径表在iScale变化时重建
+    const EyeAssets& assets = scene.assets();
+    std::vector<uint16_t> polar(assets.iris_width * assets.iris_height);
+    int32_t rows[EYE_IRIS_RADIUS_COUNT];
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 100; i++) {
+        BuildEyePolarLut(assets, polar.data());
+        checksum += polar[i];
+    }
+    double polar_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / 100;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        BuildEyeIrisRows(assets, EYE_HOST_IRIS_MIN + i % (EYE_HOST_IRIS_MAX - EYE_HOST_IRIS_MIN), rows);
+        checksum += rows[i % EYE_IRIS_RADIUS_COUNT];
+    }
+    double rows_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / frames;
+    printf("  BuildEyePolarLut %.1f us (once per style), BuildEyeIrisRows %.2f us (per iScale change)\n",
+        polar_ns / 1000, rows_ns / 1000);
+}
+
+// 压缩贴图解码：切换样式时整张解码虹膜，合成时巩膜按可见列逐行解码（不计行缓存命中，即眼球每帧都在移动的最坏情况）
+static int BenchCodec(const char* path, int frames) {
+    std::vector<uint8_t> data;
+    if (FILE* f = fopen(path, "rb")) {
+        uint8_t chunk[65536];
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+            data.insert(data.end(), chunk, chunk + n);
+        }
+        fclose(f);
+    }
+    EyePack pack;
+    if (!EyePackOpen(data.data(), data.size(), &pack) || !EyePackCompressed(pack)) {
+        fprintf(stderr, "%s: not a valid compressed eye asset pack\n", path);
+        return 1;
+    }
+    const EyePackHeader& h = *pack.header;
+    printf("%s: %ux%u, %u styles\n", path, h.screen_width, h.screen_height, h.style_count);
+    printf("  %-12s %14s %14s %16s\n", "style", "sclera ns/px", "iris ns/px", "rows us/frame");
+    std::vector<uint16_t> out(h.sclera_width * h.sclera_height);
+    const int repeat = frames / 100 > 0 ? frames / 100 : 1;
+    for (int s = 0; s < h.style_count; s++) {
+        const uint8_t* sclera = pack.base + pack.styles[s].sclera;
+        const uint8_t* iris = pack.base + pack.styles[s].iris;
+        auto time = [&](auto&& body, int count) {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < count; i++) {
+                body(i);
+                checksum += out[i % out.size()];
+            }
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+        };
+        double sclera_ns = time([&](int) { EyeCodecDecode(sclera, h.sclera_width, h.sclera_height, out.data()); }, repeat);
+        double iris_ns = time([&](int) { EyeCodecDecode(iris, h.iris_map_width, h.iris_map_height, out.data()); }, repeat);
+        // 每帧眼球换一个位置，解码窗口内每一行覆盖可见列的段
+        double rows_ns = time([&](int f) {
+            int x = f * 7 % (h.sclera_width - h.screen_width + 1);
+            int y = f * 5 % (h.sclera_height - h.screen_height + 1);
+            uint32_t mask = EyeCodecSegmentMask(x, x + h.screen_width);
+            for (int row = 0; row < h.screen_height; row++) {
+                EyeCodecDecodeRow(sclera, h.sclera_width, y + row, mask, out.data());
+            }
+        }, frames);
+        printf("  %-12.16s %14.2f %14.2f %16.1f\n", pack.styles[s].name,
+            sclera_ns / (h.sclera_width * h.sclera_height), iris_ns / (h.iris_map_width * h.iris_map_height), rows_ns / 1000);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    int frames = 2000;
+    const char* mode = "styles";
+    const char* pack_path = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = atoi(argv[++i]);
+        } else if (argv[i][0] != '-' && strcmp(mode, "codec") == 0) {
+            pack_path = argv[i];
+        } else if (argv[i][0] != '-') {
+            mode = argv[i];
+        } else {
+            fprintf(stderr, "usage: %s [styles|lids|geometry|polar|codec <compressed.bin>] [--frames N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (strcmp(mode, "codec") == 0) {
+        if (pack_path == nullptr) {
+            fprintf(stderr, "usage: %s codec <compressed.bin> [--frames N]\n", argv[0]);
+            return 2;
+        }
+        int result = BenchCodec(pack_path, frames);
+        printf("checksum %llu\n", (unsigned long long)checksum);
+        return result;
+    }
+
+    for (int size : { 160, 240 }) {
+        const EyeAssets* assets = FindEyeAssets(size);
+        if (assets == nullptr) {
+            continue;
+        }
+        EyeHostScene scene(*assets);
+        printf("%dx%d, %d frames per case\n", size, size, frames);
+        if (strcmp(mode, "styles") == 0) {
+            BenchStyles(scene, frames);
+        } else if (strcmp(mode, "lids") == 0) {
+            BenchLids(scene, frames);
+        } else if (strcmp(mode, "geometry") == 0) {
+            BenchGeometry(scene, frames);
+        } else if (strcmp(mode, "polar") == 0) {
+            BenchPolar(scene, frames);
+        } else {
+            fprintf(stderr, "unknown mode %s\n", mode);
+            return 2;
+        }
+    }
+    // 输出校验和，防止合成结果没有被使用而被优化掉
+    printf("checksum %llu\n", (unsigned long long)checksum);
+    return 0;
+}
@@ -0,0 +1,162 @@
+// 魔眼贴图压缩的往返测试：scripts/gen_eye_pack.py编码的压缩资源包中每张贴图（巩膜、虹膜、极坐标图、眼睑阈值图）
+// 用eye_codec.h整张解码、按任意连续段逐行解码，结果必须与编译进来的原始数组逐像素相同；
+// 同时统计四种操作码都被覆盖，并检查EyeCodecValidate拒绝截断和越界的偏移表。
+//   eye_codec_test <compressed.bin>
+#include "eye_assets.h"
+#include "eye_codec.h"
+#include "eye_pack.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            failures++; \
+        } \
+    } while (0)
+
+enum Op { kOpRun, kOpLuma, kOpRaw, kOpDiff, kOpCount };
+static const char* const kOpNames[kOpCount] = { "run", "luma", "raw", "diff" };
+static uint64_t op_counts[kOpCount];
+
+// 按EyeCodecDecodeSegment的规则走一遍操作码，只计数
+static void CountOps(const uint8_t* src, int count) {
+    while (count > 0) {
+        uint8_t op = *src++;
+        if (op >= 0x80) {
+            op_counts[kOpDiff]++;
+            count--;
+        } else if (op < 0x40) {
+            op_counts[kOpRun]++;
+            count -= op + 1;
+        } else if (op < 0x60) {
+            op_counts[kOpLuma]++;
+            src++;
+            count--;
+        } else {
+            op_counts[kOpRaw]++;
+            src += 2;
+            count--;
+        }
+    }
+}
+
+// 一张压缩贴图与原始像素比较；original为8位时按低8位比较（眼睑阈值图）
+template <typename P>
+static void CheckTexture(const char* name, const uint8_t* texture, size_t available, const P* original, int width, int height) {
+    CHECK(EyeCodecValidate(texture, available, width, height), "%s: EyeCodecValidate failed", name);
+    const size_t size = EyeCodecSize(texture, height);
+
+    // 整张解码
+    std::vector<P> full(width * height);
+    if (sizeof(P) == 1) {
+        EyeCodecDecode8(texture, width, height, (uint8_t*)full.data());
+    } else {
+        EyeCodecDecode(texture, width, height, (uint16_t*)full.data());
+    }
+    size_t differ = 0;
+    for (int i = 0; i < width * height; i++) {
+        differ += full[i] != original[i];
+    }
+    CHECK(differ == 0, "%s: %zu of %d pixels differ after decoding", name, differ, width * height);
+
+    // 逐行解码每个连续的段区间，区间外的像素不能被改写
+    const int segments = EyeCodecSegments(width);
+    std::vector<uint16_t> row(width);
+    size_t row_errors = 0;
+    for (int y = 0; y < height; y++) {
+        const uint8_t* line = texture + ((const uint32_t*)texture)[y];
+        for (int s = 0; s < segments; s++) {
+            int x = s * EYE_CODEC_SEGMENT;
+            CountOps(line + ((const uint16_t*)line)[s], width - x < EYE_CODEC_SEGMENT ? width - x : EYE_CODEC_SEGMENT);
+        }
+        for (int a = 0; a < segments; a++) {
+            for (int b = a; b < segments; b++) {
+                const int begin = a * EYE_CODEC_SEGMENT;
+                const int end = (b + 1) * EYE_CODEC_SEGMENT < width ? (b + 1) * EYE_CODEC_SEGMENT : width;
+                std::fill(row.begin(), row.end(), 0xDEAD);
+                EyeCodecDecodeRow(texture, width, y, EyeCodecSegmentMask(begin, end), row.data());
+                for (int x = 0; x < width; x++) {
+                    if (x < begin || x >= end) {
+                        row_errors += row[x] != 0xDEAD;
+                    } else {
+                        // 8位的阈值图按低8位解码，与EyeCodecDecode8相同
+                        row_errors += (sizeof(P) == 1 ? (uint8_t)row[x] : row[x]) != original[y * width + x];
+                    }
+                }
+            }
+        }
+    }
+    CHECK(row_errors == 0, "%s: %zu pixels wrong in row/segment decoding", name, row_errors);
+
+    // 偏移表校验：截断、行偏移越界、段偏移越界
+    std::vector<uint8_t> copy(texture, texture + size);
+    uint32_t* rows = (uint32_t*)copy.data();
+    CHECK(!EyeCodecValidate(copy.data(), size - 1, width, height), "%s: truncated texture accepted", name);
+    rows[height / 2] = rows[height / 2 + 1] + 2;
+    CHECK(!EyeCodecValidate(copy.data(), size, width, height), "%s: decreasing row offset accepted", name);
+    memcpy(copy.data(), texture, size);
+    uint16_t* offsets = (uint16_t*)(copy.data() + rows[height - 1]);
+    offsets[segments - 1] = rows[height] - rows[height - 1];
+    CHECK(!EyeCodecValidate(copy.data(), size, width, height), "%s: segment offset past the row accepted", name);
+
+    printf("  %-28s %5dx%-4d %8zu -> %7zu bytes (%.1f%%)\n", name, width, height,
+        (size_t)width * height * sizeof(P), size, 100.0 * size / (width * height * sizeof(P)));
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <compressed pack>\n", argv[0]);
+        return 2;
+    }
+    std::vector<uint8_t> data;
+    if (FILE* f = fopen(argv[1], "rb")) {
+        uint8_t chunk[65536];
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+            data.insert(data.end(), chunk, chunk + n);
+        }
+        fclose(f);
+    }
+    EyePack pack;
+    if (!EyePackOpen(data.data(), data.size(), &pack) || !EyePackCompressed(pack)) {
+        printf("%s: not a valid compressed eye asset pack\n", argv[1]);
+        return 1;
+    }
+    const EyePackHeader& h = *pack.header;
+    const EyeAssets* builtin = FindEyeAssets(h.screen_width);
+    if (builtin == nullptr) {
+        printf("%ux%u not built in, skipped\n", h.screen_width, h.screen_height);
+        return 0;
+    }
+
+    printf("%s:\n", argv[1]);
+    auto blob = [&](uint32_t offset) { return pack.base + offset; };
+    auto left = [&](uint32_t offset) { return h.size - offset; };
+    const EyePackStyle& first = pack.styles[0];
+    CheckTexture("upper", blob(first.upper), left(first.upper), builtin->upper, h.screen_width, h.screen_height);
+    CheckTexture("lower", blob(first.lower), left(first.lower), builtin->lower, h.screen_width, h.screen_height);
+    CheckTexture("polar", blob(first.polar), left(first.polar), builtin->polar, h.iris_width, h.iris_height);
+    for (int s = 0; s < h.style_count; s++) {
+        const EyePackStyle& style = pack.styles[s];
+        char name[64];
+        snprintf(name, sizeof(name), "%.16s sclera", style.name);
+        CheckTexture(name, blob(style.sclera), left(style.sclera), builtin->sclera[style.sclera_id], h.sclera_width, h.sclera_height);
+        snprintf(name, sizeof(name), "%.16s iris", style.name);
+        CheckTexture(name, blob(style.iris), left(style.iris), builtin->iris[style.iris_id], h.iris_map_width, h.iris_map_height);
+    }
+
+    printf("  opcodes:");
+    for (int op = 0; op < kOpCount; op++) {
+        printf(" %s %llu", kOpNames[op], (unsigned long long)op_counts[op]);
+        CHECK(op_counts[op] > 0, "opcode %s never used by the real textures", kOpNames[op]);
+    }
+    printf("\n%s\n", failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,186 @@
+// 魔眼渲染的黄金帧回归测试：每种编译进来的分辨率按固定的一组状态（睁眼、眨眼、注视的四个极端位置、
+// 虹膜最小/最大缩放、每个样式）整帧合成，与golden/eye_<分辨率>.txt中记录的帧哈希比较，
+// 同时逐像素对比eye_reference.h中原始drawEye的参考合成。眼睑区间表对边缘列中0/1、254/255的抖动
+// 取了单调包络（见scripts/gen_eye_lid_spans.py），这些像素的遮挡结果允许不同，其余像素必须完全相同。
+//   eye_golden <golden目录>                  比较，有不一致时返回1
+//   eye_golden <golden目录> --update          重新生成记录（确认画面变化是预期的之后）
+//   eye_golden <golden目录> --dump <目录>     另外把每帧写成PPM图片，便于查看差异
+#include "eye_host_scene.h"
+#include "eye_reference.h"
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+struct GoldenState {
+    std::string name;
+    int style;
+    EyeRenderParams params;
+};
+
+static std::vector<GoldenState> BuildStates(const EyeHostScene& scene) {
+    const uint32_t mid_iris = (EYE_HOST_IRIS_MIN + EYE_HOST_IRIS_MAX) / 2;
+    const uint32_t cx = scene.max_sclera_x() / 2, cy = scene.max_sclera_y() / 2;
+    const uint32_t mx = scene.max_sclera_x(), my = scene.max_sclera_y();
+    // 眨眼一半时Application::frame()算出的阈值：(0 * 128 + 254 * 129) / 256
+    const uint32_t half = 254 * 129 / 256;
+
+    std::vector<GoldenState> states = {
+        { "open",         0, { mid_iris, cx, cy, 0, 0 } },
+        { "blink_half",   0, { mid_iris, cx, cy, half, half } },
+        { "blink_closed", 0, { mid_iris, cx, cy, EYE_HOST_LID_CLOSED, EYE_HOST_LID_CLOSED } },
+        { "lid_follow",   0, { mid_iris, cx, cy, 90, 250 - 90 } },
+        { "gaze_left_up",     0, { mid_iris, 0, 0, 0, 0 } },
+        { "gaze_right_up",    0, { mid_iris, mx, 0, 0, 0 } },
+        { "gaze_left_down",   0, { mid_iris, 0, my, 0, 0 } },
+        { "gaze_right_down",  0, { mid_iris, mx, my, 0, 0 } },
+        { "iris_min",     0, { EYE_HOST_IRIS_MIN, cx, cy, 0, 0 } },
+        { "iris_max",     0, { EYE_HOST_IRIS_MAX, cx, cy, 0, 0 } },
+    };
+    for (int s = 1; s < kEyeBuiltinStyleCount; s++) {
+        states.push_back({ std::string("style_") + kEyeBuiltinStyles[s].name, s, { mid_iris, cx, cy, 0, 0 } });
+    }
+    return states;
+}
+
+// 像素i在阈值附近的抖动范围内，区间表与逐像素比较的遮挡结果可以不同
+static bool LidJitter(const EyeAssets& assets, const EyeRenderParams& params, size_t i) {
+    auto near = [](int value, uint32_t threshold) {
+        int t = threshold > 255 ? 255 : (int)threshold;
+        return value - t <= 1 && t - value <= 1;
+    };
+    return near(assets.upper[i], params.uT) || near(assets.lower[i], params.lT);
+}
+
+static bool WritePpm(const std::string& path, const EyeHostScene& scene) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (f == nullptr) {
+        return false;
+    }
+    const EyeAssets& assets = scene.assets();
+    fprintf(f, "P6\n%d %d\n255\n", assets.screen_width, assets.screen_height);
+    for (size_t i = 0; i < scene.pixels(); i++) {
+        // 行缓冲中是交换过字节序的RGB565
+        uint16_t p = (scene.frame()[i] >> 8) | (scene.frame()[i] << 8);
+        uint8_t rgb[3] = {
+            (uint8_t)((p >> 11) * 255 / 31),
+            (uint8_t)(((p >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((p & 0x1F) * 255 / 31),
+        };
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+    return true;
+}
+
+static std::map<std::string, std::string> ReadGolden(const std::string& path) {
+    std::map<std::string, std::string> golden;
+    FILE* f = fopen(path.c_str(), "r");
+    if (f == nullptr) {
+        return golden;
+    }
+    char line[256], name[128], hash[64];
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] != '#' && sscanf(line, "%127s %63s", name, hash) == 2) {
+            golden[name] = hash;
+        }
+    }
+    fclose(f);
+    return golden;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <golden dir> [--update] [--dump DIR]\n", argv[0]);
+        return 2;
+    }
+    std::string golden_dir = argv[1];
+    bool update = false;
+    std::string dump_dir;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--update") == 0) {
+            update = true;
+        } else if (strcmp(argv[i], "--dump") == 0 && i + 1 < argc) {
+            dump_dir = argv[++i];
+        } else {
+            fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    int failures = 0, checked = 0;
+    size_t lid_jitter = 0;
+    for (int size : { 160, 240 }) {
+        const EyeAssets* assets = FindEyeAssets(size);
+        if (assets == nullptr) {
+            printf("%d: not built in, skipped\n", size);
+            continue;
+        }
+        EyeHostScene scene(*assets);
+        EyeComposeFn reference = FindEyeReference(*assets, kEyeReferenceOriginal);
+        std::vector<uint16_t> expected(scene.pixels());
+        std::string path = golden_dir + "/eye_" + std::to_string(size) + ".txt";
+        auto golden = ReadGolden(path);
+        FILE* out = nullptr;
+        if (update) {
+            out = fopen(path.c_str(), "w");
+            if (out == nullptr) {
+                fprintf(stderr, "cannot write %s\n", path.c_str());
+                return 2;
+            }
+            fprintf(out, "# eye_golden生成的%dx%d帧哈希（FNV-1a，交换字节序后的RGB565）\n", size, size);
+        }
+
+        for (auto& state : BuildStates(scene)) {
+            scene.SetStyle(state.style);
+            scene.RenderWith(reference, state.params);
+            expected.assign(scene.frame(), scene.frame() + scene.pixels());
+            scene.Render(state.params);
+            size_t differ = 0, jitter = 0;
+            for (size_t i = 0; i < scene.pixels(); i++) {
+                uint16_t got = scene.frame()[i], want = expected[i];
+                if (got == want) {
+                    continue;
+                }
+                if ((got == 0 || want == 0) && LidJitter(*assets, state.params, i)) {
+                    jitter++;
+                } else {
+                    differ++;
+                }
+            }
+            if (differ) {
+                printf("%d %s: %zu pixels differ from the reference compositor\n", size, state.name.c_str(), differ);
+                failures++;
+            }
+            lid_jitter += jitter;
+            char hash[32];
+            snprintf(hash, sizeof(hash), "%016llx", (unsigned long long)EyeHostHash(scene.frame(), scene.pixels()));
+            if (!dump_dir.empty()) {
+                WritePpm(dump_dir + "/eye_" + std::to_string(size) + "_" + state.name + ".ppm", scene);
+            }
+            if (update) {
+                fprintf(out, "%s %s\n", state.name.c_str(), hash);
+                continue;
+            }
+            checked++;
+            auto it = golden.find(state.name);
+            if (it == golden.end()) {
+                printf("%d %s: no golden hash in %s\n", size, state.name.c_str(), path.c_str());
+                failures++;
+            } else if (it->second != hash) {
+                printf("%d %s: hash %s, golden %s\n", size, state.name.c_str(), hash, it->second.c_str());
+                failures++;
+            }
+        }
+        if (out != nullptr) {
+            fclose(out);
+            printf("%d: wrote %s\n", size, path.c_str());
+        }
+    }
+    if (!update) {
+        printf("%d frames checked, %d mismatched, %zu pixels at lid-map jitter\n", checked, failures, lid_jitter);
+    }
+    return failures ? 1 : 0;
+}
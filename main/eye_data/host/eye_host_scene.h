@@ -0,0 +1,92 @@
+#ifndef EYE_HOST_SCENE_H
+#define EYE_HOST_SCENE_H
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "eye_assets.h"
+#include "eye_render.h"
+#include "eye_style.h"
+
+/*
+    主机测试和基准共用：按固件的方式为一种分辨率、一个样式准备查找表，整帧合成到内存中。
+    虹膜缩放、眼球位置、眼睑阈值的取值范围与Application::frame()一致。
+    */
+#define EYE_HOST_IRIS_MIN   300
+#define EYE_HOST_IRIS_MAX   700
+#define EYE_HOST_LID_CLOSED 254     // 眨眼到底时的眼睑阈值
+#define EYE_HOST_BATCH_LINES 10
+
+class EyeHostScene {
+public:
+    explicit EyeHostScene(const EyeAssets& assets)
+        : assets_(assets),
+          polar_lut_(assets.iris_width * assets.iris_height),
+          frame_(assets.screen_width * assets.screen_height) {
+        BuildEyePolarLut(assets_, polar_lut_.data());
+        tables_.polar_lut = polar_lut_.data();
+        tables_.iris_rows = iris_rows_;
+    }
+
+    const EyeAssets& assets() const { return assets_; }
+    // 资源包等非内置贴图由调用者直接设置tables中的贴图和查找表
+    EyeFrameTables& tables() { return tables_; }
+    const uint16_t* frame() const { return frame_.data(); }
+    size_t pixels() const { return frame_.size(); }
+
+    // 换上第style个编译进固件的样式（从0开始）
+    void SetStyle(int style) {
+        tables_.sclera = assets_.sclera[kEyeBuiltinStyles[style].sclera];
+        tables_.iris = assets_.iris[kEyeBuiltinStyles[style].iris];
+    }
+
+    // 与固件相同，半径表只在iScale变化时重建
+    void Render(const EyeRenderParams& params) {
+        UpdateIrisRows(params.iScale);
+        uint16_t* frames[1] = { frame_.data() };
+        EyeFrameRecorder recorder(assets_, frames);
+        EyeRenderBatches(assets_, tables_, params, 0, EyeAllBatches(assets_, EYE_HOST_BATCH_LINES),
+            EYE_HOST_BATCH_LINES, recorder);
+    }
+
+    // 用另一个合成函数（如eye_reference.h中的参考实现）按同样的批次合成整帧
+    void RenderWith(EyeComposeFn compose, const EyeRenderParams& params) {
+        UpdateIrisRows(params.iScale);
+        for (int screenY = 0; screenY < assets_.screen_height; screenY += EYE_HOST_BATCH_LINES) {
+            int lines = assets_.screen_height - screenY < EYE_HOST_BATCH_LINES ? assets_.screen_height - screenY : EYE_HOST_BATCH_LINES;
+            compose(assets_, tables_, params, screenY, lines, frame_.data() + screenY * assets_.screen_width);
+        }
+    }
+
+    // 眼球在巩膜贴图中的最大位置
+    uint32_t max_sclera_x() const { return assets_.sclera_width - assets_.screen_width; }
+    uint32_t max_sclera_y() const { return assets_.sclera_height - assets_.screen_height; }
+
+private:
+    void UpdateIrisRows(uint32_t iScale) {
+        if (iScale != iris_rows_scale_) {
+            BuildEyeIrisRows(assets_, iScale, iris_rows_);
+            iris_rows_scale_ = iScale;
+        }
+    }
+
+    const EyeAssets& assets_;
+    std::vector<uint16_t> polar_lut_;
+    int32_t iris_rows_[EYE_IRIS_RADIUS_COUNT];
+    uint32_t iris_rows_scale_ = 0;
+    EyeFrameTables tables_ = {};
+    std::vector<uint16_t> frame_;
+};
+
+// FNV-1a，用于比较整帧像素
+static inline uint64_t EyeHostHash(const uint16_t* pixels, size_t count) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (size_t i = 0; i < count; i++) {
+        hash ^= pixels[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+#endif // EYE_HOST_SCENE_H
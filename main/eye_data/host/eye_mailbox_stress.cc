@@ -0,0 +1,76 @@
+// EyeMailbox的多线程压力测试，默认用ThreadSanitizer编译（见CMakeLists.txt的EYE_TSAN）：
+// 两个线程发布注视点（每次x == y），一个线程同时发布眨眼/跟随/巩膜（三者按同一个计数的奇偶一起变化），
+// 魔眼线程不断取走。检查取出的快照中没有撕裂的字段组合，发布结束后最后一次取走得到每组字段最后发布的值。
+//   eye_mailbox_stress [每个发布线程的次数]
+#include "eye_mailbox.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+int main(int argc, char** argv) {
+    const int count = argc > 1 ? atoi(argv[1]) : 200000;
+    EyeMailbox mailbox;
+    std::atomic<bool> stop{false};
+
+    auto gaze = [&](int step) {
+        for (int i = 0; i < count; i++) {
+            EyeCommand command = {};
+            command.x = command.y = (i * step) & 0x3FF;
+            command.changed = EYE_COMMAND_GAZE;
+            mailbox.Publish(command);
+        }
+    };
+    // 最后一次发布的i为count - 1
+    auto flags = [&]() {
+        for (int i = 0; i < count; i++) {
+            EyeCommand command = {};
+            command.blink = command.track = i & 1;
+            command.sclera = (i & 1) ? 5 : 2;
+            command.changed = EYE_COMMAND_BLINK | EYE_COMMAND_TRACK | EYE_COMMAND_SCLERA;
+            mailbox.Publish(command);
+        }
+    };
+
+    long takes = 0, updates = 0, torn = 0;
+    bool flags_seen = false;
+    std::thread consumer([&] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            EyeCommand command = mailbox.Take();
+            takes++;
+            if (command.changed == 0) {
+                continue;
+            }
+            updates++;
+            if (command.x != command.y) {
+                torn++;
+            }
+            // 第一次发布之前这组字段为0，之后三者必须来自同一次发布
+            flags_seen = flags_seen || (command.changed & EYE_COMMAND_TRACK);
+            if (flags_seen && (command.blink != command.track || command.sclera != (command.track ? 5 : 2))) {
+                torn++;
+            }
+        }
+    });
+    std::thread a(gaze, 1), b(gaze, 7), c(flags);
+    a.join();
+    b.join();
+    c.join();
+    stop.store(true, std::memory_order_relaxed);
+    consumer.join();
+
+    EyeCommand last = mailbox.Take();
+    const bool last_flags = ((count - 1) & 1) != 0;
+    const bool gaze_ok = last.x == last.y &&
+        (last.x == ((count - 1) & 0x3FF) || last.x == (((count - 1) * 7) & 0x3FF));
+    const bool flags_ok = last.track == last_flags && last.blink == last_flags && last.sclera == (last_flags ? 5 : 2);
+    printf("takes %ld, updates %ld, torn %ld, final x %u y %u track %d sclera %u\n",
+        takes, updates, torn, last.x, last.y, last.track, last.sclera);
+    if (torn != 0 || !gaze_ok || !flags_ok) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("passed\n");
+    return 0;
+}
@@ -0,0 +1,246 @@
+// 魔眼资源包加载的主机测试，资源包由scripts/gen_eye_pack.py按编译进来的数据生成：
+//   eye_pack_test <raw.bin> <compressed.bin> <palette.bin>
+// 每个资源包检查：EyePackOpen和EyePackLoadAssets成功，解码后的眼睑阈值图、极坐标图以及生成的眼睑区间表、
+// 跟随表与编译进来的数据相同；每个样式的合成结果与内置样式逐像素相同（调色板资源包有损，检查PSNR）；
+// 每一次内存分配失败时都返回kEyePackLoadNoMemory且不泄漏；头部或数据块偏移损坏、文件截断时EyePackOpen拒绝。
+#include "eye_host_scene.h"
+#include "eye_pack.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            failures++; \
+        } \
+    } while (0)
+
+// 计数的分配器：fail_at为第几次分配（从0开始）返回nullptr，-1为不失败
+static int alloc_calls = 0;
+static int alloc_live = 0;
+static int fail_at = -1;
+
+static void* CountingAlloc(size_t size) {
+    if (alloc_calls++ == fail_at) {
+        return nullptr;
+    }
+    alloc_live++;
+    return malloc(size);
+}
+
+static void CountingFree(void* ptr) {
+    if (ptr != nullptr) {
+        alloc_live--;
+    }
+    free(ptr);
+}
+
+static std::vector<uint8_t> ReadFile(const char* path) {
+    std::vector<uint8_t> data;
+    FILE* f = fopen(path, "rb");
+    if (f == nullptr) {
+        return data;
+    }
+    uint8_t chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        data.insert(data.end(), chunk, chunk + n);
+    }
+    fclose(f);
+    return data;
+}
+
+// 两帧（交换字节序的RGB565）按RGB三个通道计算PSNR
+static double Psnr(const uint16_t* a, const uint16_t* b, size_t count) {
+    double sum = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint16_t p = (a[i] >> 8) | (a[i] << 8), q = (b[i] >> 8) | (b[i] << 8);
+        int dr = ((p >> 11) - (q >> 11)) * 255 / 31;
+        int dg = (((p >> 5) & 0x3F) - ((q >> 5) & 0x3F)) * 255 / 63;
+        int db = ((p & 0x1F) - (q & 0x1F)) * 255 / 31;
+        sum += dr * dr + dg * dg + db * db;
+    }
+    return sum == 0 ? INFINITY : 10 * log10(255.0 * 255.0 * 3 * count / sum);
+}
+
+static void TestCorruption(const std::vector<uint8_t>& original, const char* name) {
+    EyePack pack;
+    std::vector<uint8_t> data = original;
+    CHECK(!EyePackOpen(data.data(), data.size() - 4, &pack), "%s: truncated pack accepted", name);
+    CHECK(!EyePackOpen(data.data(), sizeof(EyePackHeader) - 1, &pack), "%s: header-only pack accepted", name);
+
+    EyePackHeader* header = (EyePackHeader*)data.data();
+    EyePackStyle* styles = (EyePackStyle*)(header + 1);
+    auto expect_reject = [&](const char* what) {
+        CHECK(!EyePackOpen(data.data(), data.size(), &pack), "%s: %s accepted", name, what);
+        data = original;
+        header = (EyePackHeader*)data.data();
+        styles = (EyePackStyle*)(header + 1);
+    };
+    header->magic ^= 1;
+    expect_reject("bad magic");
+    header->version++;
+    expect_reject("wrong version");
+    header->flags = EYE_PACK_FLAG_COMPRESSED | EYE_PACK_FLAG_PALETTE;
+    expect_reject("compressed palette flags");
+    header->style_count = 0;
+    expect_reject("empty style table");
+    styles[header->style_count - 1].sclera = header->size;
+    expect_reject("sclera offset past the end");
+    styles[0].iris += 2;
+    expect_reject("misaligned iris offset");
+    styles[header->style_count - 1].upper = styles[0].sclera;
+    expect_reject("per-style lid map");
+    styles[0].iris_id = kEyeIrisCount;
+    expect_reject("iris id out of range");
+    CHECK(EyePackOpen(data.data(), data.size(), &pack), "%s: restored pack rejected", name);
+}
+
+static void TestAllocFailures(const EyePack& pack, const char* name) {
+    alloc_calls = 0;
+    fail_at = -1;
+    EyeAssets assets = {};
+    EyePackTables tables = {};
+    if (EyePackLoadAssets(pack, CountingAlloc, CountingFree, &assets, &tables) != kEyePackLoadOk) {
+        return;
+    }
+    CountingFree(tables.decoded);
+    CountingFree(tables.lids);
+    const int calls = alloc_calls;
+    for (fail_at = 0; fail_at < calls; fail_at++) {
+        alloc_calls = 0;
+        alloc_live = 0;
+        EyeAssets untouched = {};
+        untouched.screen_width = 1;
+        EyePackTables none = {};
+        EyePackLoadResult result = EyePackLoadAssets(pack, CountingAlloc, CountingFree, &untouched, &none);
+        CHECK(result == kEyePackLoadNoMemory, "%s: allocation %d failed but load returned %d", name, fail_at, result);
+        CHECK(alloc_live == 0, "%s: allocation %d failed, %d buffers leaked", name, fail_at, alloc_live);
+        CHECK(untouched.screen_width == 1 && none.decoded == nullptr && none.lids == nullptr,
+            "%s: allocation %d failed but outputs were written", name, fail_at);
+    }
+    fail_at = -1;
+}
+
+static void TestPack(const char* path, const EyeAssets& builtin) {
+    std::vector<uint8_t> data = ReadFile(path);
+    EyePack pack;
+    if (!EyePackOpen(data.data(), data.size(), &pack)) {
+        CHECK(false, "%s: EyePackOpen failed", path);
+        return;
+    }
+    alloc_calls = 0;
+    alloc_live = 0;
+    EyeAssets assets = {};
+    EyePackTables tables = {};
+    EyePackLoadResult result = EyePackLoadAssets(pack, CountingAlloc, CountingFree, &assets, &tables);
+    CHECK(result == kEyePackLoadOk, "%s: EyePackLoadAssets returned %d", path, result);
+    if (result != kEyePackLoadOk) {
+        return;
+    }
+    CHECK(assets.compose != nullptr, "%s: no compose function", path);
+    CHECK((tables.decoded != nullptr) == EyePackCompressed(pack), "%s: decoded maps only for compressed packs", path);
+
+    // 阈值图、极坐标图和由它们生成的表
+    const size_t screen = builtin.screen_width * builtin.screen_height;
+    const size_t spans = 256 * builtin.screen_width;
+    CHECK(memcmp(assets.upper, builtin.upper, screen) == 0, "%s: upper lid map differs", path);
+    CHECK(memcmp(assets.lower, builtin.lower, screen) == 0, "%s: lower lid map differs", path);
+    CHECK(memcmp(assets.polar, builtin.polar, builtin.iris_width * builtin.iris_height * sizeof(uint16_t)) == 0,
+        "%s: polar map differs", path);
+    CHECK(memcmp(assets.upper_span, builtin.upper_span, spans) == 0, "%s: upper spans differ from lid_spans_common.h", path);
+    CHECK(memcmp(assets.lower_span, builtin.lower_span, spans) == 0, "%s: lower spans differ from lid_spans_common.h", path);
+    CHECK(memcmp(assets.lid_follow, builtin.lid_follow, EyeLidFollowRows(builtin) * EyeLidFollowColumns(builtin)) == 0,
+        "%s: lid follow table differs from lid_follow_common.h", path);
+
+    // 每个样式合成一帧，与内置样式比较
+    EyeHostScene expected(builtin), scene(assets);
+    std::vector<uint16_t> iris(assets.iris_map_width * assets.iris_map_height);
+    std::vector<uint16_t> cache_pixels(assets.screen_height * assets.sclera_width);
+    std::vector<int16_t> cache_tag(assets.screen_height);
+    std::vector<uint8_t> cache_valid(assets.screen_height);
+    EyeRowCache cache = { nullptr, assets.screen_height, cache_tag.data(), cache_valid.data(), cache_pixels.data() };
+    uint16_t sclera_lut[EYE_PALETTE_SIZE], iris_lut[EYE_PALETTE_SIZE];
+    const EyeRenderParams params = { (EYE_HOST_IRIS_MIN + EYE_HOST_IRIS_MAX) / 2,
+        scene.max_sclera_x() / 3, scene.max_sclera_y() * 2 / 3, 40, 60 };
+    double worst_psnr = INFINITY;
+    for (int s = 0; s < pack.header->style_count; s++) {
+        CHECK(s < kEyeBuiltinStyleCount && strncmp(pack.styles[s].name, kEyeBuiltinStyles[s].name, EYE_PACK_NAME_LEN) == 0,
+            "%s: style %d is not %s", path, s, s < kEyeBuiltinStyleCount ? kEyeBuiltinStyles[s].name : "built in");
+        if (s >= kEyeBuiltinStyleCount) {
+            break;
+        }
+        EyeFrameTables& t = scene.tables();
+        t.sclera = EyePackSclera(pack, s);
+        t.iris = EyePackIris(pack, s);
+        if (EyePackCompressed(pack)) {
+            EyeCodecDecode((const uint8_t*)t.iris, assets.iris_map_width, assets.iris_map_height, iris.data());
+            t.iris = iris.data();
+            for (auto& tag : cache_tag) {
+                tag = -1;
+            }
+            cache.texture = t.sclera;
+            t.sclera_cache = &cache;
+        }
+        if (EyePackPalette(pack)) {
+            BuildEyeTintedPalette(t.sclera, 0, 0, sclera_lut);
+            BuildEyeTintedPalette(t.iris, 0, 0, iris_lut);
+            t.sclera_lut = sclera_lut;
+            t.iris_lut = iris_lut;
+        }
+        scene.Render(params);
+        expected.SetStyle(s);
+        expected.Render(params);
+        if (EyePackPalette(pack)) {
+            double psnr = Psnr(scene.frame(), expected.frame(), scene.pixels());
+            worst_psnr = psnr < worst_psnr ? psnr : worst_psnr;
+            CHECK(psnr > 28, "%s: style %s PSNR %.1f dB", path, kEyeBuiltinStyles[s].name, psnr);
+        } else {
+            CHECK(memcmp(scene.frame(), expected.frame(), scene.pixels() * sizeof(uint16_t)) == 0,
+                "%s: style %s renders differently from the built-in textures", path, kEyeBuiltinStyles[s].name);
+        }
+    }
+    CountingFree(tables.decoded);
+    CountingFree(tables.lids);
+    CHECK(alloc_live == 0, "%s: %d buffers not released", path, alloc_live);
+
+    TestAllocFailures(pack, path);
+    TestCorruption(data, path);
+    printf("%s: %u styles, %zu bytes%s", path, pack.header->style_count, data.size(),
+        EyePackCompressed(pack) ? ", compressed" : (EyePackPalette(pack) ? ", palette" : ", raw"));
+    if (EyePackPalette(pack)) {
+        printf(", worst PSNR %.1f dB", worst_psnr);
+    }
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <pack.bin>...\n", argv[0]);
+        return 2;
+    }
+    for (int i = 1; i < argc; i++) {
+        std::vector<uint8_t> data = ReadFile(argv[i]);
+        EyePack pack;
+        if (!EyePackOpen(data.data(), data.size(), &pack)) {
+            CHECK(false, "%s: cannot open", argv[i]);
+            continue;
+        }
+        const EyeAssets* builtin = FindEyeAssets(pack.header->screen_width);
+        if (builtin == nullptr) {
+            printf("%s: %ux%u not built in, skipped\n", argv[i], pack.header->screen_width, pack.header->screen_height);
+            continue;
+        }
+        TestPack(argv[i], *builtin);
+    }
+    printf("%s\n", failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}
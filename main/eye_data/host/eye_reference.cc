@@ -0,0 +1,140 @@
+#include "eye_reference.h"
+
+namespace {
+
+// 运行时的尺寸，成员与编译期尺寸G的常量同名，从assets读取
+struct RuntimeGeometry {
+    int kScreenWidth, kScreenHeight;
+    int kScleraWidth, kScleraHeight;
+    int kIrisWidth, kIrisHeight;
+    int kIrisMapWidth, kIrisMapHeight;
+};
+
+template <typename G>
+G MakeGeometry(const EyeAssets&) {
+    return G();
+}
+
+template <>
+RuntimeGeometry MakeGeometry<RuntimeGeometry>(const EyeAssets& assets) {
+    return { assets.screen_width, assets.screen_height, assets.sclera_width, assets.sclera_height,
+        assets.iris_width, assets.iris_height, assets.iris_map_width, assets.iris_map_height };
+}
+
+// G为编译期尺寸时所有跨度和除数都是常量，为RuntimeGeometry时每次从内存读取
+template <typename G, EyeReferenceMode M>
+void ComposeEyeReference(const EyeAssets& assets, const EyeFrameTables& tables,
+    const EyeRenderParams& params, uint16_t screenY, uint8_t lines, uint16_t* buf) {
+    const G g = MakeGeometry<G>(assets);
+    const uint16_t* sclera = tables.sclera;
+    const uint16_t* iris = tables.iris;
+    uint32_t scleraY = params.scleraY + screenY;
+    int16_t irisY = scleraY - (g.kScleraHeight - g.kIrisHeight) / 2;
+
+    for (uint8_t line = 0; line < lines; line++, scleraY++, irisY++) {
+        uint32_t scleraX = params.scleraX;
+        int16_t irisX = scleraX - (g.kScleraWidth - g.kIrisWidth) / 2;
+        for (int screenX = 0; screenX < g.kScreenWidth; screenX++, scleraX++, irisX++) {
+            const uint32_t screenIdx = (screenY + line) * g.kScreenWidth + screenX;
+            uint16_t p;
+            if (assets.lower[screenIdx] <= params.lT || assets.upper[screenIdx] <= params.uT) {
+                p = 0;  // 被眼睑遮挡
+            } else if (irisY < 0 || irisY >= g.kIrisHeight || irisX < 0 || irisX >= g.kIrisWidth) {
+                p = sclera[scleraY * g.kScleraWidth + scleraX];
+            } else if (M != kEyeReferencePolarLut) {
+                p = assets.polar[irisY * g.kIrisWidth + irisX];
+                uint32_t d = (params.iScale * (p & 0x7F)) / 240;
+                if (d < (uint32_t)g.kIrisMapHeight) {
+                    uint16_t a = (g.kIrisMapWidth * (p >> 7)) / 512;
+                    p = iris[d * g.kIrisMapWidth + a];
+                } else {
+                    p = sclera[scleraY * g.kScleraWidth + scleraX];
+                }
+            } else {
+                uint16_t v = tables.polar_lut[irisY * g.kIrisWidth + irisX];
+                int32_t offset = tables.iris_rows[v >> EYE_POLAR_COLUMN_BITS];
+                if (offset >= 0) {
+                    p = iris[offset + (v & ((1 << EYE_POLAR_COLUMN_BITS) - 1))];
+                } else {
+                    p = sclera[scleraY * g.kScleraWidth + scleraX];
+                }
+            }
+            buf[line * g.kScreenWidth + screenX] = (p >> 8) | (p << 8);
+        }
+    }
+}
+
+template <typename G>
+EyeComposeFn FindReference(EyeReferenceMode mode) {
+    switch (mode) {
+    case kEyeReferenceOriginal:
+        return ComposeEyeReference<G, kEyeReferenceOriginal>;
+    case kEyeReferencePolarLut:
+        return ComposeEyeReference<G, kEyeReferencePolarLut>;
+    case kEyeReferenceRuntime:
+        return ComposeEyeReference<RuntimeGeometry, kEyeReferenceRuntime>;
+    }
+    return nullptr;
+}
+
+// 两种分辨率的尺寸，与eye_assets_160.cc/eye_assets_240.cc相同
+namespace eye160 {
+#include "160_160/common.h"
+struct Geometry {
+    static constexpr int kScreenWidth = SCREEN_WIDTH;
+    static constexpr int kScreenHeight = SCREEN_HEIGHT;
+    static constexpr int kScleraWidth = SCLERA_WIDTH;
+    static constexpr int kScleraHeight = SCLERA_HEIGHT;
+    static constexpr int kIrisWidth = IRIS_WIDTH;
+    static constexpr int kIrisHeight = IRIS_HEIGHT;
+    static constexpr int kIrisMapWidth = IRIS_MAP_WIDTH;
+    static constexpr int kIrisMapHeight = IRIS_MAP_HEIGHT;
+};
+}
+
+#undef IRIS_MAP_WIDTH
+#undef IRIS_MAP_HEIGHT
+#undef SCLERA_WIDTH
+#undef SCLERA_HEIGHT
+#undef SCREEN_WIDTH
+#undef SCREEN_HEIGHT
+#undef IRIS_WIDTH
+#undef IRIS_HEIGHT
+#undef SYMMETRICAL_EYELID
+
+namespace eye240 {
+#include "240_240/common.h"
+struct Geometry {
+    static constexpr int kScreenWidth = SCREEN_WIDTH;
+    static constexpr int kScreenHeight = SCREEN_HEIGHT;
+    static constexpr int kScleraWidth = SCLERA_WIDTH;
+    static constexpr int kScleraHeight = SCLERA_HEIGHT;
+    static constexpr int kIrisWidth = IRIS_WIDTH;
+    static constexpr int kIrisHeight = IRIS_HEIGHT;
+    static constexpr int kIrisMapWidth = IRIS_MAP_WIDTH;
+    static constexpr int kIrisMapHeight = IRIS_MAP_HEIGHT;
+};
+}
+
+template <typename G>
+bool Matches(const EyeAssets& assets) {
+    return assets.screen_width == G::kScreenWidth && assets.screen_height == G::kScreenHeight &&
+        assets.sclera_width == G::kScleraWidth && assets.sclera_height == G::kScleraHeight &&
+        assets.iris_width == G::kIrisWidth && assets.iris_height == G::kIrisHeight &&
+        assets.iris_map_width == G::kIrisMapWidth && assets.iris_map_height == G::kIrisMapHeight;
+}
+
+} // namespace
+
+EyeComposeFn FindEyeReference(const EyeAssets& assets, EyeReferenceMode mode) {
+    if (assets.packed_sclera || assets.palette) {
+        return nullptr;
+    }
+    if (Matches<eye160::Geometry>(assets)) {
+        return FindReference<eye160::Geometry>(mode);
+    }
+    if (Matches<eye240::Geometry>(assets)) {
+        return FindReference<eye240::Geometry>(mode);
+    }
+    return nullptr;
+}
@@ -0,0 +1,22 @@
+#ifndef EYE_REFERENCE_H
+#define EYE_REFERENCE_H
+
+#include "eye_assets.h"
+
+/*
+    逐像素的参考合成，只用于主机上的回归测试和基准，固件不编译。
+    kEyeReferenceOriginal与拆分出眼睑区间表、极坐标查找表之前的drawEye逐像素相同：
+    每个像素比较上下眼睑阈值图，虹膜内每个像素做一次乘除换算半径和虹膜贴图列。
+    其余模式只替换其中一步，用于单独测量每项优化。
+    只支持未压缩的RGB565贴图（编译进固件的数据）。
+    */
+enum EyeReferenceMode {
+    kEyeReferenceOriginal,  // 逐像素比较眼睑阈值图，逐像素换算极坐标
+    kEyeReferencePolarLut,  // 逐像素比较眼睑阈值图，极坐标用tables中的polar_lut和iris_rows
+    kEyeReferenceRuntime,   // 与kEyeReferenceOriginal相同，但尺寸在运行时从assets读取，不做编译期特化
+};
+
+// 按assets的尺寸查找参考合成函数，没有对应分辨率时返回nullptr
+EyeComposeFn FindEyeReference(const EyeAssets& assets, EyeReferenceMode mode);
+
+#endif // EYE_REFERENCE_H
@@ -0,0 +1,73 @@
+// EyeStyleManager的请求合并测试：样式请求和只换巩膜的请求写在同一个原子字中，
+// 巩膜覆盖叠加在还没取走的样式请求上，新的样式请求清掉之前的巩膜覆盖；预取的样式在下一次Commit时换上。
+//   eye_style_test
+#include "eye_style.h"
+
+#include <cstdio>
+
+static int failures = 0;
+
+static void Expect(bool condition, const char* what) {
+    if (!condition) {
+        printf("%s\n", what);
+        failures++;
+    }
+}
+
+struct Taken {
+    bool taken;
+    uint8_t style;
+    uint8_t fade_frames;
+    uint8_t sclera;
+};
+
+static Taken Take(EyeStyleManager& styles) {
+    Taken t = {};
+    t.taken = styles.Take(&t.style, &t.fade_frames, &t.sclera);
+    return t;
+}
+
+int main() {
+    EyeStyleManager styles;
+    Expect(!Take(styles).taken, "empty manager returned a request");
+
+    styles.Request(3, 4);
+    Taken t = Take(styles);
+    Expect(t.taken && t.style == 3 && t.fade_frames == 4 && t.sclera == EYE_SCLERA_OF_STYLE,
+        "style request: wrong style, fade or sclera");
+    Expect(!Take(styles).taken, "a request was taken twice");
+
+    // 只换巩膜：保持当前样式
+    styles.RequestSclera(kEyeScleraOceanGirl, 2);
+    t = Take(styles);
+    Expect(t.taken && t.style == 0 && t.fade_frames == 2 && t.sclera == kEyeScleraOceanGirl,
+        "sclera-only request: should keep the current style and carry the sclera");
+
+    // 巩膜为0（kEyeScleraDefault）也是一个有效的请求
+    styles.RequestSclera(kEyeScleraDefault, 0);
+    t = Take(styles);
+    Expect(t.taken && t.style == 0 && t.sclera == kEyeScleraDefault, "sclera 0 request was lost");
+
+    // 叠加在还没取走的样式请求上
+    styles.Request(5, 1);
+    styles.RequestSclera(kEyeScleraLufei, 1);
+    t = Take(styles);
+    Expect(t.taken && t.style == 5 && t.sclera == kEyeScleraLufei, "sclera request did not keep the pending style");
+
+    // 之后的样式请求清掉巩膜覆盖
+    styles.RequestSclera(kEyeScleraLufei, 1);
+    styles.Request(2, 1);
+    t = Take(styles);
+    Expect(t.taken && t.style == 2 && t.sclera == EYE_SCLERA_OF_STYLE, "style request did not clear the sclera override");
+
+    // 预取的样式在Commit时原样取出，只取一次
+    static const uint16_t sclera = 0, iris = 0;
+    styles.Stage({ 6, 3, &sclera, &iris, kEyeScleraWhite });
+    EyeStyleManager::Staged staged = {};
+    Expect(styles.Commit(&staged) && staged.style == 6 && staged.sclera == &sclera &&
+        staged.sclera_override == kEyeScleraWhite, "staged sclera override was not committed");
+    Expect(!styles.Commit(&staged), "a staged style was committed twice");
+
+    printf("eye_style: %d failures\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,149 @@
+// rgb565_ops的对照测试。这个目标用CONFIG_RGB565_PIE=1另外编译一份rgb565_ops.cc，
+// 三个汇编函数换成下面按rgb565_ops_esp32s3.S的约定写的C模型：检查dst/src的对齐要求，
+// 不对齐的src按16字节对齐块读取并记录读到的最后一块，确认调用方的头尾拆分和块数计算
+// 与Scalar版本逐位相同、不会越过src的末尾。汇编本身只能在目标板上用Rgb565SelfCheck对照。
+#include "rgb565_ops.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static int contract_violations = 0;
+static int pie_calls = 0;
+static const uint8_t* src_end = nullptr;     // 当前调用中src的末尾，由测试设置
+
+static uint16_t SwapPixel(uint16_t p) {
+    return (p >> 8) | (p << 8);
+}
+
+static bool Aligned16(const void* p) {
+    return ((uintptr_t)p & 15) == 0;
+}
+
+extern "C" {
+void rgb565_swap_aligned_pie(uint16_t* dst, const uint16_t* src, int blocks) {
+    pie_calls++;
+    if (!Aligned16(dst) || !Aligned16(src) || blocks < 0) {
+        contract_violations++;
+        return;
+    }
+    for (int i = 0; i < blocks * 8; i++) {
+        dst[i] = SwapPixel(src[i]);
+    }
+}
+
+void rgb565_swap_unaligned_pie(uint16_t* dst, const uint16_t* src, int pairs) {
+    pie_calls++;
+    if (!Aligned16(dst) || Aligned16(src) || pairs < 0) {
+        contract_violations++;
+        return;
+    }
+    // 与ee.ld.128.usar.ip相同：从src所在的对齐块开始读取1 + 2 * pairs块
+    const uint8_t* block = (const uint8_t*)((uintptr_t)src & ~(uintptr_t)15);
+    const uint8_t* last_block = block + 16 * (2 * pairs);
+    if (src_end != nullptr && last_block >= src_end) {
+        contract_violations++;
+    }
+    for (int i = 0; i < pairs * 16; i++) {
+        dst[i] = SwapPixel(src[i]);
+    }
+}
+
+void rgb565_fill_pie(uint16_t* dst, uint32_t value, int blocks) {
+    pie_calls++;
+    if (!Aligned16(dst) || blocks < 0 || (value >> 16) != (value & 0xFFFF)) {
+        contract_violations++;
+        return;
+    }
+    for (int i = 0; i < blocks * 8; i++) {
+        dst[i] = value;
+    }
+}
+}
+
+// 独立于Rgb565Expand的逐通道公式
+static uint16_t BlendPixel(uint16_t dst, uint16_t src, int weight) {
+    uint16_t d = SwapPixel(dst), s = SwapPixel(src);
+    int keep = RGB565_BLEND_ONE - weight;
+    int r = ((d >> 11) * weight + (s >> 11) * keep) / RGB565_BLEND_ONE;
+    int g = (((d >> 5) & 0x3F) * weight + ((s >> 5) & 0x3F) * keep) / RGB565_BLEND_ONE;
+    int b = ((d & 0x1F) * weight + (s & 0x1F) * keep) / RGB565_BLEND_ONE;
+    return SwapPixel(r << 11 | g << 5 | b);
+}
+
+int main() {
+    int failures = 0;
+
+    // 分发函数与Scalar版本逐位对照（与固件启动时的检查相同）
+    int mismatches = Rgb565SelfCheck();
+    if (mismatches) {
+        printf("self-check: %d mismatches against the scalar reference\n", mismatches);
+        failures++;
+    }
+    if (pie_calls == 0) {
+        printf("self-check: the PIE kernels were never called\n");
+        failures++;
+    }
+
+    // 不对齐的src正好在缓冲末尾结束，检查读取的最后一块
+    alignas(16) uint16_t src[96 + 8];
+    alignas(16) uint16_t dst[96 + 8];
+    for (int i = 0; i < 96 + 8; i++) {
+        src[i] = i * 0x0101 + 7;
+    }
+    for (int s = 0; s < 8; s++) {
+        for (int count = 0; s + count <= 96 + 8; count++) {
+            src_end = (const uint8_t*)(src + s + count);
+            Rgb565Swap(dst, src + s, count);
+            for (int i = 0; i < count; i++) {
+                if (dst[i] != SwapPixel(src[s + i])) {
+                    failures++;
+                    printf("swap: src offset %d, count %d, pixel %d differs\n", s, count, i);
+                    break;
+                }
+            }
+        }
+    }
+    src_end = nullptr;
+    if (contract_violations) {
+        printf("%d calls broke the alignment or read-bound contract of rgb565_ops_esp32s3.S\n", contract_violations);
+        failures++;
+    }
+
+    // Blend与逐通道公式对照：每个权重、每个通道的极值和一组伪随机像素
+    std::vector<uint16_t> a, b;
+    const uint16_t corners[] = { 0x0000, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0x8410, 0x7BEF };
+    for (uint16_t x : corners) {
+        for (uint16_t y : corners) {
+            a.push_back(SwapPixel(x));
+            b.push_back(SwapPixel(y));
+        }
+    }
+    uint32_t seed = 12345;
+    for (int i = 0; i < 4096; i++) {
+        seed = seed * 1103515245 + 12345;
+        a.push_back(seed >> 16);
+        seed = seed * 1103515245 + 12345;
+        b.push_back(seed >> 16);
+    }
+    int blend_errors = 0;
+    for (int weight = 0; weight <= RGB565_BLEND_ONE; weight++) {
+        std::vector<uint16_t> got = a;
+        Rgb565Blend(got.data(), b.data(), got.size(), weight);
+        for (size_t i = 0; i < got.size(); i++) {
+            if (got[i] != BlendPixel(a[i], b[i], weight)) {
+                if (blend_errors++ < 5) {
+                    printf("blend: weight %d, %04x over %04x = %04x, want %04x\n",
+                        weight, b[i], a[i], got[i], BlendPixel(a[i], b[i], weight));
+                }
+            }
+        }
+    }
+    if (blend_errors) {
+        printf("blend: %d pixels differ from the per-channel formula\n", blend_errors);
+        failures++;
+    }
+
+    printf("rgb565_ops: %d PIE kernel calls, %d failures\n", pie_calls, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,193 @@
+#include "sdkconfig.h"
+#include "rgb565_ops.h"
+
+#include <string.h>
+
+#if CONFIG_RGB565_PIE
+// rgb565_ops_esp32s3.S，dst都必须按16字节对齐
+extern "C" {
+void rgb565_swap_aligned_pie(uint16_t* dst, const uint16_t* src, int blocks);     // src也按16字节对齐，每块8个像素
+void rgb565_swap_unaligned_pie(uint16_t* dst, const uint16_t* src, int pairs);    // src不对齐，每次16个像素
+void rgb565_fill_pie(uint16_t* dst, uint32_t value, int blocks);
+}
+
+// 短于此长度时对齐头尾的开销超过向量化的收益
+#define RGB565_PIE_MIN_COUNT 32
+
+// Rgb565SelfCheck发现与C实现不一致时清除，之后全部使用C实现
+static bool rgb565_pie_enabled = true;
+
+// dst对齐到16字节之前需要用C处理的像素数
+static inline int Rgb565AlignHead(const uint16_t* dst) {
+    return ((16 - ((uintptr_t)dst & 15)) & 15) / sizeof(uint16_t);
+}
+#endif
+
+void Rgb565SwapScalar(uint16_t* dst, const uint16_t* src, int count) {
+    for (int i = 0; i < count; i++) {
+        uint16_t p = src[i];
+        dst[i] = (p >> 8) | (p << 8);
+    }
+}
+
+void Rgb565FillScalar(uint16_t* dst, uint16_t value, int count) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = value;
+    }
+}
+
+void Rgb565GatherScalar(uint16_t* dst, const uint16_t* lut, const uint8_t* index, int count) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = lut[index[i]];
+    }
+}
+
+// 两个像素换回RGB565后把三个通道拉开到32位的不同位置（G在高16位），通道之间留出的空位放得下乘以权重后的进位
+static inline uint32_t Rgb565Expand(uint16_t p) {
+    uint32_t v = (uint16_t)(p >> 8 | p << 8);
+    return (v | v << 16) & 0x07E0F81F;
+}
+
+void Rgb565BlendScalar(uint16_t* dst, const uint16_t* src, int count, int weight) {
+    const uint32_t keep = RGB565_BLEND_ONE - weight;
+    for (int i = 0; i < count; i++) {
+        if (dst[i] == src[i]) {
+            continue;   // 眼睑遮挡的黑色和两边相同的部分
+        }
+        uint32_t v = ((Rgb565Expand(dst[i]) * weight + Rgb565Expand(src[i]) * keep) / RGB565_BLEND_ONE) & 0x07E0F81F;
+        uint16_t p = v | v >> 16;
+        dst[i] = p >> 8 | p << 8;
+    }
+}
+
+void Rgb565Swap(uint16_t* dst, const uint16_t* src, int count) {
+#if CONFIG_RGB565_PIE
+    if (rgb565_pie_enabled && count >= RGB565_PIE_MIN_COUNT) {
+        int head = Rgb565AlignHead(dst);
+        Rgb565SwapScalar(dst, src, head);
+        dst += head;
+        src += head;
+        count -= head;
+        // 不对齐的src按对齐块读取再拼接，只读到最后一个像素所在的块，不会越过src的末尾
+        int done;
+        if (((uintptr_t)src & 15) == 0) {
+            done = count & ~7;
+            rgb565_swap_aligned_pie(dst, src, done / 8);
+        } else {
+            done = count & ~15;
+            rgb565_swap_unaligned_pie(dst, src, done / 16);
+        }
+        dst += done;
+        src += done;
+        count -= done;
+    }
+#endif
+    Rgb565SwapScalar(dst, src, count);
+}
+
+void Rgb565Fill(uint16_t* dst, uint16_t value, int count) {
+#if CONFIG_RGB565_PIE
+    if (rgb565_pie_enabled && count >= RGB565_PIE_MIN_COUNT) {
+        int head = Rgb565AlignHead(dst);
+        Rgb565FillScalar(dst, value, head);
+        dst += head;
+        count -= head;
+        int done = count & ~7;
+        rgb565_fill_pie(dst, (uint32_t)value << 16 | value, done / 8);
+        dst += done;
+        count -= done;
+    }
+#endif
+    Rgb565FillScalar(dst, value, count);
+}
+
+// PIE没有按索引读取的指令，这里只把两个查表结果合成一次32位写入
+void Rgb565Gather(uint16_t* dst, const uint16_t* lut, const uint8_t* index, int count) {
+    if (count > 0 && ((uintptr_t)dst & 2)) {
+        *dst++ = lut[*index++];
+        count--;
+    }
+    // dst此时按4字节对齐，memcpy编译为一次32位写入，不经过uint32_t指针访问uint16_t缓冲
+    for (int i = 0; i + 1 < count; i += 2) {
+        uint32_t pair = lut[index[i]] | (uint32_t)lut[index[i + 1]] << 16;
+        memcpy(dst + i, &pair, sizeof(pair));
+    }
+    if (count & 1) {
+        dst[count - 1] = lut[index[count - 1]];
+    }
+}
+
+// PIE只有8/16位通道的乘法，通道拉开后的混合需要32位乘积，这里使用C实现
+void Rgb565Blend(uint16_t* dst, const uint16_t* src, int count, int weight) {
+    Rgb565BlendScalar(dst, src, count, weight);
+}
+
+// 覆盖dst和src相对16字节的每种偏移、原地操作，以及从0到超过两个向量块之后的每个长度
+#define RGB565_CHECK_COUNT 80
+#define RGB565_CHECK_SLACK 8
+
+int Rgb565SelfCheck() {
+#if CONFIG_RGB565_PIE
+    rgb565_pie_enabled = true;
+#endif
+    alignas(16) uint16_t src[RGB565_CHECK_COUNT + RGB565_CHECK_SLACK];
+    alignas(16) uint16_t got[RGB565_CHECK_COUNT + RGB565_CHECK_SLACK];
+    alignas(16) uint16_t want[RGB565_CHECK_COUNT + RGB565_CHECK_SLACK];
+    uint16_t lut[256];
+    uint8_t index[RGB565_CHECK_COUNT];
+    uint32_t seed = 0x2545F491;
+    auto next = [&seed]() {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed;
+    };
+    for (auto& p : src) {
+        p = next();
+    }
+    for (auto& p : lut) {
+        p = next();
+    }
+    for (auto& i : index) {
+        i = next();
+    }
+
+    int mismatches = 0;
+    auto compare = [&]() {
+        if (memcmp(got, want, sizeof(got)) != 0) {
+            mismatches++;
+        }
+    };
+    for (int d = 0; d < RGB565_CHECK_SLACK; d++) {
+        for (int count = 0; count <= RGB565_CHECK_COUNT; count++) {
+            for (int s = 0; s < RGB565_CHECK_SLACK; s++) {
+                memset(got, 0x5A, sizeof(got));
+                memset(want, 0x5A, sizeof(want));
+                Rgb565Swap(got + d, src + s, count);
+                Rgb565SwapScalar(want + d, src + s, count);
+                compare();
+            }
+            memcpy(got, src, sizeof(got));
+            memcpy(want, src, sizeof(want));
+            Rgb565Swap(got + d, got + d, count);
+            Rgb565SwapScalar(want + d, want + d, count);
+            compare();
+
+            memset(got, 0x5A, sizeof(got));
+            memset(want, 0x5A, sizeof(want));
+            Rgb565Fill(got + d, src[count], count);
+            Rgb565FillScalar(want + d, src[count], count);
+            compare();
+
+            memset(got, 0x5A, sizeof(got));
+            memset(want, 0x5A, sizeof(want));
+            Rgb565Gather(got + d, lut, index, count);
+            Rgb565GatherScalar(want + d, lut, index, count);
+            compare();
+        }
+    }
+#if CONFIG_RGB565_PIE
+    rgb565_pie_enabled = mismatches == 0;
+#endif
+    return mismatches;
+}
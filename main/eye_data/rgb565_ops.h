@@ -0,0 +1,35 @@
+#ifndef RGB565_OPS_H
+#define RGB565_OPS_H
+
+#include <stdint.h>
+
+/*
+    行缓冲的RGB565像素操作，魔眼合成和LVGL刷新共用。
+    开启CONFIG_RGB565_PIE时（ESP32-S3）字节序交换和填充的主体用PIE 128位向量指令，一次8个像素，
+    不足16字节对齐的头尾仍用C处理；其他平台（包括主机构建）全部使用带Scalar后缀的C实现。
+    两种实现的结果逐位相同，Scalar版本始终可用，便于在主机上对照。
+    */
+
+// 交换字节序：小端贴图和LVGL的像素转换成屏幕的大端顺序，或反过来。dst可以等于src，但不能部分重叠
+void Rgb565Swap(uint16_t* dst, const uint16_t* src, int count);
+void Rgb565SwapScalar(uint16_t* dst, const uint16_t* src, int count);
+
+// 用同一个值填充，value按dst中的字节序给出
+void Rgb565Fill(uint16_t* dst, uint16_t value, int count);
+void Rgb565FillScalar(uint16_t* dst, uint16_t value, int count);
+
+// 调色板贴图一行：dst[i] = lut[index[i]]，lut中是已交换字节序的颜色
+void Rgb565Gather(uint16_t* dst, const uint16_t* lut, const uint8_t* index, int count);
+void Rgb565GatherScalar(uint16_t* dst, const uint16_t* lut, const uint8_t* index, int count);
+
+// 把src按(RGB565_BLEND_ONE - weight)的比例混进dst，weight为0~RGB565_BLEND_ONE，两者都是已交换字节序的RGB565；
+// 每个通道 (dst * weight + src * (RGB565_BLEND_ONE - weight)) / RGB565_BLEND_ONE，向下取整
+#define RGB565_BLEND_ONE 32
+void Rgb565Blend(uint16_t* dst, const uint16_t* src, int count, int weight);
+void Rgb565BlendScalar(uint16_t* dst, const uint16_t* src, int count, int weight);
+
+// 在dst/src的每种对齐、原地操作和0~80的每个长度下，把Rgb565Swap/Fill/Gather与Scalar版本逐位对照，
+// 返回不一致的用例数。开启CONFIG_RGB565_PIE时启动时调用一次，有不一致时之后全部改用C实现
+int Rgb565SelfCheck();
+
+#endif // RGB565_OPS_H
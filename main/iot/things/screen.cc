@@ -2,6 +2,7 @@
 #include "board.h"
 #include "display/lcd_display.h"
 #include "settings.h"
+#include "application.h"
 
 #include <esp_log.h>
 #include <string>
@@ -26,6 +27,12 @@ public:
             return backlight ? backlight->brightness() : 100;
         });
 
+#if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824
+        properties_.AddStringProperty("eye_style", "Current style of the animated eyes", [this]() -> std::string {
+            return Application::GetInstance().GetEyeStyleName();
+        });
+#endif
+
         // 定义设备可以被远程执行的指令
         methods_.AddMethod("set_theme", "Set the screen theme", ParameterList({
             Parameter("theme_name", "Valid string values are 'light' and 'dark'", kValueTypeString, true)
@@ -46,6 +53,18 @@ public:
                 backlight->SetBrightness(brightness, true);
             }
         });
+#if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824
+
+        std::string eye_styles;
+        for (const auto& name : Application::GetInstance().GetEyeStyleNames()) {
+            eye_styles += (eye_styles.empty() ? "'" : ", '") + name + "'";
+        }
+        methods_.AddMethod("set_eye_style", "Set the style of the animated eyes", ParameterList({
+            Parameter("style_name", "Valid string values are " + eye_styles, kValueTypeString, true)
+        }), [this](const ParameterList& parameters) {
+            Application::GetInstance().SetEyeStyle(parameters["style_name"].string());
+        });
+#endif
     }
 };
 
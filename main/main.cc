@@ -7,6 +7,7 @@
 
 #include "application.h"
 #include "system_info.h"
+#include "rgb565_ops.h"
 
 #define TAG "main"
 
@@ -24,6 +25,14 @@ extern "C" void app_main(void)
     }
     ESP_ERROR_CHECK(ret);
 
+#if CONFIG_RGB565_PIE
+    // PIE实现与C实现逐位对照，不一致时rgb565_ops之后只用C实现
+    int mismatches = Rgb565SelfCheck();
+    if (mismatches != 0) {
+        ESP_LOGE(TAG, "RGB565 PIE self-check failed (%d mismatches), falling back to C", mismatches);
+    }
+#endif
+
     // Launch the application
     Application::GetInstance().Start();
 }
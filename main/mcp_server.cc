@@ -83,6 +83,21 @@ void McpServer::AddCommonTools() {
             });
     }
 
+#if CONFIG_USE_EYE_STYLE_ES8311 || CONFIG_USE_EYE_STYLE_VB6824
+    std::string eye_styles;
+    for (const auto& name : Application::GetInstance().GetEyeStyleNames()) {
+        eye_styles += (eye_styles.empty() ? "`" : ", `") + name + "`";
+    }
+    AddTool("self.screen.set_eye_style",
+        "Change the style (iris and sclera textures) of the animated eyes on the screen. Valid styles: " + eye_styles + ".",
+        PropertyList({
+            Property("style", kPropertyTypeString)
+        }),
+        [](const PropertyList& properties) -> ReturnValue {
+            return Application::GetInstance().SetEyeStyle(properties["style"].value<std::string>());
+        });
+#endif
+
     auto camera = board.GetCamera();
     if (camera) {
         AddTool("self.camera.take_photo",
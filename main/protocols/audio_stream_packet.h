@@ -0,0 +1,15 @@
+#ifndef AUDIO_STREAM_PACKET_H
+#define AUDIO_STREAM_PACKET_H
+
+#include <cstdint>
+#include <vector>
+
+struct AudioStreamPacket {
+    int sample_rate = 0;
+    int frame_duration = 0;
+    uint32_t timestamp = 0;
+    uint32_t sequence = 0;      // 传输层的包序号（MQTT UDP），没有序号的传输为0，由抖动缓冲按到达顺序编号
+    std::vector<uint8_t> payload;
+};
+
+#endif // AUDIO_STREAM_PACKET_H
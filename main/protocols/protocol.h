@@ -7,12 +7,7 @@
 #include <chrono>
 #include <vector>
 
-struct AudioStreamPacket {
-    int sample_rate = 0;
-    int frame_duration = 0;
-    uint32_t timestamp = 0;
-    std::vector<uint8_t> payload;
-};
+#include "audio_stream_packet.h"
 
 struct BinaryProtocol2 {
     uint16_t version;
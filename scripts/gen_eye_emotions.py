@@ -0,0 +1,196 @@
+#! /usr/bin/env python3
+"""
+生成魔眼表情关键帧表 main/eye_data/eye_emotions_table.h，格式见 main/eye_data/eye_timeline.h
+
+每个表情是一串关键帧 (时长ms, x, y, 虹膜, 上眼睑下限, 下眼睑下限, 曲线, 事件)：
+    x/y         注视点 0~1023
+    虹膜        虹膜缩放（IRIS_MIN~IRIS_MAX），0为沿用自动的瞳孔变化
+    眼睑下限    上/下眼睑阈值的下限，越大眼睛越闭合，0为不干预
+    曲线        linear / ease / step
+    事件        blink（双眼眨眼）/ wink（最后一只眼睛眨眼），进入该段时触发
+第一段从切换表情时的当前姿态过渡过来；loop为播完后回到的关键帧编号，None为停在最后一帧。
+表情名通过带种子的FNV-1a哈希直接落到各自的槽（完美哈希），种子在生成时搜索。
+
+用法: python scripts/gen_eye_emotions.py [--stats]
+"""
+import os
+import struct
+import sys
+
+# 切换到项目根目录
+os.chdir(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+OUTPUT = "main/eye_data/eye_emotions_table.h"
+
+MAGIC = 0x4D455945  # "EYEM"
+VERSION = 1
+NAME_LEN = 12
+NO_LOOP = 0xFF
+
+FLAG_BLINK = 1 << 0
+FLAG_TRACK = 1 << 1
+
+CURVES = {"linear": 0, "ease": 1, "step": 2}
+EVENTS = {"blink": 1 << 0, "wink": 1 << 1}
+
+RED = 0xF800
+BLUE = 0x041F
+PINK = 0xF8B2
+
+
+def key(ms, x, y, iris=0, upper=0, lower=0, curve="ease", events=()):
+    return (ms, x, y, iris, upper, lower, curve, events)
+
+
+def emotion(name, keys, loop=None, blink=True, track=True, tint=0, strength=0):
+    return {"name": name, "keys": keys, "loop": loop, "blink": blink, "track": track,
+            "tint": tint, "strength": strength}
+
+
+# 注视点沿用原先LcdDisplay::SetEmotion中每个表情的目标位置
+EMOTIONS = [
+    emotion("neutral", [key(200, 505, 805)]),                                   # 😶
+    emotion("happy", [key(200, 520, 1005, upper=60)]),                          # 🙂
+    emotion("laughing", [                                                       # 😆 眯眼上下颤动
+        key(150, 500, 1015, upper=150, lower=220),
+        key(180, 500, 985, upper=170, lower=230),
+        key(180, 500, 1015, upper=150, lower=220),
+    ], loop=1),
+    emotion("funny", [key(200, 520, 25, upper=80)]),                            # 😂
+    emotion("sad", [key(400, 265, 335, iris=380, upper=120)]),                  # 😔
+    emotion("angry", [key(120, 700, 510, iris=340, upper=140, curve="linear")],
+            tint=RED, strength=112),                                            # 😠
+    emotion("crying", [                                                         # 😭
+        key(300, 514, 100, iris=360, upper=110, events=("blink",)),
+        key(600, 514, 100, iris=360, upper=110),
+    ], tint=BLUE, strength=96),
+    emotion("loving", [                                                         # 😍 瞳孔一张一缩
+        key(250, 510, 540, iris=640),
+        key(700, 510, 540, iris=560),
+        key(700, 510, 540, iris=660),
+    ], loop=1, tint=PINK, strength=64),
+    emotion("embarrassed", [key(200, 1000, 510, upper=70)]),                    # 😳
+    emotion("surprised", [key(90, 150, 445, iris=320, curve="linear")], track=False),     # 😯
+    emotion("shocked", [                                                        # 😱 先瞪大再定住
+        key(0, 985, 615, iris=300, curve="step"),
+        key(400, 985, 615, iris=330),
+    ], track=False),
+    emotion("thinking", [                                                       # 🤔 在左上方来回找
+        key(300, 65, 670),
+        key(900, 120, 760),
+        key(900, 65, 640),
+    ], loop=1),
+    emotion("winking", [key(150, 510, 520, events=("wink",))], blink=False),    # 😉
+    emotion("cool", [key(300, 510, 510, upper=90)]),                            # 😎
+    emotion("relaxed", [key(500, 510, 490, upper=120)]),                        # 😌
+    emotion("delicious", [key(300, 510, 490, iris=600, upper=100)]),            # 🤤
+    emotion("kissy", [key(200, 1015, 510, upper=80, events=("blink",))]),       # 😘
+    emotion("confident", [key(250, 890, 650, upper=110)]),                      # 😏
+    emotion("sleepy", [                                                         # 😴 眼皮慢慢垂下又撑开
+        key(600, 535, 605, upper=150),
+        key(1500, 535, 640, upper=200, lower=120),
+        key(400, 535, 605, upper=150),
+        key(1200, 535, 605, upper=150, curve="step"),
+    ], loop=1),
+    emotion("silly", [                                                          # 😜 左右乱瞟
+        key(150, 515, 750),
+        key(250, 300, 750, curve="linear"),
+        key(250, 730, 750, curve="linear"),
+    ], loop=1),
+    emotion("confused", [                                                       # 🙄 翻白眼后绕一圈
+        key(300, 1020, 1020),
+        key(600, 1020, 512),
+        key(600, 512, 1020),
+        key(600, 1020, 1020),
+    ], loop=1),
+]
+
+
+def fnv1a(name, seed):
+    h = seed
+    for c in name.encode():
+        h ^= c
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h ^ (h >> 16)
+
+
+def perfect_hash(names):
+    """返回 (seed, slot_count, slots)，从不少于表情数的最小2的幂开始尝试，找不到时加倍"""
+    slot_count = 1
+    while slot_count < len(names):
+        slot_count *= 2
+    while slot_count <= 128:
+        for seed in range(2166136261, 2166136261 + 100000):
+            slots = [NO_LOOP] * slot_count
+            for i, name in enumerate(names):
+                s = fnv1a(name, seed) & (slot_count - 1)
+                if slots[s] != NO_LOOP:
+                    break
+                slots[s] = i
+            else:
+                return seed & 0xFFFFFFFF, slot_count, slots
+        slot_count *= 2
+    raise ValueError("no perfect hash seed found")
+
+
+def build(emotions):
+    names = [e["name"] for e in emotions]
+    for name in names:
+        if len(name.encode()) > NAME_LEN:
+            raise ValueError(f"emotion name too long: {name}")
+    if len(set(names)) != len(names) or len(names) >= NO_LOOP:
+        raise ValueError("emotion names must be unique and fewer than 255")
+
+    seed, slot_count, slots = perfect_hash(names)
+    records = b""
+    keyframes = b""
+    first = 0
+    for e in emotions:
+        keys = e["keys"]
+        loop = NO_LOOP if e["loop"] is None else e["loop"]
+        if not keys or len(keys) > 255 or (loop != NO_LOOP and loop >= len(keys)):
+            raise ValueError(f"bad keyframes for {e['name']}")
+        flags = (FLAG_BLINK if e["blink"] else 0) | (FLAG_TRACK if e["track"] else 0)
+        records += struct.pack("<12sHBBHBB", e["name"].encode(), first, len(keys), loop,
+                               e["tint"], e["strength"], flags)
+        for ms, x, y, iris, upper, lower, curve, events in keys:
+            mask = 0
+            for ev in events:
+                mask |= EVENTS[ev]
+            keyframes += struct.pack("<HHHHBBBB", ms, x, y, iris, upper, lower, CURVES[curve], mask)
+        first += len(keys)
+
+    header = struct.pack("<IHBBIHH", MAGIC, VERSION, len(emotions), slot_count, seed, first, 0)
+    slot_bytes = bytes(slots)
+    slot_bytes += b"\0" * (-len(slot_bytes) % 4)
+    return header + slot_bytes + records + keyframes, seed, slot_count, first
+
+
+def write_header(data):
+    lines = [
+        "// 由 scripts/gen_eye_emotions.py 生成，请勿手动修改",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        f"alignas(4) static const uint8_t kEyeEmotionTable[{len(data)}] = {{",
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    with open(OUTPUT, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def main():
+    data, seed, slot_count, keyframe_count = build(EMOTIONS)
+    write_header(data)
+    print(f"{OUTPUT}: {len(EMOTIONS)} emotions, {keyframe_count} keyframes, {len(data)} bytes")
+    if "--stats" in sys.argv[1:]:
+        print(f"seed 0x{seed:08X}, {slot_count} slots")
+        for e in EMOTIONS:
+            print(f"  {e['name']:<12} slot {fnv1a(e['name'], seed) & (slot_count - 1):3d}  {len(e['keys'])} keys")
+
+
+if __name__ == "__main__":
+    main()
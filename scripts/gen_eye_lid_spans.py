@@ -0,0 +1,164 @@
+#! /usr/bin/env python3
+"""
+根据 eye_data/<分辨率>/upper_lower_common.h 中的眼睑阈值图生成眼睑区间表 lid_spans_common.h
+和上眼睑跟随表 lid_follow_common.h
+
+眼睑阈值图每一列自上而下单调：上眼睑的值逐渐变大，下眼睑的值逐渐变小，
+因此给定阈值T时，每一列被眼睑遮挡的部分是列顶和列底的两段连续区间。
+生成的表按 [阈值][列] 排列，渲染时用 upper_span[uT] / lower_span[lT] 直接得到整行列区间：
+    upper_span[T][x]  第x列第一个不被上眼睑遮挡的行
+    lower_span[T][x]  第x列最后一个不被下眼睑遮挡的行 + 1
+少数边缘列存在 0/1、254/255 的微小抖动，取不遮挡可见像素的单调包络。
+上眼睑跟随表 lid_follow[y][x / 3] 是眼球位于巩膜贴图(x, y)时，在瞳孔稍上方左右对称两点取样得到的
+上眼睑阈值，开启眼睑跟踪时每帧查一次表。
+
+用法: python scripts/gen_eye_lid_spans.py [main/eye_data/160_160 main/eye_data/240_240 ...]
+"""
+import os
+import re
+import sys
+
+# 切换到项目根目录
+os.chdir(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+DEFAULT_DIRS = ["main/eye_data/160_160", "main/eye_data/240_240"]
+FOLLOW_STEP = 3  # EYE_LID_FOLLOW_STEP
+
+
+def read_define(text, name):
+    m = re.search(r"#define\s+" + name + r"\s+(\d+)", text)
+    if not m:
+        raise ValueError(f"{name} not found")
+    return int(m.group(1))
+
+
+def read_array(text, name):
+    m = re.search(r"const uint8_t " + name + r"\[[^\]]*\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not m:
+        raise ValueError(f"{name} not found")
+    return [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", m.group(1))]
+
+
+def upper_spans(lid, width, height):
+    table = []
+    for t in range(256):
+        row = []
+        for x in range(width):
+            y = 0
+            while y < height and lid[y * width + x] <= t:
+                y += 1
+            row.append(y)
+        table.append(row)
+    return table
+
+
+def lower_spans(lid, width, height):
+    table = []
+    for t in range(256):
+        row = []
+        for x in range(width):
+            y = height
+            while y > 0 and lid[(y - 1) * width + x] <= t:
+                y -= 1
+            row.append(y)
+        table.append(row)
+    return table
+
+
+def lid_follow(upper, width, height, sclera_width, sclera_height, iris_height):
+    """上眼睑跟随表，与 BuildEyeLidFollow() 一致：[sclera_height - height + 1][(sclera_width - width) // 3 + 1]"""
+    table = []
+    for y in range(sclera_height - height + 1):
+        sample_y = min(sclera_height // 2 - (y + iris_height // 6), height - 1)
+        row = []
+        for c in range((sclera_width - width) // FOLLOW_STEP + 1):
+            sample_x = min(max(sclera_width // 2 - c, 0), width - 1)
+            n = 0
+            if sample_y >= 0:
+                # 与固件原先的uint8_t运算相同，按8位截断
+                n = (upper[sample_y * width + sample_x] + upper[sample_y * width + width - 1 - sample_x] // 2) & 0xFF
+            row.append(n)
+        table.append(row)
+    return table
+
+
+def format_table(name, table, comment, rows="256", columns="SCREEN_WIDTH"):
+    lines = [f"// {comment}", f"const uint8_t {name}[{rows}][{columns}] = {{"]
+    for t, row in enumerate(table):
+        lines.append(f"  {{ // {t}")
+        for i in range(0, len(row), 12):
+            lines.append("    " + " ".join(f"0x{v:02X}," for v in row[i:i + 12]))
+        lines.append("  },")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def generate(eye_dir):
+    common = open(os.path.join(eye_dir, "common.h"), encoding="utf-8").read()
+    width = read_define(common, "SCREEN_WIDTH")
+    height = read_define(common, "SCREEN_HEIGHT")
+    if height > 255:
+        raise ValueError("row index must fit in uint8_t")
+
+    source = open(os.path.join(eye_dir, "upper_lower_common.h"), encoding="utf-8").read()
+    symmetrical, asymmetrical = source.split("#else", 1)
+
+    out = ["// 由 scripts/gen_eye_lid_spans.py 根据 upper_lower_common.h 生成，请勿手动修改",
+           "#pragma once",
+           '#include "common.h"',
+           "",
+           "#ifdef SYMMETRICAL_EYELID",
+           ""]
+    for part in (symmetrical, asymmetrical):
+        upper = read_array(part, "upper_default")
+        lower = read_array(part, "lower_default")
+        out.append(format_table("upper_span_default", upper_spans(upper, width, height),
+                                "阈值为T时每一列第一个不被上眼睑遮挡的行"))
+        out.append("")
+        out.append(format_table("lower_span_default", lower_spans(lower, width, height),
+                                "阈值为T时每一列最后一个不被下眼睑遮挡的行 + 1"))
+        out.append("")
+        if part is symmetrical:
+            out.append("#else")
+            out.append("")
+    out.append("#endif // SYMMETRICAL_EYELID")
+    out.append("")
+
+    path = os.path.join(eye_dir, "lid_spans_common.h")
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(out))
+    print(f"{path}: {width}x{height}")
+
+    sclera_width = read_define(common, "SCLERA_WIDTH")
+    sclera_height = read_define(common, "SCLERA_HEIGHT")
+    iris_height = read_define(common, "IRIS_HEIGHT")
+    rows = sclera_height - height + 1
+    columns = (sclera_width - width) // FOLLOW_STEP + 1
+    out = ["// 由 scripts/gen_eye_lid_spans.py 根据 upper_lower_common.h 生成，请勿手动修改",
+           "#pragma once",
+           '#include "common.h"',
+           "",
+           "#ifdef SYMMETRICAL_EYELID",
+           ""]
+    for part in (symmetrical, asymmetrical):
+        upper = read_array(part, "upper_default")
+        out.append(format_table("lid_follow_default",
+                                lid_follow(upper, width, height, sclera_width, sclera_height, iris_height),
+                                f"眼球在巩膜贴图的(x, y)处时上眼睑跟随的阈值，按[y][x / {FOLLOW_STEP}]索引",
+                                rows, columns))
+        out.append("")
+        if part is symmetrical:
+            out.append("#else")
+            out.append("")
+    out.append("#endif // SYMMETRICAL_EYELID")
+    out.append("")
+
+    path = os.path.join(eye_dir, "lid_follow_common.h")
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(out))
+    print(f"{path}: {rows}x{columns}")
+
+
+if __name__ == "__main__":
+    for d in (sys.argv[1:] or DEFAULT_DIRS):
+        generate(d)
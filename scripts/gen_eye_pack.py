@@ -0,0 +1,379 @@
+#! /usr/bin/env python3
+"""
+把 eye_data/<分辨率>/ 下的魔眼贴图打包成可直接 mmap 的资源包，烧录到 eye_assets 分区
+
+资源包格式（小端，所有数据块按4字节对齐，偏移量都从资源包开头算起）：
+    EyePackHeader   magic "EYEP", version, style_count, size, 8个尺寸字段, flags
+    EyePackStyle[]  每种样式一条：name[16], sclera/iris/polar/upper/lower 偏移, sclera_id, iris_id
+    数据块          默认按 main/eye_data/eye_codec.h 的格式逐行压缩（flags = 1），--raw 时按原数组的值存储；
+                    --palette 时巩膜和虹膜量化为调色板贴图（flags = 2）：256项已交换字节序的RGB565调色板，
+                    之后每像素1字节索引，其余数据块按原数组存储；同一份数据只存一次
+格式定义见 main/eye_data/eye_pack.h 和 eye_codec.h，两边修改时需保持一致。
+
+用法:
+    python scripts/gen_eye_pack.py main/eye_data/160_160 -o build/eye_assets.bin
+    python scripts/gen_eye_pack.py main/eye_data/160_160 --check build/eye_assets.bin
+    python scripts/gen_eye_pack.py main/eye_data/160_160 --palette -o build/eye_assets.bin
+    python scripts/gen_eye_pack.py main/eye_data/160_160 --stats
+"""
+import argparse
+import math
+import os
+import re
+import struct
+import sys
+from collections import Counter
+
+EYE_PACK_MAGIC = b"EYEP"
+EYE_PACK_VERSION = 3
+EYE_PACK_FLAG_COMPRESSED = 1
+EYE_PACK_FLAG_PALETTE = 2
+EYE_PALETTE_SIZE = 256
+HEADER_FORMAT = "<4sHHI8HHH"
+EYE_CODEC_SEGMENT = 64
+STYLE_FORMAT = "<16s5IBBH"
+
+# 和 Application::eye_style() 的样式编号一一对应（第i条是样式i+1），
+# sclera_id / iris_id 是 eye_assets.h 中 EyeSclera / EyeIris 的编号
+STYLES = [
+    ("default",    "sclera_default",          0, "default.h",    "iris_default",          0),
+    ("blood",      "sclera_style_white",      1, "blood.h",      "iris_style_blood",      1),
+    ("cospa",      "sclera_style_cute_girl",  3, "cospa.h",      "iris_style_cospa1",     2),
+    ("spikes",     "sclera_style_white",      1, "spikes.h",     "iris_style_spikes",     3),
+    ("ribbon",     "sclera_style_ocean_girl", 4, "ribbon.h",     "iris_style_ribbon",     4),
+    ("black_star", "sclera_style_zhuozhu",    2, "black_star.h", "iris_style_black_star", 5),
+    ("straw",      "sclera_style_lufei",      5, "straw.h",      "iris_style_straw",      6),
+]
+
+
+def read_define(text, name):
+    m = re.search(r"#define\s+" + name + r"\s+(\d+)", text)
+    if not m:
+        raise ValueError(f"{name} not found")
+    return int(m.group(1))
+
+
+def read_array(text, ctype, name, count):
+    m = re.search(r"const " + ctype + r" " + name + r"\[[^\]]*\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not m:
+        raise ValueError(f"{name} not found")
+    values = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", m.group(1))]
+    if len(values) > count:
+        raise ValueError(f"{name}: {len(values)} values, expected {count}")
+    # 和C数组一样，未给出的元素补0
+    return values + [0] * (count - len(values))
+
+
+def encode_segment(pixels):
+    """按 eye_codec.h 的操作码编码一段像素，每段从“前一个像素 = 0”开始"""
+    out = bytearray()
+    prev, run = 0, 0
+    for p in pixels:
+        if p == prev:
+            run += 1
+            if run == 64:
+                out.append(63)
+                run = 0
+            continue
+        if run:
+            out.append(run - 1)
+            run = 0
+        dr = ((p >> 11) - (prev >> 11) + 16) % 32 - 16
+        dg = (((p >> 5) & 63) - ((prev >> 5) & 63) + 32) % 64 - 32
+        db = ((p & 31) - (prev & 31) + 16) % 32 - 16
+        if -2 <= dr <= 1 and -4 <= dg <= 3 and -2 <= db <= 1:
+            out.append(0x80 | ((dr + 2) << 5) | ((dg + 4) << 2) | (db + 2))
+        elif -16 <= dg <= 15 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+            out += bytes([0x40 | (dg + 16), ((dr - dg + 8) << 4) | (db - dg + 8)])
+        else:
+            out += bytes([0x60, p & 0xFF, p >> 8])
+        prev = p
+    if run:
+        out.append(run - 1)
+    return out
+
+
+def decode_segment(data, pos, count):
+    out = []
+    prev = r = g = b = 0
+    while len(out) < count:
+        op = data[pos]
+        pos += 1
+        if op < 0x40:
+            out += [prev] * min(op + 1, count - len(out))
+            continue
+        if op >= 0x80:
+            r, g, b = r + ((op >> 5) & 3) - 2, g + ((op >> 2) & 7) - 4, b + (op & 3) - 2
+        elif op < 0x60:
+            dg, rb = (op & 0x1F) - 16, data[pos]
+            pos += 1
+            r, g, b = r + dg + (rb >> 4) - 8, g + dg, b + dg + (rb & 15) - 8
+        else:
+            prev = data[pos] | (data[pos + 1] << 8)
+            pos += 2
+            r, g, b = prev >> 11, (prev >> 5) & 63, prev & 31
+            out.append(prev)
+            continue
+        r, g, b = r & 31, g & 63, b & 31
+        prev = (r << 11) | (g << 5) | b
+        out.append(prev)
+    return out
+
+
+def encode_texture(values, width, height):
+    segments = (width + EYE_CODEC_SEGMENT - 1) // EYE_CODEC_SEGMENT
+    rows = bytearray()
+    offsets = []
+    table = 4 * (height + 1)
+    for y in range(height):
+        offsets.append(table + len(rows))
+        line = values[y * width:(y + 1) * width]
+        streams = [encode_segment(line[x:x + EYE_CODEC_SEGMENT]) for x in range(0, width, EYE_CODEC_SEGMENT)]
+        starts, pos = [], 2 * segments
+        for stream in streams:
+            starts.append(pos)
+            pos += len(stream)
+        if pos > 0xFFFF:
+            raise ValueError("row too long for 16-bit segment offsets")
+        rows += struct.pack(f"<{segments}H", *starts) + b"".join(streams)
+        rows += b"\0" * (len(rows) % 2)
+    offsets.append(table + len(rows))
+    return struct.pack(f"<{height + 1}I", *offsets) + rows
+
+
+def decode_texture(data, offset, width, height):
+    segments = (width + EYE_CODEC_SEGMENT - 1) // EYE_CODEC_SEGMENT
+    rows = struct.unpack_from(f"<{height + 1}I", data, offset)
+    values = []
+    for y in range(height):
+        line = offset + rows[y]
+        starts = struct.unpack_from(f"<{segments}H", data, line)
+        for s, start in enumerate(starts):
+            values += decode_segment(data, line + start, min(EYE_CODEC_SEGMENT, width - s * EYE_CODEC_SEGMENT))
+    return values
+
+
+def unpack_565(v):
+    """RGB565拆成三个6位通道，红/蓝乘2后和绿色同一尺度，用于计算颜色距离"""
+    return ((v >> 11) << 1, (v >> 5) & 63, (v & 31) << 1)
+
+
+def pack_565(c):
+    r, g, b = (min(max(int(round(x)), 0), 63) for x in c)
+    return ((r >> 1) << 11) | (g << 5) | (b >> 1)
+
+
+def median_cut(counts, colors):
+    """按像素数加权的中位切分：每次切开误差平方和最大的盒子，沿方差最大的通道在加权中位数处切"""
+    def box(items):
+        n = sum(c for _, c in items)
+        sse, axis = max((sum(p[a] * p[a] * c for p, c in items) - sum(p[a] * c for p, c in items) ** 2 / n, a)
+                        for a in range(3))
+        return sse if len(items) > 1 else -1, axis, items
+
+    boxes = [box([(unpack_565(v), c) for v, c in sorted(counts.items())])]
+    while len(boxes) < colors:
+        i = max(range(len(boxes)), key=lambda k: boxes[k][0])
+        sse, axis, items = boxes[i]
+        if sse < 0:
+            break
+        items = sorted(items, key=lambda t: t[0][axis])
+        half, acc, k = sum(c for _, c in items) / 2, 0, 0
+        while acc + items[k][1] < half:
+            acc += items[k][1]
+            k += 1
+        k = min(max(k, 1), len(items) - 1)
+        boxes[i] = box(items[:k])
+        boxes.append(box(items[k:]))
+    return [[sum(p[a] * c for p, c in items) / sum(c for _, c in items) for a in range(3)] for _, _, items in boxes]
+
+
+def quantize(values, colors=EYE_PALETTE_SIZE, iterations=2):
+    """把RGB565贴图量化成不超过colors种颜色，返回(调色板, 索引)。颜色数不超过colors时无损，
+    否则先中位切分，再对不同的颜色做几轮k-means细化"""
+    counts = Counter(values)
+    if len(counts) <= colors:
+        palette = sorted(counts)
+        lookup = {v: i for i, v in enumerate(palette)}
+        return palette, [lookup[v] for v in values]
+
+    centers = median_cut(counts, colors)
+    points = [(v, unpack_565(v), c) for v, c in sorted(counts.items())]
+    for step in range(iterations + 1):
+        lookup, sums = {}, [[0, 0, 0, 0] for _ in centers]
+        for v, p, c in points:
+            best = min(range(len(centers)), key=lambda k: (p[0] - centers[k][0]) ** 2 +
+                       (p[1] - centers[k][1]) ** 2 + (p[2] - centers[k][2]) ** 2)
+            lookup[v] = best
+            s = sums[best]
+            s[0], s[1], s[2], s[3] = s[0] + p[0] * c, s[1] + p[1] * c, s[2] + p[2] * c, s[3] + c
+        if step < iterations:
+            centers = [[s[a] / s[3] for a in range(3)] if s[3] else centers[k] for k, s in enumerate(sums)]
+    return [pack_565(c) for c in centers], [lookup[v] for v in values]
+
+
+def encode_palette(values):
+    """调色板贴图：256项调色板预先交换字节序，合成时查表结果可直接送屏"""
+    palette, indices = quantize(values)
+    palette = [((p >> 8) | (p << 8)) & 0xFFFF for p in palette]
+    palette += [0] * (EYE_PALETTE_SIZE - len(palette))
+    return struct.pack(f"<{EYE_PALETTE_SIZE}H", *palette) + bytes(indices)
+
+
+def decode_palette(data, offset, count):
+    palette = struct.unpack_from(f"<{EYE_PALETTE_SIZE}H", data, offset)
+    indices = data[offset + 2 * EYE_PALETTE_SIZE:offset + 2 * EYE_PALETTE_SIZE + count]
+    return [((palette[i] >> 8) | (palette[i] << 8)) & 0xFFFF for i in indices]
+
+
+def psnr(source, values):
+    se = sum((a - b) ** 2 for x, y in zip(source, values) for a, b in zip(unpack_565(x), unpack_565(y)))
+    return float("inf") if se == 0 else 10 * math.log10(63 * 63 * 3 * len(source) / se)
+
+
+def read_file(eye_dir, name):
+    return open(os.path.join(eye_dir, name), encoding="utf-8").read()
+
+
+def load(eye_dir):
+    common = read_file(eye_dir, "common.h")
+    dims = {name: read_define(common, name) for name in (
+        "SCREEN_WIDTH", "SCREEN_HEIGHT", "SCLERA_WIDTH", "SCLERA_HEIGHT",
+        "IRIS_WIDTH", "IRIS_HEIGHT", "IRIS_MAP_WIDTH", "IRIS_MAP_HEIGHT")}
+    screen = dims["SCREEN_WIDTH"] * dims["SCREEN_HEIGHT"]
+    sclera_count = dims["SCLERA_WIDTH"] * dims["SCLERA_HEIGHT"]
+    iris_count = dims["IRIS_MAP_WIDTH"] * dims["IRIS_MAP_HEIGHT"]
+
+    # 眼睑阈值图按 SYMMETRICAL_EYELID 选择对应的一组
+    lids = read_file(eye_dir, "upper_lower_common.h")
+    symmetrical, rest = lids.split("#else", 1)
+    asymmetrical, tail = rest.split("#endif", 1)
+    part = symmetrical if re.search(r"#define\s+SYMMETRICAL_EYELID", common) else asymmetrical
+    upper = read_array(part, "uint8_t", "upper_default", screen)
+    lower = read_array(part, "uint8_t", "lower_default", screen)
+    polar = read_array(tail, "uint16_t", "polar_default", dims["IRIS_WIDTH"] * dims["IRIS_HEIGHT"])
+
+    scleras = read_file(eye_dir, "sclera_common.h")
+    styles = []
+    for name, sclera_name, sclera_id, iris_file, iris_name, iris_id in STYLES:
+        sclera = read_array(scleras, "uint16_t", sclera_name, sclera_count)
+        iris = read_array(read_file(eye_dir, iris_file), "uint16_t", iris_name, iris_count)
+        styles.append((name, sclera, sclera_id, iris, iris_id))
+    return dims, upper, lower, polar, styles
+
+
+def pack(eye_dir, compress=True, palette=False):
+    dims, upper, lower, polar, styles = load(eye_dir)
+    compress = compress and not palette
+    data_offset = struct.calcsize(HEADER_FORMAT) + struct.calcsize(STYLE_FORMAT) * len(styles)
+    blobs = bytearray()
+    offsets = {}
+
+    def add(kind, values, width, height, texture=False):
+        if palette and texture:
+            raw = encode_palette(values)
+        elif compress:
+            raw = encode_texture(values, width, height)
+        else:
+            raw = struct.pack(f"<{len(values)}{kind}", *values)
+        if raw not in offsets:
+            offsets[raw] = data_offset + len(blobs)
+            blobs.extend(raw)
+            blobs.extend(b"\0" * (-len(blobs) % 4))
+        return offsets[raw]
+
+    screen = (dims["SCREEN_WIDTH"], dims["SCREEN_HEIGHT"])
+    upper_off, lower_off = add("B", upper, *screen), add("B", lower, *screen)
+    polar_off = add("H", polar, dims["IRIS_WIDTH"], dims["IRIS_HEIGHT"])
+    records = bytearray()
+    for name, sclera, sclera_id, iris, iris_id in styles:
+        records += struct.pack(STYLE_FORMAT, name.encode(),
+                               add("H", sclera, dims["SCLERA_WIDTH"], dims["SCLERA_HEIGHT"], True),
+                               add("H", iris, dims["IRIS_MAP_WIDTH"], dims["IRIS_MAP_HEIGHT"], True),
+                               polar_off, upper_off, lower_off, sclera_id, iris_id, 0)
+
+    size = data_offset + len(blobs)
+    header = struct.pack(HEADER_FORMAT, EYE_PACK_MAGIC, EYE_PACK_VERSION, len(styles), size,
+                         dims["SCREEN_WIDTH"], dims["SCREEN_HEIGHT"], dims["SCLERA_WIDTH"], dims["SCLERA_HEIGHT"],
+                         dims["IRIS_WIDTH"], dims["IRIS_HEIGHT"], dims["IRIS_MAP_WIDTH"], dims["IRIS_MAP_HEIGHT"],
+                         (EYE_PACK_FLAG_COMPRESSED if compress else 0) | (EYE_PACK_FLAG_PALETTE if palette else 0), 0)
+    return header + records + blobs
+
+
+def check(eye_dir, path):
+    """按固件的校验规则重新解析资源包，并和源数据逐项比较"""
+    data = open(path, "rb").read()
+    dims, upper, lower, polar, styles = load(eye_dir)
+    magic, version, count, size, *geometry, flags, _ = struct.unpack_from(HEADER_FORMAT, data)
+    if (magic != EYE_PACK_MAGIC or version != EYE_PACK_VERSION or size > len(data) or size % 4 or
+            flags & ~(EYE_PACK_FLAG_COMPRESSED | EYE_PACK_FLAG_PALETTE) or
+            flags == EYE_PACK_FLAG_COMPRESSED | EYE_PACK_FLAG_PALETTE):
+        raise ValueError("bad header")
+    if count != len(styles) or geometry != list(dims.values()):
+        raise ValueError("header does not match source data")
+
+    def blob(offset, kind, width, height):
+        if offset % 4:
+            raise ValueError(f"blob at {offset} not aligned")
+        if flags & EYE_PACK_FLAG_COMPRESSED:
+            return decode_texture(data, offset, width, height)
+        if offset + struct.calcsize(f"<{width * height}{kind}") > size:
+            raise ValueError(f"blob at {offset} out of range")
+        return list(struct.unpack_from(f"<{width * height}{kind}", data, offset))
+
+    # 调色板贴图是有损的：按同样的量化重新编码后逐字节比较，并记录最差的PSNR
+    worst = [float("inf")]
+
+    def texture(offset, values, width, height):
+        if not flags & EYE_PACK_FLAG_PALETTE:
+            return blob(offset, "H", width, height) == values
+        expected = encode_palette(values)
+        if offset % 4 or offset + len(expected) > size or data[offset:offset + len(expected)] != expected:
+            return False
+        worst[0] = min(worst[0], psnr(values, decode_palette(data, offset, width * height)))
+        return True
+
+    screen = (dims["SCREEN_WIDTH"], dims["SCREEN_HEIGHT"])
+    for i, (name, sclera, sclera_id, iris, iris_id) in enumerate(styles):
+        record = struct.unpack_from(STYLE_FORMAT, data, struct.calcsize(HEADER_FORMAT) + i * struct.calcsize(STYLE_FORMAT))
+        rname, sclera_off, iris_off, polar_off, upper_off, lower_off, rsclera_id, riris_id, _ = record
+        if rname.rstrip(b"\0").decode() != name or (rsclera_id, riris_id) != (sclera_id, iris_id):
+            raise ValueError(f"style {i} record mismatch")
+        if (not texture(sclera_off, sclera, dims["SCLERA_WIDTH"], dims["SCLERA_HEIGHT"]) or
+                not texture(iris_off, iris, dims["IRIS_MAP_WIDTH"], dims["IRIS_MAP_HEIGHT"]) or
+                blob(polar_off, "H", dims["IRIS_WIDTH"], dims["IRIS_HEIGHT"]) != polar or
+                blob(upper_off, "B", *screen) != upper or blob(lower_off, "B", *screen) != lower):
+            raise ValueError(f"style {i} ({name}) data mismatch")
+    if flags & EYE_PACK_FLAG_PALETTE:
+        mode = f"palette, worst PSNR {worst[0]:.1f} dB"
+    else:
+        mode = "compressed" if flags & EYE_PACK_FLAG_COMPRESSED else "raw"
+    print(f"{path}: {count} styles, {size} bytes, {mode}, OK")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Pack eye textures into an mmap-able asset pack")
+    parser.add_argument("eye_dir", help="eye data directory, e.g. main/eye_data/160_160")
+    parser.add_argument("-o", "--output", help="output pack file")
+    parser.add_argument("--check", metavar="PACK", help="verify an existing pack against eye_dir")
+    parser.add_argument("--raw", action="store_true", help="store textures uncompressed")
+    parser.add_argument("--palette", action="store_true", help="store sclera/iris as 8-bit palette textures")
+    parser.add_argument("--stats", action="store_true", help="print raw, compressed and palette pack sizes")
+    args = parser.parse_args()
+
+    if args.check:
+        check(args.eye_dir, args.check)
+    elif args.stats:
+        raw, packed = len(pack(args.eye_dir, False)), len(pack(args.eye_dir, True))
+        indexed = len(pack(args.eye_dir, palette=True))
+        print(f"{args.eye_dir}: raw {raw} bytes, compressed {packed} bytes ({packed * 100 // raw}%), "
+              f"palette {indexed} bytes ({indexed * 100 // raw}%)")
+    elif args.output:
+        data = pack(args.eye_dir, not args.raw, args.palette)
+        os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+        with open(args.output, "wb") as f:
+            f.write(data)
+        print(f"{args.output}: {len(STYLES)} styles, {len(data)} bytes")
+    else:
+        parser.print_usage()
+        sys.exit(1)